@@ -32,6 +32,7 @@
 
 #include "../contam/PrjModel.hpp"
 #include "../contam/PrjAirflowElements.hpp"
+#include "../contam/PrjReader.hpp"
 
 // Test adding airflow elements
 TEST_F(AirflowFixture, ContamModel_AirflowElements) {
@@ -139,3 +140,38 @@ TEST_F(AirflowFixture, ContamModel_Zones) {
   EXPECT_EQ(zone1, model.zones()[1]);
   EXPECT_EQ(zone2, model.zones()[2]);
 }
+
+TEST_F(AirflowFixture, ContamModel_PrjFloat) {
+  boost::optional<openstudio::contam::PrjFloat> value = openstudio::contam::PrjFloat::parse("6.13696e-008");
+  ASSERT_TRUE(value);
+  EXPECT_DOUBLE_EQ(6.13696e-8, value->value());
+  EXPECT_EQ("6.13696e-08", value->toString());
+  EXPECT_TRUE(value == openstudio::contam::PrjFloat::parse(value->toString()));
+
+  // Values set numerically are written with full precision
+  openstudio::contam::PrjFloat third(1.0 / 3.0);
+  EXPECT_EQ(1.0 / 3.0, openstudio::contam::PrjFloat(third.toString()).value());
+
+  EXPECT_FALSE(openstudio::contam::PrjFloat::parse("abc"));
+  EXPECT_FALSE(openstudio::contam::PrjFloat::parse("1.0x"));
+  EXPECT_FALSE(openstudio::contam::PrjFloat::parse(""));
+  EXPECT_TRUE(openstudio::contam::PrjFloat::parse("+1.5"));
+
+  openstudio::contam::PlrTest1 afe(OPNG, "external", "", "6.13696e-008", "0.000499082", "0.65", "75", "0.00906345");
+  EXPECT_DOUBLE_EQ(0.65, afe.expt());
+  EXPECT_FALSE(afe.setExpt("not a number"));
+  EXPECT_DOUBLE_EQ(0.65, afe.expt());
+}
+
+TEST_F(AirflowFixture, ContamModel_Reader) {
+  openstudio::contam::Reader reader("! a comment line\n1 2.5 name ! trailing comment\n\t-3  4e2\r\nwhole line\n-999\n");
+  EXPECT_EQ(1, reader.readInt());
+  EXPECT_DOUBLE_EQ(2.5, reader.readDouble());
+  EXPECT_EQ("name", reader.readString());
+  EXPECT_EQ(-3, reader.readInt());
+  EXPECT_DOUBLE_EQ(400.0, reader.readNumber<double>());
+  EXPECT_EQ("whole line", reader.readLine());
+  reader.read999();
+  EXPECT_EQ(5, reader.lineNumber());
+  EXPECT_THROW(reader.readString(), std::exception);
+}
@@ -31,6 +31,7 @@
 #include "AirflowFixture.hpp"
 
 #include "../contam/ForwardTranslator.hpp"
+#include "../contam/PrjReader.hpp"
 
 #include "../../model/Model.hpp"
 #include "../../model/Building.hpp"
@@ -234,3 +235,26 @@ TEST_F(AirflowFixture, ForwardTranslator_DemoModel_2014) {
 
   ASSERT_TRUE(prjModel);
 }
+
+TEST_F(AirflowFixture, ForwardTranslator_PrjRoundTrip) {
+  openstudio::path modelPath = (resourcesPath() / openstudio::toPath("contam") / openstudio::toPath("CONTAMTemplate.osm"));
+  openstudio::osversion::VersionTranslator vt;
+  boost::optional<openstudio::model::Model> optionalModel = vt.loadModel(modelPath);
+  ASSERT_TRUE(optionalModel);
+
+  boost::optional<openstudio::model::Model> demoModel = buildDemoModel2012(optionalModel.get());
+  ASSERT_TRUE(demoModel);
+
+  openstudio::contam::ForwardTranslator translator;
+  boost::optional<openstudio::contam::IndexModel> prjModel = translator.translateModel(demoModel.get());
+  ASSERT_TRUE(prjModel);
+
+  // Reading the PRJ back in and writing it again should reproduce it exactly
+  std::string prj = prjModel->toString();
+  openstudio::contam::Reader reader(prj);
+  openstudio::contam::IndexModel readModel(reader);
+  ASSERT_TRUE(readModel.valid());
+  EXPECT_EQ(prjModel->zones().size(), readModel.zones().size());
+  EXPECT_EQ(prjModel->airflowPaths().size(), readModel.airflowPaths().size());
+  EXPECT_EQ(prj, readModel.toString());
+}
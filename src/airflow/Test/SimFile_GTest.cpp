@@ -0,0 +1,119 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2023, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/SimFile.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
+
+TEST_F(AirflowFixture, SimFile_LfrNfr) {
+  const openstudio::path tempDir = openstudio::filesystem::temp_directory_path();
+  const openstudio::path simPath = tempDir / openstudio::toPath("SimFile_LfrNfr.sim");
+  const openstudio::path lfrPath = tempDir / openstudio::toPath("SimFile_LfrNfr.lfr");
+  const openstudio::path nfrPath = tempDir / openstudio::toPath("SimFile_LfrNfr.nfr");
+  {
+    openstudio::filesystem::ofstream lfr(lfrPath);
+    lfr << "day\ttime\tP#\tdP\tF0\tF1\n";
+    lfr << "01/01\t00:00:00\t1\t1.5\t0.25\t0\n";
+    lfr << "01/01\t00:00:00\t2\t-2\t0\t-0.5\n";
+    lfr << "01/01\t01:00:00\t2\t-4\t0\t-1.5\n";
+    lfr << "01/01\t01:00:00\t1\t2.5\t0.75\t0\r\n";
+    lfr << "01/01\t02:00:00\t1\t3.5\t1.25\t0\n";
+    lfr << "01/01\t02:00:00\t2\t-6\t0\t-2.5\n";
+  }
+  {
+    openstudio::filesystem::ofstream nfr(nfrPath);
+    nfr << "day\ttime\tZ#\tT\tP\tD\n";
+    nfr << "01/01\t00:00:00\t0\t273.15\t0\t-\n";
+    nfr << "01/01\t00:00:00\t1\t293.15\t1\t1.2\n";
+    nfr << "01/01\t01:00:00\t0\t274.15\t0\t-\n";
+    nfr << "01/01\t01:00:00\t1\t294.15\t3\t1.2\n";
+    nfr << "01/01\t02:00:00\t0\t275.15\t0\t-\n";
+    nfr << "01/01\t02:00:00\t1\t295.15\t5\t1.2";
+  }
+
+  openstudio::contam::SimFile sim(simPath);
+  ASSERT_EQ(3u, sim.fileDateTimes().size());
+  ASSERT_EQ(2u, sim.dateTimes().size());
+
+  // Raw values are views into the file results, rows for a path need not be in the same order every time step
+  openstudio::contam::SimFile::Column dP = sim.pathDeltaPValues(2);
+  ASSERT_EQ(3u, dP.size());
+  EXPECT_DOUBLE_EQ(-2.0, dP[0]);
+  EXPECT_DOUBLE_EQ(-4.0, dP[1]);
+  EXPECT_DOUBLE_EQ(-6.0, dP[2]);
+  EXPECT_TRUE(sim.pathDeltaPValues(3).empty());
+  EXPECT_DOUBLE_EQ(0.0, sim.nodeDensityValues(0)[1]);
+
+  // Time series are the interval averages
+  boost::optional<openstudio::TimeSeries> flow = sim.pathFlow(1);
+  ASSERT_TRUE(flow);
+  ASSERT_EQ(2u, flow->values().size());
+  EXPECT_DOUBLE_EQ(0.5, flow->values()[0]);
+  EXPECT_DOUBLE_EQ(1.0, flow->values()[1]);
+  EXPECT_FALSE(sim.pathFlow(3));
+
+  boost::optional<openstudio::TimeSeries> pressure = sim.nodePressure(1);
+  ASSERT_TRUE(pressure);
+  EXPECT_DOUBLE_EQ(2.0, pressure->values()[0]);
+  EXPECT_DOUBLE_EQ(4.0, pressure->values()[1]);
+
+  std::vector<std::vector<double>> F1 = sim.F1();
+  ASSERT_EQ(2u, F1.size());
+  EXPECT_EQ(std::vector<double>({-0.5, -1.5, -2.5}), F1[1]);
+
+  openstudio::filesystem::remove(lfrPath);
+  openstudio::filesystem::remove(nfrPath);
+}
+
+TEST_F(AirflowFixture, SimFile_IncompleteTimeStep) {
+  // Every time step must list every path, a short one is an error wherever it is, including the last one
+  const std::string header = "day\ttime\tP#\tdP\tF0\tF1\n";
+  const std::string firstStep = "01/01\t00:00:00\t1\t1.5\t0.25\t0\n01/01\t00:00:00\t2\t-2\t0\t-0.5\n";
+  const std::vector<std::string> bodies{
+    firstStep + "01/01\t01:00:00\t2\t-4\t0\t-1.5\n01/01\t02:00:00\t1\t3.5\t1.25\t0\n01/01\t02:00:00\t2\t-6\t0\t-2.5\n",
+    firstStep + "01/01\t01:00:00\t1\t2.5\t0.75\t0\n01/01\t01:00:00\t2\t-4\t0\t-1.5\n01/01\t02:00:00\t1\t3.5\t1.25\t0\n",
+    firstStep + "01/01\t01:00:00\t1\t2.5\t0.75\t0\n01/01\t01:00:00\t1\t2.5\t0.75\t0\n",
+  };
+
+  const openstudio::path tempDir = openstudio::filesystem::temp_directory_path();
+  const openstudio::path lfrPath = tempDir / openstudio::toPath("SimFile_IncompleteTimeStep.lfr");
+  for (const auto& body : bodies) {
+    {
+      openstudio::filesystem::ofstream lfr(lfrPath);
+      lfr << header << body;
+    }
+    openstudio::contam::SimFile sim(tempDir / openstudio::toPath("SimFile_IncompleteTimeStep.sim"));
+    EXPECT_TRUE(sim.pathDeltaPValues(1).empty()) << body;
+    EXPECT_FALSE(sim.pathFlow(1)) << body;
+  }
+  openstudio::filesystem::remove(lfrPath);
+}
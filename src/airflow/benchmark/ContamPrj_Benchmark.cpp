@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include "../contam/ForwardTranslator.hpp"
+#include "../contam/PrjModel.hpp"
+#include "../contam/PrjReader.hpp"
+#include "../Test/DemoModel.hpp"
+#include "../../osversion/VersionTranslator.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <resources.hxx>
+
+using namespace openstudio;
+
+static std::string demoPrj(bool demo2014) {
+  path modelPath = resourcesPath() / toPath("contam/CONTAMTemplate.osm");
+  osversion::VersionTranslator vt;
+  boost::optional<model::Model> templateModel = vt.loadModel(modelPath);
+  boost::optional<model::Model> demoModel = demo2014 ? buildDemoModel2014(templateModel.get()) : buildDemoModel2012(templateModel.get());
+  contam::ForwardTranslator translator;
+  return translator.translateModel(demoModel.get())->toString();
+}
+
+static void BM_PrjRead(benchmark::State& state, bool demo2014) {
+  const std::string prj = demoPrj(demo2014);
+
+  for (auto _ : state) {
+    contam::Reader reader(prj);
+    contam::IndexModel prjModel(reader);
+    benchmark::DoNotOptimize(prjModel);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(prj.size()));
+}
+
+static void BM_PrjWrite(benchmark::State& state, bool demo2014) {
+  const std::string prj = demoPrj(demo2014);
+  contam::Reader reader(prj);
+  contam::IndexModel prjModel(reader);
+
+  for (auto _ : state) {
+    std::string output = prjModel.toString();
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(prj.size()));
+}
+
+static void BM_PrjRoundTrip(benchmark::State& state, bool demo2014) {
+  const std::string prj = demoPrj(demo2014);
+
+  for (auto _ : state) {
+    contam::Reader reader(prj);
+    contam::IndexModel prjModel(reader);
+    std::string output = prjModel.toString();
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(prj.size()));
+}
+
+BENCHMARK_CAPTURE(BM_PrjRead, DemoModel2012, false);
+BENCHMARK_CAPTURE(BM_PrjRead, DemoModel2014, true);
+BENCHMARK_CAPTURE(BM_PrjWrite, DemoModel2012, false);
+BENCHMARK_CAPTURE(BM_PrjWrite, DemoModel2014, true);
+BENCHMARK_CAPTURE(BM_PrjRoundTrip, DemoModel2012, false);
+BENCHMARK_CAPTURE(BM_PrjRoundTrip, DemoModel2014, true);
@@ -39,13 +39,13 @@ namespace contam {
     void PlrOrfImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
-      m_area = PRJFLOAT("0.0");
-      m_dia = PRJFLOAT("0.0");
-      m_coef = PRJFLOAT("0.0");
-      m_Re = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
+      m_area = PRJFLOAT(0.0);
+      m_dia = PRJFLOAT(0.0);
+      m_coef = PRJFLOAT(0.0);
+      m_Re = PRJFLOAT(0.0);
       m_u_A = 0;
       m_u_D = 0;
     }
@@ -104,13 +104,13 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setArea(input.readNumber<std::string>());
-      setDia(input.readNumber<std::string>());
-      setCoef(input.readNumber<std::string>());
-      setRe(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setArea(input.readNumber<double>());
+      setDia(input.readNumber<double>());
+      setCoef(input.readNumber<double>());
+      setRe(input.readNumber<double>());
       setU_A(input.read<int>());
       setU_D(input.read<int>());
     }
@@ -125,13 +125,13 @@ namespace contam {
     }
 
     void PlrOrfImpl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setArea(input.readNumber<std::string>());
-      setDia(input.readNumber<std::string>());
-      setCoef(input.readNumber<std::string>());
-      setRe(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setArea(input.readNumber<double>());
+      setDia(input.readNumber<double>());
+      setCoef(input.readNumber<double>());
+      setRe(input.readNumber<double>());
       setU_A(input.read<int>());
       setU_D(input.read<int>());
     }
@@ -169,94 +169,94 @@ namespace contam {
     }
 
     double PlrOrfImpl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool PlrOrfImpl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool PlrOrfImpl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double PlrOrfImpl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool PlrOrfImpl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool PlrOrfImpl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double PlrOrfImpl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool PlrOrfImpl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool PlrOrfImpl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     double PlrOrfImpl::area() const {
-      return openstudio::string_conversions::to<double>(m_area);
+      return m_area.value();
     }
 
     bool PlrOrfImpl::setArea(const double area) {
-      m_area = openstudio::string_conversions::number(area);
+      m_area = PRJFLOAT(area);
       return true;
     }
 
     bool PlrOrfImpl::setArea(const std::string& area) {
-      return assign_if_valid<double>(area, m_area);
+      return m_area.assign(area);
     }
 
     double PlrOrfImpl::dia() const {
-      return openstudio::string_conversions::to<double>(m_dia);
+      return m_dia.value();
     }
 
     bool PlrOrfImpl::setDia(const double dia) {
-      m_dia = openstudio::string_conversions::number(dia);
+      m_dia = PRJFLOAT(dia);
       return true;
     }
 
     bool PlrOrfImpl::setDia(const std::string& dia) {
-      return assign_if_valid<double>(dia, m_dia);
+      return m_dia.assign(dia);
     }
 
     double PlrOrfImpl::coef() const {
-      return openstudio::string_conversions::to<double>(m_coef);
+      return m_coef.value();
     }
 
     bool PlrOrfImpl::setCoef(const double coef) {
-      m_coef = openstudio::string_conversions::number(coef);
+      m_coef = PRJFLOAT(coef);
       return true;
     }
 
     bool PlrOrfImpl::setCoef(const std::string& coef) {
-      return assign_if_valid<double>(coef, m_coef);
+      return m_coef.assign(coef);
     }
 
     double PlrOrfImpl::Re() const {
-      return openstudio::string_conversions::to<double>(m_Re);
+      return m_Re.value();
     }
 
     bool PlrOrfImpl::setRe(const double Re) {
-      m_Re = openstudio::string_conversions::number(Re);
+      m_Re = PRJFLOAT(Re);
       return true;
     }
 
     bool PlrOrfImpl::setRe(const std::string& Re) {
-      return assign_if_valid<double>(Re, m_Re);
+      return m_Re.assign(Re);
     }
 
     int PlrOrfImpl::u_A() const {
@@ -278,14 +278,14 @@ namespace contam {
     void PlrLeakImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
-      m_coef = PRJFLOAT("0.0");
-      m_pres = PRJFLOAT("0.0");
-      m_area1 = PRJFLOAT("0.0");
-      m_area2 = PRJFLOAT("0.0");
-      m_area3 = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
+      m_coef = PRJFLOAT(0.0);
+      m_pres = PRJFLOAT(0.0);
+      m_area1 = PRJFLOAT(0.0);
+      m_area2 = PRJFLOAT(0.0);
+      m_area3 = PRJFLOAT(0.0);
       m_u_A1 = 0;
       m_u_A2 = 0;
       m_u_A3 = 0;
@@ -353,14 +353,14 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setCoef(input.readNumber<std::string>());
-      setPres(input.readNumber<std::string>());
-      setArea1(input.readNumber<std::string>());
-      setArea2(input.readNumber<std::string>());
-      setArea3(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setCoef(input.readNumber<double>());
+      setPres(input.readNumber<double>());
+      setArea1(input.readNumber<double>());
+      setArea2(input.readNumber<double>());
+      setArea3(input.readNumber<double>());
       setU_A1(input.read<int>());
       setU_A2(input.read<int>());
       setU_A3(input.read<int>());
@@ -378,14 +378,14 @@ namespace contam {
     }
 
     void PlrLeakImpl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setCoef(input.readNumber<std::string>());
-      setPres(input.readNumber<std::string>());
-      setArea1(input.readNumber<std::string>());
-      setArea2(input.readNumber<std::string>());
-      setArea3(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setCoef(input.readNumber<double>());
+      setPres(input.readNumber<double>());
+      setArea1(input.readNumber<double>());
+      setArea2(input.readNumber<double>());
+      setArea3(input.readNumber<double>());
       setU_A1(input.read<int>());
       setU_A2(input.read<int>());
       setU_A3(input.read<int>());
@@ -425,107 +425,107 @@ namespace contam {
     }
 
     double PlrLeakImpl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool PlrLeakImpl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool PlrLeakImpl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double PlrLeakImpl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool PlrLeakImpl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool PlrLeakImpl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double PlrLeakImpl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool PlrLeakImpl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool PlrLeakImpl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     double PlrLeakImpl::coef() const {
-      return openstudio::string_conversions::to<double>(m_coef);
+      return m_coef.value();
     }
 
     bool PlrLeakImpl::setCoef(const double coef) {
-      m_coef = openstudio::string_conversions::number(coef);
+      m_coef = PRJFLOAT(coef);
       return true;
     }
 
     bool PlrLeakImpl::setCoef(const std::string& coef) {
-      return assign_if_valid<double>(coef, m_coef);
+      return m_coef.assign(coef);
     }
 
     double PlrLeakImpl::pres() const {
-      return openstudio::string_conversions::to<double>(m_pres);
+      return m_pres.value();
     }
 
     bool PlrLeakImpl::setPres(const double pres) {
-      m_pres = openstudio::string_conversions::number(pres);
+      m_pres = PRJFLOAT(pres);
       return true;
     }
 
     bool PlrLeakImpl::setPres(const std::string& pres) {
-      return assign_if_valid<double>(pres, m_pres);
+      return m_pres.assign(pres);
     }
 
     double PlrLeakImpl::area1() const {
-      return openstudio::string_conversions::to<double>(m_area1);
+      return m_area1.value();
     }
 
     bool PlrLeakImpl::setArea1(const double area1) {
-      m_area1 = openstudio::string_conversions::number(area1);
+      m_area1 = PRJFLOAT(area1);
       return true;
     }
 
     bool PlrLeakImpl::setArea1(const std::string& area1) {
-      return assign_if_valid<double>(area1, m_area1);
+      return m_area1.assign(area1);
     }
 
     double PlrLeakImpl::area2() const {
-      return openstudio::string_conversions::to<double>(m_area2);
+      return m_area2.value();
     }
 
     bool PlrLeakImpl::setArea2(const double area2) {
-      m_area2 = openstudio::string_conversions::number(area2);
+      m_area2 = PRJFLOAT(area2);
       return true;
     }
 
     bool PlrLeakImpl::setArea2(const std::string& area2) {
-      return assign_if_valid<double>(area2, m_area2);
+      return m_area2.assign(area2);
     }
 
     double PlrLeakImpl::area3() const {
-      return openstudio::string_conversions::to<double>(m_area3);
+      return m_area3.value();
     }
 
     bool PlrLeakImpl::setArea3(const double area3) {
-      m_area3 = openstudio::string_conversions::number(area3);
+      m_area3 = PRJFLOAT(area3);
       return true;
     }
 
     bool PlrLeakImpl::setArea3(const std::string& area3) {
-      return assign_if_valid<double>(area3, m_area3);
+      return m_area3.assign(area3);
     }
 
     int PlrLeakImpl::u_A1() const {
@@ -563,11 +563,11 @@ namespace contam {
     void PlrConnImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
-      m_coef = PRJFLOAT("0.0");
-      m_area = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
+      m_coef = PRJFLOAT(0.0);
+      m_area = PRJFLOAT(0.0);
       m_u_A = 0;
     }
 
@@ -619,11 +619,11 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setArea(input.readNumber<std::string>());
-      setCoef(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setArea(input.readNumber<double>());
+      setCoef(input.readNumber<double>());
       setU_A(input.read<int>());
     }
 
@@ -637,11 +637,11 @@ namespace contam {
     }
 
     void PlrConnImpl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setArea(input.readNumber<std::string>());
-      setCoef(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setArea(input.readNumber<double>());
+      setCoef(input.readNumber<double>());
       setU_A(input.read<int>());
     }
 
@@ -678,68 +678,68 @@ namespace contam {
     }
 
     double PlrConnImpl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool PlrConnImpl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool PlrConnImpl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double PlrConnImpl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool PlrConnImpl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool PlrConnImpl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double PlrConnImpl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool PlrConnImpl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool PlrConnImpl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     double PlrConnImpl::area() const {
-      return openstudio::string_conversions::to<double>(m_area);
+      return m_area.value();
     }
 
     bool PlrConnImpl::setArea(const double area) {
-      m_area = openstudio::string_conversions::number(area);
+      m_area = PRJFLOAT(area);
       return true;
     }
 
     bool PlrConnImpl::setArea(const std::string& area) {
-      return assign_if_valid<double>(area, m_area);
+      return m_area.assign(area);
     }
 
     double PlrConnImpl::coef() const {
-      return openstudio::string_conversions::to<double>(m_coef);
+      return m_coef.value();
     }
 
     bool PlrConnImpl::setCoef(const double coef) {
-      m_coef = openstudio::string_conversions::number(coef);
+      m_coef = PRJFLOAT(coef);
       return true;
     }
 
     bool PlrConnImpl::setCoef(const std::string& coef) {
-      return assign_if_valid<double>(coef, m_coef);
+      return m_coef.assign(coef);
     }
 
     int PlrConnImpl::u_A() const {
@@ -753,9 +753,9 @@ namespace contam {
     void PlrGeneralImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
     }
 
     PlrGeneralImpl::PlrGeneralImpl() {
@@ -798,9 +798,9 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
     }
 
     std::string PlrGeneralImpl::write(std::string dataType) {
@@ -812,9 +812,9 @@ namespace contam {
     }
 
     void PlrGeneralImpl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
     }
 
     int PlrGeneralImpl::nr() const {
@@ -850,52 +850,52 @@ namespace contam {
     }
 
     double PlrGeneralImpl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool PlrGeneralImpl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool PlrGeneralImpl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double PlrGeneralImpl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool PlrGeneralImpl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool PlrGeneralImpl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double PlrGeneralImpl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool PlrGeneralImpl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool PlrGeneralImpl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     void PlrTest1Impl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
-      m_dP = PRJFLOAT("0.0");
-      m_Flow = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
+      m_dP = PRJFLOAT(0.0);
+      m_Flow = PRJFLOAT(0.0);
       m_u_P = 0;
       m_u_F = 0;
     }
@@ -950,11 +950,11 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setDP(input.readNumber<std::string>());
-      setFlow(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setDP(input.readNumber<double>());
+      setFlow(input.readNumber<double>());
       setU_P(input.read<int>());
       setU_F(input.read<int>());
     }
@@ -969,11 +969,11 @@ namespace contam {
     }
 
     void PlrTest1Impl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setDP(input.readNumber<std::string>());
-      setFlow(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setDP(input.readNumber<double>());
+      setFlow(input.readNumber<double>());
       setU_P(input.read<int>());
       setU_F(input.read<int>());
     }
@@ -1011,68 +1011,68 @@ namespace contam {
     }
 
     double PlrTest1Impl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool PlrTest1Impl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool PlrTest1Impl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double PlrTest1Impl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool PlrTest1Impl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool PlrTest1Impl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double PlrTest1Impl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool PlrTest1Impl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool PlrTest1Impl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     double PlrTest1Impl::dP() const {
-      return openstudio::string_conversions::to<double>(m_dP);
+      return m_dP.value();
     }
 
     bool PlrTest1Impl::setDP(const double dP) {
-      m_dP = openstudio::string_conversions::number(dP);
+      m_dP = PRJFLOAT(dP);
       return true;
     }
 
     bool PlrTest1Impl::setDP(const std::string& dP) {
-      return assign_if_valid<double>(dP, m_dP);
+      return m_dP.assign(dP);
     }
 
     double PlrTest1Impl::Flow() const {
-      return openstudio::string_conversions::to<double>(m_Flow);
+      return m_Flow.value();
     }
 
     bool PlrTest1Impl::setFlow(const double Flow) {
-      m_Flow = openstudio::string_conversions::number(Flow);
+      m_Flow = PRJFLOAT(Flow);
       return true;
     }
 
     bool PlrTest1Impl::setFlow(const std::string& Flow) {
-      return assign_if_valid<double>(Flow, m_Flow);
+      return m_Flow.assign(Flow);
     }
 
     int PlrTest1Impl::u_P() const {
@@ -1094,13 +1094,13 @@ namespace contam {
     void PlrTest2Impl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
-      m_dP1 = PRJFLOAT("0.0");
-      m_F1 = PRJFLOAT("0.0");
-      m_dP2 = PRJFLOAT("0.0");
-      m_F2 = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
+      m_dP1 = PRJFLOAT(0.0);
+      m_F1 = PRJFLOAT(0.0);
+      m_dP2 = PRJFLOAT(0.0);
+      m_F2 = PRJFLOAT(0.0);
       m_u_P1 = 0;
       m_u_F1 = 0;
       m_u_P2 = 0;
@@ -1165,13 +1165,13 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setDP1(input.readNumber<std::string>());
-      setF1(input.readNumber<std::string>());
-      setDP2(input.readNumber<std::string>());
-      setF2(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setDP1(input.readNumber<double>());
+      setF1(input.readNumber<double>());
+      setDP2(input.readNumber<double>());
+      setF2(input.readNumber<double>());
       setU_P1(input.read<int>());
       setU_F1(input.read<int>());
       setU_P2(input.read<int>());
@@ -1189,13 +1189,13 @@ namespace contam {
     }
 
     void PlrTest2Impl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setDP1(input.readNumber<std::string>());
-      setF1(input.readNumber<std::string>());
-      setDP2(input.readNumber<std::string>());
-      setF2(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setDP1(input.readNumber<double>());
+      setF1(input.readNumber<double>());
+      setDP2(input.readNumber<double>());
+      setF2(input.readNumber<double>());
       setU_P1(input.read<int>());
       setU_F1(input.read<int>());
       setU_P2(input.read<int>());
@@ -1235,94 +1235,94 @@ namespace contam {
     }
 
     double PlrTest2Impl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool PlrTest2Impl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool PlrTest2Impl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double PlrTest2Impl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool PlrTest2Impl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool PlrTest2Impl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double PlrTest2Impl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool PlrTest2Impl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool PlrTest2Impl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     double PlrTest2Impl::dP1() const {
-      return openstudio::string_conversions::to<double>(m_dP1);
+      return m_dP1.value();
     }
 
     bool PlrTest2Impl::setDP1(const double dP1) {
-      m_dP1 = openstudio::string_conversions::number(dP1);
+      m_dP1 = PRJFLOAT(dP1);
       return true;
     }
 
     bool PlrTest2Impl::setDP1(const std::string& dP1) {
-      return assign_if_valid<double>(dP1, m_dP1);
+      return m_dP1.assign(dP1);
     }
 
     double PlrTest2Impl::F1() const {
-      return openstudio::string_conversions::to<double>(m_F1);
+      return m_F1.value();
     }
 
     bool PlrTest2Impl::setF1(const double F1) {
-      m_F1 = openstudio::string_conversions::number(F1);
+      m_F1 = PRJFLOAT(F1);
       return true;
     }
 
     bool PlrTest2Impl::setF1(const std::string& F1) {
-      return assign_if_valid<double>(F1, m_F1);
+      return m_F1.assign(F1);
     }
 
     double PlrTest2Impl::dP2() const {
-      return openstudio::string_conversions::to<double>(m_dP2);
+      return m_dP2.value();
     }
 
     bool PlrTest2Impl::setDP2(const double dP2) {
-      m_dP2 = openstudio::string_conversions::number(dP2);
+      m_dP2 = PRJFLOAT(dP2);
       return true;
     }
 
     bool PlrTest2Impl::setDP2(const std::string& dP2) {
-      return assign_if_valid<double>(dP2, m_dP2);
+      return m_dP2.assign(dP2);
     }
 
     double PlrTest2Impl::F2() const {
-      return openstudio::string_conversions::to<double>(m_F2);
+      return m_F2.value();
     }
 
     bool PlrTest2Impl::setF2(const double F2) {
-      m_F2 = openstudio::string_conversions::number(F2);
+      m_F2 = PRJFLOAT(F2);
       return true;
     }
 
     bool PlrTest2Impl::setF2(const std::string& F2) {
-      return assign_if_valid<double>(F2, m_F2);
+      return m_F2.assign(F2);
     }
 
     int PlrTest2Impl::u_P1() const {
@@ -1360,11 +1360,11 @@ namespace contam {
     void PlrCrackImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
-      m_length = PRJFLOAT("0.0");
-      m_width = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
+      m_length = PRJFLOAT(0.0);
+      m_width = PRJFLOAT(0.0);
       m_u_L = 0;
       m_u_W = 0;
     }
@@ -1419,11 +1419,11 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setLength(input.readNumber<std::string>());
-      setWidth(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setLength(input.readNumber<double>());
+      setWidth(input.readNumber<double>());
       setU_L(input.read<int>());
       setU_W(input.read<int>());
     }
@@ -1438,11 +1438,11 @@ namespace contam {
     }
 
     void PlrCrackImpl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setLength(input.readNumber<std::string>());
-      setWidth(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setLength(input.readNumber<double>());
+      setWidth(input.readNumber<double>());
       setU_L(input.read<int>());
       setU_W(input.read<int>());
     }
@@ -1480,68 +1480,68 @@ namespace contam {
     }
 
     double PlrCrackImpl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool PlrCrackImpl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool PlrCrackImpl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double PlrCrackImpl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool PlrCrackImpl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool PlrCrackImpl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double PlrCrackImpl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool PlrCrackImpl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool PlrCrackImpl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     double PlrCrackImpl::length() const {
-      return openstudio::string_conversions::to<double>(m_length);
+      return m_length.value();
     }
 
     bool PlrCrackImpl::setLength(const double length) {
-      m_length = openstudio::string_conversions::number(length);
+      m_length = PRJFLOAT(length);
       return true;
     }
 
     bool PlrCrackImpl::setLength(const std::string& length) {
-      return assign_if_valid<double>(length, m_length);
+      return m_length.assign(length);
     }
 
     double PlrCrackImpl::width() const {
-      return openstudio::string_conversions::to<double>(m_width);
+      return m_width.value();
     }
 
     bool PlrCrackImpl::setWidth(const double width) {
-      m_width = openstudio::string_conversions::number(width);
+      m_width = PRJFLOAT(width);
       return true;
     }
 
     bool PlrCrackImpl::setWidth(const std::string& width) {
-      return assign_if_valid<double>(width, m_width);
+      return m_width.assign(width);
     }
 
     int PlrCrackImpl::u_L() const {
@@ -1563,12 +1563,12 @@ namespace contam {
     void PlrStairImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
-      m_Ht = PRJFLOAT("0.0");
-      m_Area = PRJFLOAT("0.0");
-      m_peo = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
+      m_Ht = PRJFLOAT(0.0);
+      m_Area = PRJFLOAT(0.0);
+      m_peo = PRJFLOAT(0.0);
       m_tread = 0;
       m_u_A = 0;
       m_u_D = 0;
@@ -1628,12 +1628,12 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setHt(input.readNumber<std::string>());
-      setArea(input.readNumber<std::string>());
-      setPeople(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setHt(input.readNumber<double>());
+      setArea(input.readNumber<double>());
+      setPeople(input.readNumber<double>());
       setTread(input.read<int>());
       setU_A(input.read<int>());
       setU_D(input.read<int>());
@@ -1649,12 +1649,12 @@ namespace contam {
     }
 
     void PlrStairImpl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setHt(input.readNumber<std::string>());
-      setArea(input.readNumber<std::string>());
-      setPeople(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setHt(input.readNumber<double>());
+      setArea(input.readNumber<double>());
+      setPeople(input.readNumber<double>());
       setTread(input.read<int>());
       setU_A(input.read<int>());
       setU_D(input.read<int>());
@@ -1693,81 +1693,81 @@ namespace contam {
     }
 
     double PlrStairImpl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool PlrStairImpl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool PlrStairImpl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double PlrStairImpl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool PlrStairImpl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool PlrStairImpl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double PlrStairImpl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool PlrStairImpl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool PlrStairImpl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     double PlrStairImpl::Ht() const {
-      return openstudio::string_conversions::to<double>(m_Ht);
+      return m_Ht.value();
     }
 
     bool PlrStairImpl::setHt(const double Ht) {
-      m_Ht = openstudio::string_conversions::number(Ht);
+      m_Ht = PRJFLOAT(Ht);
       return true;
     }
 
     bool PlrStairImpl::setHt(const std::string& Ht) {
-      return assign_if_valid<double>(Ht, m_Ht);
+      return m_Ht.assign(Ht);
     }
 
     double PlrStairImpl::area() const {
-      return openstudio::string_conversions::to<double>(m_Area);
+      return m_Area.value();
     }
 
     bool PlrStairImpl::setArea(const double Area) {
-      m_Area = openstudio::string_conversions::number(Area);
+      m_Area = PRJFLOAT(Area);
       return true;
     }
 
     bool PlrStairImpl::setArea(const std::string& Area) {
-      return assign_if_valid<double>(Area, m_Area);
+      return m_Area.assign(Area);
     }
 
     double PlrStairImpl::people() const {
-      return openstudio::string_conversions::to<double>(m_peo);
+      return m_peo.value();
     }
 
     bool PlrStairImpl::setPeople(const double peo) {
-      m_peo = openstudio::string_conversions::number(peo);
+      m_peo = PRJFLOAT(peo);
       return true;
     }
 
     bool PlrStairImpl::setPeople(const std::string& peo) {
-      return assign_if_valid<double>(peo, m_peo);
+      return m_peo.assign(peo);
     }
 
     int PlrStairImpl::tread() const {
@@ -1797,13 +1797,13 @@ namespace contam {
     void PlrShaftImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
-      m_Ht = PRJFLOAT("0.0");
-      m_area = PRJFLOAT("0.0");
-      m_perim = PRJFLOAT("0.0");
-      m_rough = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
+      m_Ht = PRJFLOAT(0.0);
+      m_area = PRJFLOAT(0.0);
+      m_perim = PRJFLOAT(0.0);
+      m_rough = PRJFLOAT(0.0);
       m_u_A = 0;
       m_u_D = 0;
       m_u_P = 0;
@@ -1868,13 +1868,13 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setHt(input.readNumber<std::string>());
-      setArea(input.readNumber<std::string>());
-      setPerim(input.readNumber<std::string>());
-      setRough(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setHt(input.readNumber<double>());
+      setArea(input.readNumber<double>());
+      setPerim(input.readNumber<double>());
+      setRough(input.readNumber<double>());
       setU_A(input.read<int>());
       setU_D(input.read<int>());
       setU_P(input.read<int>());
@@ -1892,13 +1892,13 @@ namespace contam {
     }
 
     void PlrShaftImpl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setHt(input.readNumber<std::string>());
-      setArea(input.readNumber<std::string>());
-      setPerim(input.readNumber<std::string>());
-      setRough(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setHt(input.readNumber<double>());
+      setArea(input.readNumber<double>());
+      setPerim(input.readNumber<double>());
+      setRough(input.readNumber<double>());
       setU_A(input.read<int>());
       setU_D(input.read<int>());
       setU_P(input.read<int>());
@@ -1938,94 +1938,94 @@ namespace contam {
     }
 
     double PlrShaftImpl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool PlrShaftImpl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool PlrShaftImpl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double PlrShaftImpl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool PlrShaftImpl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool PlrShaftImpl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double PlrShaftImpl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool PlrShaftImpl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool PlrShaftImpl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     double PlrShaftImpl::Ht() const {
-      return openstudio::string_conversions::to<double>(m_Ht);
+      return m_Ht.value();
     }
 
     bool PlrShaftImpl::setHt(const double Ht) {
-      m_Ht = openstudio::string_conversions::number(Ht);
+      m_Ht = PRJFLOAT(Ht);
       return true;
     }
 
     bool PlrShaftImpl::setHt(const std::string& Ht) {
-      return assign_if_valid<double>(Ht, m_Ht);
+      return m_Ht.assign(Ht);
     }
 
     double PlrShaftImpl::area() const {
-      return openstudio::string_conversions::to<double>(m_area);
+      return m_area.value();
     }
 
     bool PlrShaftImpl::setArea(const double area) {
-      m_area = openstudio::string_conversions::number(area);
+      m_area = PRJFLOAT(area);
       return true;
     }
 
     bool PlrShaftImpl::setArea(const std::string& area) {
-      return assign_if_valid<double>(area, m_area);
+      return m_area.assign(area);
     }
 
     double PlrShaftImpl::perim() const {
-      return openstudio::string_conversions::to<double>(m_perim);
+      return m_perim.value();
     }
 
     bool PlrShaftImpl::setPerim(const double perim) {
-      m_perim = openstudio::string_conversions::number(perim);
+      m_perim = PRJFLOAT(perim);
       return true;
     }
 
     bool PlrShaftImpl::setPerim(const std::string& perim) {
-      return assign_if_valid<double>(perim, m_perim);
+      return m_perim.assign(perim);
     }
 
     double PlrShaftImpl::rough() const {
-      return openstudio::string_conversions::to<double>(m_rough);
+      return m_rough.value();
     }
 
     bool PlrShaftImpl::setRough(const double rough) {
-      m_rough = openstudio::string_conversions::number(rough);
+      m_rough = PRJFLOAT(rough);
       return true;
     }
 
     bool PlrShaftImpl::setRough(const std::string& rough) {
-      return assign_if_valid<double>(rough, m_rough);
+      return m_rough.assign(rough);
     }
 
     int PlrShaftImpl::u_A() const {
@@ -2063,11 +2063,11 @@ namespace contam {
     void PlrBackDamperImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_Cp = PRJFLOAT("0.0");
-      m_xp = PRJFLOAT("0.0");
-      m_Cn = PRJFLOAT("0.0");
-      m_xn = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_Cp = PRJFLOAT(0.0);
+      m_xp = PRJFLOAT(0.0);
+      m_Cn = PRJFLOAT(0.0);
+      m_xn = PRJFLOAT(0.0);
     }
 
     PlrBackDamperImpl::PlrBackDamperImpl() {
@@ -2116,11 +2116,11 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setCp(input.readNumber<std::string>());
-      setXp(input.readNumber<std::string>());
-      setCn(input.readNumber<std::string>());
-      setXn(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setCp(input.readNumber<double>());
+      setXp(input.readNumber<double>());
+      setCn(input.readNumber<double>());
+      setXn(input.readNumber<double>());
     }
 
     std::string PlrBackDamperImpl::write(std::string dataType) {
@@ -2132,11 +2132,11 @@ namespace contam {
     }
 
     void PlrBackDamperImpl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setCp(input.readNumber<std::string>());
-      setXp(input.readNumber<std::string>());
-      setCn(input.readNumber<std::string>());
-      setXn(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setCp(input.readNumber<double>());
+      setXp(input.readNumber<double>());
+      setCn(input.readNumber<double>());
+      setXn(input.readNumber<double>());
     }
 
     int PlrBackDamperImpl::nr() const {
@@ -2172,75 +2172,75 @@ namespace contam {
     }
 
     double PlrBackDamperImpl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool PlrBackDamperImpl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool PlrBackDamperImpl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double PlrBackDamperImpl::Cp() const {
-      return openstudio::string_conversions::to<double>(m_Cp);
+      return m_Cp.value();
     }
 
     bool PlrBackDamperImpl::setCp(const double Cp) {
-      m_Cp = openstudio::string_conversions::number(Cp);
+      m_Cp = PRJFLOAT(Cp);
       return true;
     }
 
     bool PlrBackDamperImpl::setCp(const std::string& Cp) {
-      return assign_if_valid<double>(Cp, m_Cp);
+      return m_Cp.assign(Cp);
     }
 
     double PlrBackDamperImpl::xp() const {
-      return openstudio::string_conversions::to<double>(m_xp);
+      return m_xp.value();
     }
 
     bool PlrBackDamperImpl::setXp(const double xp) {
-      m_xp = openstudio::string_conversions::number(xp);
+      m_xp = PRJFLOAT(xp);
       return true;
     }
 
     bool PlrBackDamperImpl::setXp(const std::string& xp) {
-      return assign_if_valid<double>(xp, m_xp);
+      return m_xp.assign(xp);
     }
 
     double PlrBackDamperImpl::Cn() const {
-      return openstudio::string_conversions::to<double>(m_Cn);
+      return m_Cn.value();
     }
 
     bool PlrBackDamperImpl::setCn(const double Cn) {
-      m_Cn = openstudio::string_conversions::number(Cn);
+      m_Cn = PRJFLOAT(Cn);
       return true;
     }
 
     bool PlrBackDamperImpl::setCn(const std::string& Cn) {
-      return assign_if_valid<double>(Cn, m_Cn);
+      return m_Cn.assign(Cn);
     }
 
     double PlrBackDamperImpl::xn() const {
-      return openstudio::string_conversions::to<double>(m_xn);
+      return m_xn.value();
     }
 
     bool PlrBackDamperImpl::setXn(const double xn) {
-      m_xn = openstudio::string_conversions::number(xn);
+      m_xn = PRJFLOAT(xn);
       return true;
     }
 
     bool PlrBackDamperImpl::setXn(const std::string& xn) {
-      return assign_if_valid<double>(xn, m_xn);
+      return m_xn.assign(xn);
     }
 
     void QfrQuadraticImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_a = PRJFLOAT("0.0");
-      m_b = PRJFLOAT("0.0");
+      m_a = PRJFLOAT(0.0);
+      m_b = PRJFLOAT(0.0);
     }
 
     QfrQuadraticImpl::QfrQuadraticImpl() {
@@ -2281,8 +2281,8 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setA(input.readNumber<std::string>());
-      setB(input.readNumber<std::string>());
+      setA(input.readNumber<double>());
+      setB(input.readNumber<double>());
     }
 
     std::string QfrQuadraticImpl::write(std::string dataType) {
@@ -2294,8 +2294,8 @@ namespace contam {
     }
 
     void QfrQuadraticImpl::readDetails(Reader& input) {
-      setA(input.readNumber<std::string>());
-      setB(input.readNumber<std::string>());
+      setA(input.readNumber<double>());
+      setB(input.readNumber<double>());
     }
 
     int QfrQuadraticImpl::nr() const {
@@ -2331,39 +2331,39 @@ namespace contam {
     }
 
     double QfrQuadraticImpl::a() const {
-      return openstudio::string_conversions::to<double>(m_a);
+      return m_a.value();
     }
 
     bool QfrQuadraticImpl::setA(const double a) {
-      m_a = openstudio::string_conversions::number(a);
+      m_a = PRJFLOAT(a);
       return true;
     }
 
     bool QfrQuadraticImpl::setA(const std::string& a) {
-      return assign_if_valid<double>(a, m_a);
+      return m_a.assign(a);
     }
 
     double QfrQuadraticImpl::b() const {
-      return openstudio::string_conversions::to<double>(m_b);
+      return m_b.value();
     }
 
     bool QfrQuadraticImpl::setB(const double b) {
-      m_b = openstudio::string_conversions::number(b);
+      m_b = PRJFLOAT(b);
       return true;
     }
 
     bool QfrQuadraticImpl::setB(const std::string& b) {
-      return assign_if_valid<double>(b, m_b);
+      return m_b.assign(b);
     }
 
     void QfrCrackImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_a = PRJFLOAT("0.0");
-      m_b = PRJFLOAT("0.0");
-      m_length = PRJFLOAT("0.0");
-      m_width = PRJFLOAT("0.0");
-      m_depth = PRJFLOAT("0.0");
+      m_a = PRJFLOAT(0.0);
+      m_b = PRJFLOAT(0.0);
+      m_length = PRJFLOAT(0.0);
+      m_width = PRJFLOAT(0.0);
+      m_depth = PRJFLOAT(0.0);
       m_nB = 0;
       m_u_L = 0;
       m_u_W = 0;
@@ -2424,11 +2424,11 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setA(input.readNumber<std::string>());
-      setB(input.readNumber<std::string>());
-      setLength(input.readNumber<std::string>());
-      setWidth(input.readNumber<std::string>());
-      setDepth(input.readNumber<std::string>());
+      setA(input.readNumber<double>());
+      setB(input.readNumber<double>());
+      setLength(input.readNumber<double>());
+      setWidth(input.readNumber<double>());
+      setDepth(input.readNumber<double>());
       setNB(input.read<int>());
       setU_L(input.read<int>());
       setU_W(input.read<int>());
@@ -2445,11 +2445,11 @@ namespace contam {
     }
 
     void QfrCrackImpl::readDetails(Reader& input) {
-      setA(input.readNumber<std::string>());
-      setB(input.readNumber<std::string>());
-      setLength(input.readNumber<std::string>());
-      setWidth(input.readNumber<std::string>());
-      setDepth(input.readNumber<std::string>());
+      setA(input.readNumber<double>());
+      setB(input.readNumber<double>());
+      setLength(input.readNumber<double>());
+      setWidth(input.readNumber<double>());
+      setDepth(input.readNumber<double>());
       setNB(input.read<int>());
       setU_L(input.read<int>());
       setU_W(input.read<int>());
@@ -2489,68 +2489,68 @@ namespace contam {
     }
 
     double QfrCrackImpl::a() const {
-      return openstudio::string_conversions::to<double>(m_a);
+      return m_a.value();
     }
 
     bool QfrCrackImpl::setA(const double a) {
-      m_a = openstudio::string_conversions::number(a);
+      m_a = PRJFLOAT(a);
       return true;
     }
 
     bool QfrCrackImpl::setA(const std::string& a) {
-      return assign_if_valid<double>(a, m_a);
+      return m_a.assign(a);
     }
 
     double QfrCrackImpl::b() const {
-      return openstudio::string_conversions::to<double>(m_b);
+      return m_b.value();
     }
 
     bool QfrCrackImpl::setB(const double b) {
-      m_b = openstudio::string_conversions::number(b);
+      m_b = PRJFLOAT(b);
       return true;
     }
 
     bool QfrCrackImpl::setB(const std::string& b) {
-      return assign_if_valid<double>(b, m_b);
+      return m_b.assign(b);
     }
 
     double QfrCrackImpl::length() const {
-      return openstudio::string_conversions::to<double>(m_length);
+      return m_length.value();
     }
 
     bool QfrCrackImpl::setLength(const double length) {
-      m_length = openstudio::string_conversions::number(length);
+      m_length = PRJFLOAT(length);
       return true;
     }
 
     bool QfrCrackImpl::setLength(const std::string& length) {
-      return assign_if_valid<double>(length, m_length);
+      return m_length.assign(length);
     }
 
     double QfrCrackImpl::width() const {
-      return openstudio::string_conversions::to<double>(m_width);
+      return m_width.value();
     }
 
     bool QfrCrackImpl::setWidth(const double width) {
-      m_width = openstudio::string_conversions::number(width);
+      m_width = PRJFLOAT(width);
       return true;
     }
 
     bool QfrCrackImpl::setWidth(const std::string& width) {
-      return assign_if_valid<double>(width, m_width);
+      return m_width.assign(width);
     }
 
     double QfrCrackImpl::depth() const {
-      return openstudio::string_conversions::to<double>(m_depth);
+      return m_depth.value();
     }
 
     bool QfrCrackImpl::setDepth(const double depth) {
-      m_depth = openstudio::string_conversions::number(depth);
+      m_depth = PRJFLOAT(depth);
       return true;
     }
 
     bool QfrCrackImpl::setDepth(const std::string& depth) {
-      return assign_if_valid<double>(depth, m_depth);
+      return m_depth.assign(depth);
     }
 
     int QfrCrackImpl::nB() const {
@@ -2588,12 +2588,12 @@ namespace contam {
     void QfrTest2Impl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_a = PRJFLOAT("0.0");
-      m_b = PRJFLOAT("0.0");
-      m_dP1 = PRJFLOAT("0.0");
-      m_F1 = PRJFLOAT("0.0");
-      m_dP2 = PRJFLOAT("0.0");
-      m_F2 = PRJFLOAT("0.0");
+      m_a = PRJFLOAT(0.0);
+      m_b = PRJFLOAT(0.0);
+      m_dP1 = PRJFLOAT(0.0);
+      m_F1 = PRJFLOAT(0.0);
+      m_dP2 = PRJFLOAT(0.0);
+      m_F2 = PRJFLOAT(0.0);
       m_u_P1 = 0;
       m_u_F1 = 0;
       m_u_P2 = 0;
@@ -2656,12 +2656,12 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setA(input.readNumber<std::string>());
-      setB(input.readNumber<std::string>());
-      setDP1(input.readNumber<std::string>());
-      setF1(input.readNumber<std::string>());
-      setDP2(input.readNumber<std::string>());
-      setF2(input.readNumber<std::string>());
+      setA(input.readNumber<double>());
+      setB(input.readNumber<double>());
+      setDP1(input.readNumber<double>());
+      setF1(input.readNumber<double>());
+      setDP2(input.readNumber<double>());
+      setF2(input.readNumber<double>());
       setU_P1(input.read<int>());
       setU_F1(input.read<int>());
       setU_P2(input.read<int>());
@@ -2678,12 +2678,12 @@ namespace contam {
     }
 
     void QfrTest2Impl::readDetails(Reader& input) {
-      setA(input.readNumber<std::string>());
-      setB(input.readNumber<std::string>());
-      setDP1(input.readNumber<std::string>());
-      setF1(input.readNumber<std::string>());
-      setDP2(input.readNumber<std::string>());
-      setF2(input.readNumber<std::string>());
+      setA(input.readNumber<double>());
+      setB(input.readNumber<double>());
+      setDP1(input.readNumber<double>());
+      setF1(input.readNumber<double>());
+      setDP2(input.readNumber<double>());
+      setF2(input.readNumber<double>());
       setU_P1(input.read<int>());
       setU_F1(input.read<int>());
       setU_P2(input.read<int>());
@@ -2723,81 +2723,81 @@ namespace contam {
     }
 
     double QfrTest2Impl::a() const {
-      return openstudio::string_conversions::to<double>(m_a);
+      return m_a.value();
     }
 
     bool QfrTest2Impl::setA(const double a) {
-      m_a = openstudio::string_conversions::number(a);
+      m_a = PRJFLOAT(a);
       return true;
     }
 
     bool QfrTest2Impl::setA(const std::string& a) {
-      return assign_if_valid<double>(a, m_a);
+      return m_a.assign(a);
     }
 
     double QfrTest2Impl::b() const {
-      return openstudio::string_conversions::to<double>(m_b);
+      return m_b.value();
     }
 
     bool QfrTest2Impl::setB(const double b) {
-      m_b = openstudio::string_conversions::number(b);
+      m_b = PRJFLOAT(b);
       return true;
     }
 
     bool QfrTest2Impl::setB(const std::string& b) {
-      return assign_if_valid<double>(b, m_b);
+      return m_b.assign(b);
     }
 
     double QfrTest2Impl::dP1() const {
-      return openstudio::string_conversions::to<double>(m_dP1);
+      return m_dP1.value();
     }
 
     bool QfrTest2Impl::setDP1(const double dP1) {
-      m_dP1 = openstudio::string_conversions::number(dP1);
+      m_dP1 = PRJFLOAT(dP1);
       return true;
     }
 
     bool QfrTest2Impl::setDP1(const std::string& dP1) {
-      return assign_if_valid<double>(dP1, m_dP1);
+      return m_dP1.assign(dP1);
     }
 
     double QfrTest2Impl::F1() const {
-      return openstudio::string_conversions::to<double>(m_F1);
+      return m_F1.value();
     }
 
     bool QfrTest2Impl::setF1(const double F1) {
-      m_F1 = openstudio::string_conversions::number(F1);
+      m_F1 = PRJFLOAT(F1);
       return true;
     }
 
     bool QfrTest2Impl::setF1(const std::string& F1) {
-      return assign_if_valid<double>(F1, m_F1);
+      return m_F1.assign(F1);
     }
 
     double QfrTest2Impl::dP2() const {
-      return openstudio::string_conversions::to<double>(m_dP2);
+      return m_dP2.value();
     }
 
     bool QfrTest2Impl::setDP2(const double dP2) {
-      m_dP2 = openstudio::string_conversions::number(dP2);
+      m_dP2 = PRJFLOAT(dP2);
       return true;
     }
 
     bool QfrTest2Impl::setDP2(const std::string& dP2) {
-      return assign_if_valid<double>(dP2, m_dP2);
+      return m_dP2.assign(dP2);
     }
 
     double QfrTest2Impl::F2() const {
-      return openstudio::string_conversions::to<double>(m_F2);
+      return m_F2.value();
     }
 
     bool QfrTest2Impl::setF2(const double F2) {
-      m_F2 = openstudio::string_conversions::number(F2);
+      m_F2 = PRJFLOAT(F2);
       return true;
     }
 
     bool QfrTest2Impl::setF2(const std::string& F2) {
-      return assign_if_valid<double>(F2, m_F2);
+      return m_F2.assign(F2);
     }
 
     int QfrTest2Impl::u_P1() const {
@@ -2835,13 +2835,13 @@ namespace contam {
     void AfeDorImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
-      m_dTmin = PRJFLOAT("0.0");
-      m_ht = PRJFLOAT("0.0");
-      m_wd = PRJFLOAT("0.0");
-      m_cd = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
+      m_dTmin = PRJFLOAT(0.0);
+      m_ht = PRJFLOAT(0.0);
+      m_wd = PRJFLOAT(0.0);
+      m_cd = PRJFLOAT(0.0);
       m_u_T = 0;
       m_u_H = 0;
       m_u_W = 0;
@@ -2903,13 +2903,13 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setDTmin(input.readNumber<std::string>());
-      setHeight(input.readNumber<std::string>());
-      setWidth(input.readNumber<std::string>());
-      setCd(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setDTmin(input.readNumber<double>());
+      setHeight(input.readNumber<double>());
+      setWidth(input.readNumber<double>());
+      setCd(input.readNumber<double>());
       setU_T(input.read<int>());
       setU_H(input.read<int>());
       setU_W(input.read<int>());
@@ -2925,13 +2925,13 @@ namespace contam {
     }
 
     void AfeDorImpl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setDTmin(input.readNumber<std::string>());
-      setHeight(input.readNumber<std::string>());
-      setWidth(input.readNumber<std::string>());
-      setCd(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setDTmin(input.readNumber<double>());
+      setHeight(input.readNumber<double>());
+      setWidth(input.readNumber<double>());
+      setCd(input.readNumber<double>());
       setU_T(input.read<int>());
       setU_H(input.read<int>());
       setU_W(input.read<int>());
@@ -2970,94 +2970,94 @@ namespace contam {
     }
 
     double AfeDorImpl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool AfeDorImpl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool AfeDorImpl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double AfeDorImpl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool AfeDorImpl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool AfeDorImpl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double AfeDorImpl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool AfeDorImpl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool AfeDorImpl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     double AfeDorImpl::dTmin() const {
-      return openstudio::string_conversions::to<double>(m_dTmin);
+      return m_dTmin.value();
     }
 
     bool AfeDorImpl::setDTmin(const double dTmin) {
-      m_dTmin = openstudio::string_conversions::number(dTmin);
+      m_dTmin = PRJFLOAT(dTmin);
       return true;
     }
 
     bool AfeDorImpl::setDTmin(const std::string& dTmin) {
-      return assign_if_valid<double>(dTmin, m_dTmin);
+      return m_dTmin.assign(dTmin);
     }
 
     double AfeDorImpl::height() const {
-      return openstudio::string_conversions::to<double>(m_ht);
+      return m_ht.value();
     }
 
     bool AfeDorImpl::setHeight(const double ht) {
-      m_ht = openstudio::string_conversions::number(ht);
+      m_ht = PRJFLOAT(ht);
       return true;
     }
 
     bool AfeDorImpl::setHeight(const std::string& ht) {
-      return assign_if_valid<double>(ht, m_ht);
+      return m_ht.assign(ht);
     }
 
     double AfeDorImpl::width() const {
-      return openstudio::string_conversions::to<double>(m_wd);
+      return m_wd.value();
     }
 
     bool AfeDorImpl::setWidth(const double wd) {
-      m_wd = openstudio::string_conversions::number(wd);
+      m_wd = PRJFLOAT(wd);
       return true;
     }
 
     bool AfeDorImpl::setWidth(const std::string& wd) {
-      return assign_if_valid<double>(wd, m_wd);
+      return m_wd.assign(wd);
     }
 
     double AfeDorImpl::cd() const {
-      return openstudio::string_conversions::to<double>(m_cd);
+      return m_cd.value();
     }
 
     bool AfeDorImpl::setCd(const double cd) {
-      m_cd = openstudio::string_conversions::number(cd);
+      m_cd = PRJFLOAT(cd);
       return true;
     }
 
     bool AfeDorImpl::setCd(const std::string& cd) {
-      return assign_if_valid<double>(cd, m_cd);
+      return m_cd.assign(cd);
     }
 
     int AfeDorImpl::u_T() const {
@@ -3087,13 +3087,13 @@ namespace contam {
     void DrPl2Impl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
-      m_dH = PRJFLOAT("0.0");
-      m_ht = PRJFLOAT("0.0");
-      m_wd = PRJFLOAT("0.0");
-      m_cd = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
+      m_dH = PRJFLOAT(0.0);
+      m_ht = PRJFLOAT(0.0);
+      m_wd = PRJFLOAT(0.0);
+      m_cd = PRJFLOAT(0.0);
       m_u_H = 0;
       m_u_W = 0;
     }
@@ -3152,13 +3152,13 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setDH(input.readNumber<std::string>());
-      setHeight(input.readNumber<std::string>());
-      setWidth(input.readNumber<std::string>());
-      setCd(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setDH(input.readNumber<double>());
+      setHeight(input.readNumber<double>());
+      setWidth(input.readNumber<double>());
+      setCd(input.readNumber<double>());
       setU_H(input.read<int>());
       setU_W(input.read<int>());
     }
@@ -3173,13 +3173,13 @@ namespace contam {
     }
 
     void DrPl2Impl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setDH(input.readNumber<std::string>());
-      setHeight(input.readNumber<std::string>());
-      setWidth(input.readNumber<std::string>());
-      setCd(input.readNumber<std::string>());
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setDH(input.readNumber<double>());
+      setHeight(input.readNumber<double>());
+      setWidth(input.readNumber<double>());
+      setCd(input.readNumber<double>());
       setU_H(input.read<int>());
       setU_W(input.read<int>());
     }
@@ -3217,94 +3217,94 @@ namespace contam {
     }
 
     double DrPl2Impl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool DrPl2Impl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool DrPl2Impl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double DrPl2Impl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool DrPl2Impl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool DrPl2Impl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double DrPl2Impl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool DrPl2Impl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool DrPl2Impl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     double DrPl2Impl::dH() const {
-      return openstudio::string_conversions::to<double>(m_dH);
+      return m_dH.value();
     }
 
     bool DrPl2Impl::setDH(const double dH) {
-      m_dH = openstudio::string_conversions::number(dH);
+      m_dH = PRJFLOAT(dH);
       return true;
     }
 
     bool DrPl2Impl::setDH(const std::string& dH) {
-      return assign_if_valid<double>(dH, m_dH);
+      return m_dH.assign(dH);
     }
 
     double DrPl2Impl::height() const {
-      return openstudio::string_conversions::to<double>(m_ht);
+      return m_ht.value();
     }
 
     bool DrPl2Impl::setHeight(const double ht) {
-      m_ht = openstudio::string_conversions::number(ht);
+      m_ht = PRJFLOAT(ht);
       return true;
     }
 
     bool DrPl2Impl::setHeight(const std::string& ht) {
-      return assign_if_valid<double>(ht, m_ht);
+      return m_ht.assign(ht);
     }
 
     double DrPl2Impl::width() const {
-      return openstudio::string_conversions::to<double>(m_wd);
+      return m_wd.value();
     }
 
     bool DrPl2Impl::setWidth(const double wd) {
-      m_wd = openstudio::string_conversions::number(wd);
+      m_wd = PRJFLOAT(wd);
       return true;
     }
 
     bool DrPl2Impl::setWidth(const std::string& wd) {
-      return assign_if_valid<double>(wd, m_wd);
+      return m_wd.assign(wd);
     }
 
     double DrPl2Impl::cd() const {
-      return openstudio::string_conversions::to<double>(m_cd);
+      return m_cd.value();
     }
 
     bool DrPl2Impl::setCd(const double cd) {
-      m_cd = openstudio::string_conversions::number(cd);
+      m_cd = PRJFLOAT(cd);
       return true;
     }
 
     bool DrPl2Impl::setCd(const std::string& cd) {
-      return assign_if_valid<double>(cd, m_cd);
+      return m_cd.assign(cd);
     }
 
     int DrPl2Impl::u_H() const {
@@ -3326,7 +3326,7 @@ namespace contam {
     void AfeFlowImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_Flow = PRJFLOAT("0.0");
+      m_Flow = PRJFLOAT(0.0);
       m_u_F = 0;
     }
 
@@ -3368,7 +3368,7 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setFlow(input.readNumber<std::string>());
+      setFlow(input.readNumber<double>());
       setU_F(input.read<int>());
     }
 
@@ -3381,7 +3381,7 @@ namespace contam {
     }
 
     void AfeFlowImpl::readDetails(Reader& input) {
-      setFlow(input.readNumber<std::string>());
+      setFlow(input.readNumber<double>());
       setU_F(input.read<int>());
     }
 
@@ -3418,16 +3418,16 @@ namespace contam {
     }
 
     double AfeFlowImpl::Flow() const {
-      return openstudio::string_conversions::to<double>(m_Flow);
+      return m_Flow.value();
     }
 
     bool AfeFlowImpl::setFlow(const double Flow) {
-      m_Flow = openstudio::string_conversions::number(Flow);
+      m_Flow = PRJFLOAT(Flow);
       return true;
     }
 
     bool AfeFlowImpl::setFlow(const std::string& Flow) {
-      return assign_if_valid<double>(Flow, m_Flow);
+      return m_Flow.assign(Flow);
     }
 
     int AfeFlowImpl::u_F() const {
@@ -3441,14 +3441,14 @@ namespace contam {
     void AfeFanImpl::setDefaults() {
       m_nr = 0;
       m_icon = 0;
-      m_lam = PRJFLOAT("0.0");
-      m_turb = PRJFLOAT("0.0");
-      m_expt = PRJFLOAT("0.0");
-      m_rdens = PRJFLOAT("0.0");
-      m_fdf = PRJFLOAT("0.0");
-      m_sop = PRJFLOAT("0.0");
-      m_off = PRJFLOAT("0.0");
-      m_Sarea = PRJFLOAT("0.0");
+      m_lam = PRJFLOAT(0.0);
+      m_turb = PRJFLOAT(0.0);
+      m_expt = PRJFLOAT(0.0);
+      m_rdens = PRJFLOAT(0.0);
+      m_fdf = PRJFLOAT(0.0);
+      m_sop = PRJFLOAT(0.0);
+      m_off = PRJFLOAT(0.0);
+      m_Sarea = PRJFLOAT(0.0);
       m_u_Sa = 0;
     }
 
@@ -3511,20 +3511,20 @@ namespace contam {
       std::string dataType = input.readString();  // Should really check this
       setName(input.readString());
       setDesc(input.readLine());
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setRdens(input.readNumber<std::string>());
-      setFdf(input.readNumber<std::string>());
-      setSop(input.readNumber<std::string>());
-      setOff(input.readNumber<std::string>());
-      std::vector<std::string> fpc;
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setRdens(input.readNumber<double>());
+      setFdf(input.readNumber<double>());
+      setSop(input.readNumber<double>());
+      setOff(input.readNumber<double>());
+      std::vector<double> fpc;
       for (int i = 0; i < 4; i++) {
-        fpc.push_back(input.read<std::string>());
+        fpc.push_back(input.read<double>());
       }
       setFpc(fpc);
       int npts = input.read<int>();
-      setSarea(input.readNumber<std::string>());
+      setSarea(input.readNumber<double>());
       setU_Sa(input.read<int>());
       std::vector<FanDataPoint> data;
       for (int i = 0; i < npts; i++) {
@@ -3553,20 +3553,20 @@ namespace contam {
     }
 
     void AfeFanImpl::readDetails(Reader& input) {
-      setLam(input.readNumber<std::string>());
-      setTurb(input.readNumber<std::string>());
-      setExpt(input.readNumber<std::string>());
-      setRdens(input.readNumber<std::string>());
-      setFdf(input.readNumber<std::string>());
-      setSop(input.readNumber<std::string>());
-      setOff(input.readNumber<std::string>());
-      std::vector<std::string> fpc;
+      setLam(input.readNumber<double>());
+      setTurb(input.readNumber<double>());
+      setExpt(input.readNumber<double>());
+      setRdens(input.readNumber<double>());
+      setFdf(input.readNumber<double>());
+      setSop(input.readNumber<double>());
+      setOff(input.readNumber<double>());
+      std::vector<double> fpc;
       for (int i = 0; i < 4; i++) {
-        fpc.push_back(input.read<std::string>());
+        fpc.push_back(input.read<double>());
       }
       setFpc(fpc);
       int npts = input.read<int>();
-      setSarea(input.readNumber<std::string>());
+      setSarea(input.readNumber<double>());
       setU_Sa(input.read<int>());
       std::vector<FanDataPoint> data;
       for (int i = 0; i < npts; i++) {
@@ -3610,131 +3610,136 @@ namespace contam {
     }
 
     double AfeFanImpl::lam() const {
-      return openstudio::string_conversions::to<double>(m_lam);
+      return m_lam.value();
     }
 
     bool AfeFanImpl::setLam(const double lam) {
-      m_lam = openstudio::string_conversions::number(lam);
+      m_lam = PRJFLOAT(lam);
       return true;
     }
 
     bool AfeFanImpl::setLam(const std::string& lam) {
-      return assign_if_valid<double>(lam, m_lam);
+      return m_lam.assign(lam);
     }
 
     double AfeFanImpl::turb() const {
-      return openstudio::string_conversions::to<double>(m_turb);
+      return m_turb.value();
     }
 
     bool AfeFanImpl::setTurb(const double turb) {
-      m_turb = openstudio::string_conversions::number(turb);
+      m_turb = PRJFLOAT(turb);
       return true;
     }
 
     bool AfeFanImpl::setTurb(const std::string& turb) {
-      return assign_if_valid<double>(turb, m_turb);
+      return m_turb.assign(turb);
     }
 
     double AfeFanImpl::expt() const {
-      return openstudio::string_conversions::to<double>(m_expt);
+      return m_expt.value();
     }
 
     bool AfeFanImpl::setExpt(const double expt) {
-      m_expt = openstudio::string_conversions::number(expt);
+      m_expt = PRJFLOAT(expt);
       return true;
     }
 
     bool AfeFanImpl::setExpt(const std::string& expt) {
-      return assign_if_valid<double>(expt, m_expt);
+      return m_expt.assign(expt);
     }
 
     double AfeFanImpl::rdens() const {
-      return openstudio::string_conversions::to<double>(m_rdens);
+      return m_rdens.value();
     }
 
     bool AfeFanImpl::setRdens(const double rdens) {
-      m_rdens = openstudio::string_conversions::number(rdens);
+      m_rdens = PRJFLOAT(rdens);
       return true;
     }
 
     bool AfeFanImpl::setRdens(const std::string& rdens) {
-      return assign_if_valid<double>(rdens, m_rdens);
+      return m_rdens.assign(rdens);
     }
 
     double AfeFanImpl::fdf() const {
-      return openstudio::string_conversions::to<double>(m_fdf);
+      return m_fdf.value();
     }
 
     bool AfeFanImpl::setFdf(const double fdf) {
-      m_fdf = openstudio::string_conversions::number(fdf);
+      m_fdf = PRJFLOAT(fdf);
       return true;
     }
 
     bool AfeFanImpl::setFdf(const std::string& fdf) {
-      return assign_if_valid<double>(fdf, m_fdf);
+      return m_fdf.assign(fdf);
     }
 
     double AfeFanImpl::sop() const {
-      return openstudio::string_conversions::to<double>(m_sop);
+      return m_sop.value();
     }
 
     bool AfeFanImpl::setSop(const double sop) {
-      m_sop = openstudio::string_conversions::number(sop);
+      m_sop = PRJFLOAT(sop);
       return true;
     }
 
     bool AfeFanImpl::setSop(const std::string& sop) {
-      return assign_if_valid<double>(sop, m_sop);
+      return m_sop.assign(sop);
     }
 
     double AfeFanImpl::off() const {
-      return openstudio::string_conversions::to<double>(m_off);
+      return m_off.value();
     }
 
     bool AfeFanImpl::setOff(const double off) {
-      m_off = openstudio::string_conversions::number(off);
+      m_off = PRJFLOAT(off);
       return true;
     }
 
     bool AfeFanImpl::setOff(const std::string& off) {
-      return assign_if_valid<double>(off, m_off);
+      return m_off.assign(off);
     }
 
     std::vector<double> AfeFanImpl::fpc() const {
       std::vector<double> out;
       for (int i = 0; i < 4; i++) {
-        out.push_back(openstudio::string_conversions::to<double>(m_fpc[i]));
+        out.push_back(m_fpc[i].value());
       }
       return out;
     }
 
     bool AfeFanImpl::setFpc(const std::vector<double>& fpc) {
+      m_fpc.clear();
       for (int i = 0; i < 4; i++) {
-        m_fpc.push_back(openstudio::string_conversions::number(fpc[i]));
+        m_fpc.push_back(PRJFLOAT(fpc[i]));
       }
       return true;
     }
 
     bool AfeFanImpl::setFpc(const std::vector<std::string>& fpc) {
-      if (std::all_of(fpc.begin(), fpc.end(), is_valid<double, std::string>)) {
-        m_fpc = fpc;
-        return true;
-      } else {
-        return false;
+      std::vector<PRJFLOAT> values;
+      for (const auto& input : fpc) {
+        auto value = PRJFLOAT::parse(input);
+        if (!value) {
+          return false;
+        }
+        values.push_back(value.get());
       }
+      m_fpc = values;
+      return true;
     }
 
     double AfeFanImpl::Sarea() const {
-      return openstudio::string_conversions::to<double>(m_Sarea);
+      return m_Sarea.value();
     }
 
     bool AfeFanImpl::setSarea(const double Sarea) {
-      m_Sarea = openstudio::string_conversions::number(Sarea);
+      m_Sarea = PRJFLOAT(Sarea);
       return true;
     }
 
     bool AfeFanImpl::setSarea(const std::string& Sarea) {
-      return assign_if_valid<double>(Sarea, m_Sarea);
+      return m_Sarea.assign(Sarea);
     }
 
     int AfeFanImpl::u_Sa() const {
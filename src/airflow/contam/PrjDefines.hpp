@@ -30,13 +30,85 @@
 #ifndef AIRFLOW_CONTAM_PRJDEFINES_HPP
 #define AIRFLOW_CONTAM_PRJDEFINES_HPP
 
+#include "../../utilities/core/StringHelpers.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <type_traits>
+#include <typeinfo>
 
-using PRJFLOAT = std::string;
+#include <boost/optional.hpp>
+#include <fmt/format.h>
 
 namespace openstudio::contam {
 
+/** PrjFloat holds a CONTAM real (R4) field as a number. Values are written with the shortest representation that parses back
+ *  to the same double, so reading and writing a PRJ file does not lose any precision. */
+class PrjFloat
+{
+ public:
+  PrjFloat() = default;
+  explicit PrjFloat(double value) : m_value(value) {}
+  /** Parses text, throws std::bad_cast if it is not a finite number */
+  explicit PrjFloat(std::string_view text) {
+    auto result = parse(text);
+    if (!result) {
+      throw std::bad_cast();
+    }
+    m_value = result->m_value;
+  }
+
+  double value() const {
+    return m_value;
+  }
+
+  /** Sets the value from text, returns false and leaves the value unchanged if the text is not a finite number */
+  bool assign(std::string_view text) {
+    auto result = parse(text);
+    if (!result) {
+      return false;
+    }
+    m_value = result->m_value;
+    return true;
+  }
+
+  /** Parses a number without allocating, the whole of the text must be consumed */
+  static boost::optional<PrjFloat> parse(std::string_view text) {
+    double value = 0.0;
+    const char* last = text.data() + text.size();
+    const char* ptr = openstudio::string_conversions::parseDouble(text.data(), last, value);
+    if (ptr != last || !std::isfinite(value)) {
+      return boost::none;
+    }
+    return PrjFloat(value);
+  }
+
+  /** Writes the shortest round-trip representation to [first, last), returns one past the last character written */
+  char* toChars(char* first, char* last) const {
+    return fmt::format_to_n(first, static_cast<std::size_t>(last - first), "{}", m_value).out;
+  }
+
+  std::string toString() const {
+    std::array<char, 32> buffer;
+    return std::string(buffer.data(), toChars(buffer.data(), buffer.data() + buffer.size()));
+  }
+
+  bool operator==(const PrjFloat& other) const {
+    return m_value == other.m_value;
+  }
+
+  bool operator!=(const PrjFloat& other) const {
+    return m_value != other.m_value;
+  }
+
+ private:
+  double m_value = 0.0;
+};
+
 template <typename DesiredType, typename InputType>
 DesiredType to(const InputType& inp) {
   std::stringstream ss;
@@ -72,7 +144,32 @@ bool assign_if_valid(const InputType& input, DestinationType& dest) {
 
 }  // namespace openstudio::contam
 
-#define ANY_TO_STR openstudio::toString
+using PRJFLOAT = openstudio::contam::PrjFloat;
+
+namespace openstudio::contam {
+
+/** Converts a PRJ field to text for writing, integers and reals are formatted directly rather than through a stream */
+inline std::string toPrjString(const PrjFloat& value) {
+  return value.toString();
+}
+
+inline std::string toPrjString(double value) {
+  return PrjFloat(value).toString();
+}
+
+template <typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+std::string toPrjString(T value) {
+  std::array<char, 24> buffer;
+  return std::string(buffer.data(), std::to_chars(buffer.data(), buffer.data() + buffer.size(), value).ptr);
+}
+
+inline std::string toPrjString(const std::string& value) {
+  return value;
+}
+
+}  // namespace openstudio::contam
+
+#define ANY_TO_STR openstudio::contam::toPrjString
 
 // CONTAM icon definitions
 #define FLOW_E 1      /* flow arrow - pointing east */
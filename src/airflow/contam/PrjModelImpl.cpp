@@ -45,34 +45,34 @@ namespace contam {
       m_skwidth = 0;
       m_def_units = 0;
       m_def_flows = 0;
-      m_def_T = PRJFLOAT("0.0");
+      m_def_T = PRJFLOAT(0.0);
       m_udefT = 0;
-      m_rel_N = PRJFLOAT("0.0");
-      m_wind_H = PRJFLOAT("0.0");
+      m_rel_N = PRJFLOAT(0.0);
+      m_wind_H = PRJFLOAT(0.0);
       m_uwH = 0;
-      m_wind_Ao = PRJFLOAT("0.0");
-      m_wind_a = PRJFLOAT("0.0");
-      m_scale = PRJFLOAT("0.0");
+      m_wind_Ao = PRJFLOAT(0.0);
+      m_wind_a = PRJFLOAT(0.0);
+      m_scale = PRJFLOAT(0.0);
       m_uScale = 0;
       m_orgRow = 0;
       m_orgCol = 0;
       m_invYaxis = 0;
       m_showGeom = 0;
-      m_X0 = PRJFLOAT("0.0");
-      m_Y0 = PRJFLOAT("0.0");
-      m_Z0 = PRJFLOAT("0.0");
-      m_angle = PRJFLOAT("0.0");
+      m_X0 = PRJFLOAT(0.0);
+      m_Y0 = PRJFLOAT(0.0);
+      m_Z0 = PRJFLOAT(0.0);
+      m_angle = PRJFLOAT(0.0);
       m_u_XYZ = 0;
-      m_epsPath = PRJFLOAT("0.0");
-      m_epsSpcs = PRJFLOAT("0.0");
+      m_epsPath = PRJFLOAT(0.0);
+      m_epsSpcs = PRJFLOAT(0.0);
       m_useWPCwp = 0;
       m_useWPCmf = 0;
       m_wpctrig = 0;
-      m_latd = PRJFLOAT("0.0");
-      m_lgtd = PRJFLOAT("0.0");
-      m_Tznr = PRJFLOAT("0.0");
-      m_altd = PRJFLOAT("0.0");
-      m_Tgrnd = PRJFLOAT("0.0");
+      m_latd = PRJFLOAT(0.0);
+      m_lgtd = PRJFLOAT(0.0);
+      m_Tznr = PRJFLOAT(0.0);
+      m_altd = PRJFLOAT(0.0);
+      m_Tgrnd = PRJFLOAT(0.0);
       m_utg = 0;
       m_u_a = 0;
     }
@@ -123,14 +123,14 @@ namespace contam {
       setSkwidth(input.read<int>());
       setDef_units(input.read<int>());
       setDef_flows(input.read<int>());
-      setDef_T(input.readNumber<std::string>());
+      setDef_T(input.readNumber<double>());
       setUdefT(input.read<int>());
-      setRel_N(input.readNumber<std::string>());
-      setWind_H(input.readNumber<std::string>());
+      setRel_N(input.readNumber<double>());
+      setWind_H(input.readNumber<double>());
       setUwH(input.read<int>());
-      setWind_Ao(input.readNumber<std::string>());
-      setWind_a(input.readNumber<std::string>());
-      setScale(input.readNumber<std::string>());
+      setWind_Ao(input.readNumber<double>());
+      setWind_a(input.readNumber<double>());
+      setScale(input.readNumber<double>());
       setUScale(input.read<int>());
       setOrgRow(input.read<int>());
       setOrgCol(input.read<int>());
@@ -145,24 +145,24 @@ namespace contam {
       m_WPCfile = input.readLine();
       m_EWCfile = input.readLine();
       m_WPCdesc = input.readLine();
-      setX0(input.readNumber<std::string>());
-      setY0(input.readNumber<std::string>());
-      setZ0(input.readNumber<std::string>());
-      setAngle(input.readNumber<std::string>());
+      setX0(input.readNumber<double>());
+      setY0(input.readNumber<double>());
+      setZ0(input.readNumber<double>());
+      setAngle(input.readNumber<double>());
       setU_XYZ(input.read<int>());
-      setEpsPath(input.readNumber<std::string>());
-      setEpsSpcs(input.readNumber<std::string>());
+      setEpsPath(input.readNumber<double>());
+      setEpsSpcs(input.readNumber<double>());
       setTShift(input.readString());
       setDStart(input.readString());
       setDEnd(input.readString());
       setUseWPCwp(input.read<int>());
       setUseWPCmf(input.read<int>());
       setWpctrig(input.read<int>());
-      setLatd(input.readNumber<std::string>());
-      setLgtd(input.readNumber<std::string>());
-      setTznr(input.readNumber<std::string>());
-      setAltd(input.readNumber<std::string>());
-      setTgrnd(input.readNumber<std::string>());
+      setLatd(input.readNumber<double>());
+      setLgtd(input.readNumber<double>());
+      setTznr(input.readNumber<double>());
+      setAltd(input.readNumber<double>());
+      setTgrnd(input.readNumber<double>());
       setUtg(input.read<int>());
       setU_a(input.read<int>());
       m_rc.read(input);  // Read the run control section
@@ -242,6 +242,11 @@ namespace contam {
       if (!m_valid) {
         return output;
       }
+      // Everything is appended to a single buffer, so size it for the model up front
+      output.reserve(16384
+                     + 256
+                         * (m_species.size() + m_levels.size() + m_daySchedules.size() + m_weekSchedules.size() + m_windPressureProfiles.size()
+                            + m_airflowElements.size() + m_controlNodes.size() + m_ahs.size() + 2 * m_zones.size() + m_paths.size()));
       // Section 1: Project, Weather, Simulation, and Output Controls
       output += m_programName + ' ' + m_programVersion + ' ' + ANY_TO_STR(m_echo) + '\n';
       output += m_desc + '\n';
@@ -267,16 +272,16 @@ namespace contam {
       output += m_rc.write();
       output += "-999\n";
       // Section 2: Species and Contaminants
-      output += writeArray(contaminants(), "contaminants:");
-      output += writeSectionVector(m_species, "species:");
+      writeArray(output, contaminants(), "contaminants:");
+      writeSectionVector(output, m_species, "species:");
       // Section 3: Level and Icon Data
-      output += writeSectionVector(m_levels, "levels:");
+      writeSectionVector(output, m_levels, "levels:");
       // Section 4: Day Schedules
-      output += writeSectionVector(m_daySchedules, "day-schedules:");
+      writeSectionVector(output, m_daySchedules, "day-schedules:");
       // Section 5: Week Schedules
-      output += writeSectionVector(m_weekSchedules, "week-schedules:");
+      writeSectionVector(output, m_weekSchedules, "week-schedules:");
       // Section 6: Wind Pressure Profiles
-      output += writeSectionVector(m_windPressureProfiles, "wind pressure profiles:");
+      writeSectionVector(output, m_windPressureProfiles, "wind pressure profiles:");
       // Section 7: Kinetic Reactions
       output += m_unsupported["KineticReaction"];
       // Section 8a: Filter Elements
@@ -286,22 +291,22 @@ namespace contam {
       // Section 9: Source/Sink Elements
       output += m_unsupported["SourceSink"];
       // Section 10: Airflow Elements
-      output += writeSectionVector(m_airflowElements, "flow elements:");
+      writeSectionVector(output, m_airflowElements, "flow elements:");
       // Section 11: Duct Elements
       output += m_unsupported["DuctElement"];
       // Section 12a: Control Super Elements
       output += m_unsupported["ControlSuperElements"];
       // Section 12b: Control Nodes
       //output += m_unsupported["ControlNode"];
-      output += writeSectionVector(m_controlNodes, "control nodes:");
+      writeSectionVector(output, m_controlNodes, "control nodes:");
       // Section 13: Simple Air Handling System (AHS)
-      output += writeSectionVector(m_ahs, "simple AHS:");
+      writeSectionVector(output, m_ahs, "simple AHS:");
       // Section 14: Zones
-      output += writeSectionVector(m_zones, "zones:");
+      writeSectionVector(output, m_zones, "zones:");
       // Section 15: Initial Zone Concentrations
-      output += writeZoneIc();
+      writeZoneIc(output);
       // Section 16: Airflow Paths
-      output += writeSectionVector(m_paths, "flow paths:");
+      writeSectionVector(output, m_paths, "flow paths:");
       // Section 17: Duct Junctions
       output += m_unsupported["DuctJunction"];
       // Section 18: Initial Junction Concentrations
@@ -386,16 +391,16 @@ namespace contam {
     }
 
     double IndexModelImpl::def_T() const {
-      return openstudio::string_conversions::to<double>(m_def_T);
+      return m_def_T.value();
     }
 
     bool IndexModelImpl::setDef_T(const double def_T) {
-      m_def_T = openstudio::string_conversions::number(def_T);
+      m_def_T = PRJFLOAT(def_T);
       return true;
     }
 
     bool IndexModelImpl::setDef_T(const std::string& def_T) {
-      return assign_if_valid<double>(def_T, m_def_T);
+      return m_def_T.assign(def_T);
     }
 
     int IndexModelImpl::udefT() const {
@@ -407,29 +412,29 @@ namespace contam {
     }
 
     double IndexModelImpl::rel_N() const {
-      return openstudio::string_conversions::to<double>(m_rel_N);
+      return m_rel_N.value();
     }
 
     bool IndexModelImpl::setRel_N(const double rel_N) {
-      m_rel_N = openstudio::string_conversions::number(rel_N);
+      m_rel_N = PRJFLOAT(rel_N);
       return true;
     }
 
     bool IndexModelImpl::setRel_N(const std::string& rel_N) {
-      return assign_if_valid<double>(rel_N, m_rel_N);
+      return m_rel_N.assign(rel_N);
     }
 
     double IndexModelImpl::wind_H() const {
-      return openstudio::string_conversions::to<double>(m_wind_H);
+      return m_wind_H.value();
     }
 
     bool IndexModelImpl::setWind_H(const double wind_H) {
-      m_wind_H = openstudio::string_conversions::number(wind_H);
+      m_wind_H = PRJFLOAT(wind_H);
       return true;
     }
 
     bool IndexModelImpl::setWind_H(const std::string& wind_H) {
-      return assign_if_valid<double>(wind_H, m_wind_H);
+      return m_wind_H.assign(wind_H);
     }
 
     int IndexModelImpl::uwH() const {
@@ -441,42 +446,42 @@ namespace contam {
     }
 
     double IndexModelImpl::wind_Ao() const {
-      return openstudio::string_conversions::to<double>(m_wind_Ao);
+      return m_wind_Ao.value();
     }
 
     bool IndexModelImpl::setWind_Ao(const double wind_Ao) {
-      m_wind_Ao = openstudio::string_conversions::number(wind_Ao);
+      m_wind_Ao = PRJFLOAT(wind_Ao);
       return true;
     }
 
     bool IndexModelImpl::setWind_Ao(const std::string& wind_Ao) {
-      return assign_if_valid<double>(wind_Ao, m_wind_Ao);
+      return m_wind_Ao.assign(wind_Ao);
     }
 
     double IndexModelImpl::wind_a() const {
-      return openstudio::string_conversions::to<double>(m_wind_a);
+      return m_wind_a.value();
     }
 
     bool IndexModelImpl::setWind_a(const double wind_a) {
-      m_wind_a = openstudio::string_conversions::number(wind_a);
+      m_wind_a = PRJFLOAT(wind_a);
       return true;
     }
 
     bool IndexModelImpl::setWind_a(const std::string& wind_a) {
-      return assign_if_valid<double>(wind_a, m_wind_a);
+      return m_wind_a.assign(wind_a);
     }
 
     double IndexModelImpl::scale() const {
-      return openstudio::string_conversions::to<double>(m_scale);
+      return m_scale.value();
     }
 
     bool IndexModelImpl::setScale(const double scale) {
-      m_scale = openstudio::string_conversions::number(scale);
+      m_scale = PRJFLOAT(scale);
       return true;
     }
 
     bool IndexModelImpl::setScale(const std::string& scale) {
-      return assign_if_valid<double>(scale, m_scale);
+      return m_scale.assign(scale);
     }
 
     int IndexModelImpl::uScale() const {
@@ -592,55 +597,55 @@ namespace contam {
     }
 
     double IndexModelImpl::X0() const {
-      return openstudio::string_conversions::to<double>(m_X0);
+      return m_X0.value();
     }
 
     bool IndexModelImpl::setX0(const double X0) {
-      m_X0 = openstudio::string_conversions::number(X0);
+      m_X0 = PRJFLOAT(X0);
       return true;
     }
 
     bool IndexModelImpl::setX0(const std::string& X0) {
-      return assign_if_valid<double>(X0, m_X0);
+      return m_X0.assign(X0);
     }
 
     double IndexModelImpl::Y0() const {
-      return openstudio::string_conversions::to<double>(m_Y0);
+      return m_Y0.value();
     }
 
     bool IndexModelImpl::setY0(const double Y0) {
-      m_Y0 = openstudio::string_conversions::number(Y0);
+      m_Y0 = PRJFLOAT(Y0);
       return true;
     }
 
     bool IndexModelImpl::setY0(const std::string& Y0) {
-      return assign_if_valid<double>(Y0, m_Y0);
+      return m_Y0.assign(Y0);
     }
 
     double IndexModelImpl::Z0() const {
-      return openstudio::string_conversions::to<double>(m_Z0);
+      return m_Z0.value();
     }
 
     bool IndexModelImpl::setZ0(const double Z0) {
-      m_Z0 = openstudio::string_conversions::number(Z0);
+      m_Z0 = PRJFLOAT(Z0);
       return true;
     }
 
     bool IndexModelImpl::setZ0(const std::string& Z0) {
-      return assign_if_valid<double>(Z0, m_Z0);
+      return m_Z0.assign(Z0);
     }
 
     double IndexModelImpl::angle() const {
-      return openstudio::string_conversions::to<double>(m_angle);
+      return m_angle.value();
     }
 
     bool IndexModelImpl::setAngle(const double angle) {
-      m_angle = openstudio::string_conversions::number(angle);
+      m_angle = PRJFLOAT(angle);
       return true;
     }
 
     bool IndexModelImpl::setAngle(const std::string& angle) {
-      return assign_if_valid<double>(angle, m_angle);
+      return m_angle.assign(angle);
     }
 
     int IndexModelImpl::u_XYZ() const {
@@ -652,29 +657,29 @@ namespace contam {
     }
 
     double IndexModelImpl::epsPath() const {
-      return openstudio::string_conversions::to<double>(m_epsPath);
+      return m_epsPath.value();
     }
 
     bool IndexModelImpl::setEpsPath(const double epsPath) {
-      m_epsPath = openstudio::string_conversions::number(epsPath);
+      m_epsPath = PRJFLOAT(epsPath);
       return true;
     }
 
     bool IndexModelImpl::setEpsPath(const std::string& epsPath) {
-      return assign_if_valid<double>(epsPath, m_epsPath);
+      return m_epsPath.assign(epsPath);
     }
 
     double IndexModelImpl::epsSpcs() const {
-      return openstudio::string_conversions::to<double>(m_epsSpcs);
+      return m_epsSpcs.value();
     }
 
     bool IndexModelImpl::setEpsSpcs(const double epsSpcs) {
-      m_epsSpcs = openstudio::string_conversions::number(epsSpcs);
+      m_epsSpcs = PRJFLOAT(epsSpcs);
       return true;
     }
 
     bool IndexModelImpl::setEpsSpcs(const std::string& epsSpcs) {
-      return assign_if_valid<double>(epsSpcs, m_epsSpcs);
+      return m_epsSpcs.assign(epsSpcs);
     }
 
     std::string IndexModelImpl::tShift() const {
@@ -726,68 +731,68 @@ namespace contam {
     }
 
     double IndexModelImpl::latd() const {
-      return openstudio::string_conversions::to<double>(m_latd);
+      return m_latd.value();
     }
 
     bool IndexModelImpl::setLatd(const double latd) {
-      m_latd = openstudio::string_conversions::number(latd);
+      m_latd = PRJFLOAT(latd);
       return true;
     }
 
     bool IndexModelImpl::setLatd(const std::string& latd) {
-      return assign_if_valid<double>(latd, m_latd);
+      return m_latd.assign(latd);
     }
 
     double IndexModelImpl::lgtd() const {
-      return openstudio::string_conversions::to<double>(m_lgtd);
+      return m_lgtd.value();
     }
 
     bool IndexModelImpl::setLgtd(const double lgtd) {
-      m_lgtd = openstudio::string_conversions::number(lgtd);
+      m_lgtd = PRJFLOAT(lgtd);
       return true;
     }
 
     bool IndexModelImpl::setLgtd(const std::string& lgtd) {
-      return assign_if_valid<double>(lgtd, m_lgtd);
+      return m_lgtd.assign(lgtd);
     }
 
     double IndexModelImpl::Tznr() const {
-      return openstudio::string_conversions::to<double>(m_Tznr);
+      return m_Tznr.value();
     }
 
     bool IndexModelImpl::setTznr(const double Tznr) {
-      m_Tznr = openstudio::string_conversions::number(Tznr);
+      m_Tznr = PRJFLOAT(Tznr);
       return true;
     }
 
     bool IndexModelImpl::setTznr(const std::string& Tznr) {
-      return assign_if_valid<double>(Tznr, m_Tznr);
+      return m_Tznr.assign(Tznr);
     }
 
     double IndexModelImpl::altd() const {
-      return openstudio::string_conversions::to<double>(m_altd);
+      return m_altd.value();
     }
 
     bool IndexModelImpl::setAltd(const double altd) {
-      m_altd = openstudio::string_conversions::number(altd);
+      m_altd = PRJFLOAT(altd);
       return true;
     }
 
     bool IndexModelImpl::setAltd(const std::string& altd) {
-      return assign_if_valid<double>(altd, m_altd);
+      return m_altd.assign(altd);
     }
 
     double IndexModelImpl::Tgrnd() const {
-      return openstudio::string_conversions::to<double>(m_Tgrnd);
+      return m_Tgrnd.value();
     }
 
     bool IndexModelImpl::setTgrnd(const double Tgrnd) {
-      m_Tgrnd = openstudio::string_conversions::number(Tgrnd);
+      m_Tgrnd = PRJFLOAT(Tgrnd);
       return true;
     }
 
     bool IndexModelImpl::setTgrnd(const std::string& Tgrnd) {
-      return assign_if_valid<double>(Tgrnd, m_Tgrnd);
+      return m_Tgrnd.assign(Tgrnd);
     }
 
     int IndexModelImpl::utg() const {
@@ -948,9 +953,9 @@ namespace contam {
             LOG_FREE_AND_THROW("openstudio.contam.ForwardTranslator",
                                "Mismatch between zone IC number and zone number at line " << input.lineNumber());
           }
-          std::vector<std::string> ic;
+          std::vector<double> ic;
           for (unsigned int j = 0; j < nctm; j++) {
-            ic.push_back(input.readNumber<std::string>());
+            ic.push_back(input.readNumber<double>());
           }
           m_zones[i].setIc(ic);
         }
@@ -958,24 +963,26 @@ namespace contam {
       input.read999("Failed to find zone IC section termination");
     }
 
-    std::string IndexModelImpl::writeZoneIc(int start) {
+    void IndexModelImpl::writeZoneIc(std::string& output, int start) {
       int offset = 1;
       if (start != 0) {
         offset = 1 - start;
       }
       int ncontaminants = contaminants().size();
       int nctm = ncontaminants * (m_zones.size() - start);
-      std::string string = ANY_TO_STR(nctm) + " ! initial zone concentrations:\n";
+      output += ANY_TO_STR(nctm);
+      output += " ! initial zone concentrations:\n";
       if (nctm != 0) {
         for (unsigned i = start; i < m_zones.size(); i++) {
-          string += ANY_TO_STR(i + offset);
+          output += ANY_TO_STR(i + offset);
           for (unsigned j = 0; j < (unsigned)ncontaminants; j++) {
-            string += ' ' + ANY_TO_STR(m_zones[i].ic(j));
+            output += ' ';
+            output += ANY_TO_STR(m_zones[i].ic(j));
           }
-          string += '\n';
+          output += '\n';
         }
       }
-      return string + "-999\n";
+      output += "-999\n";
     }
 
     int IndexModelImpl::airflowElementNrByName(std::string name) const {
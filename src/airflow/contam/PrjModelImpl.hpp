@@ -410,13 +410,14 @@ namespace contam {
      private:
       void setDefaults();
       void readZoneIc(Reader& input);
-      std::string writeZoneIc(int start = 0);
+      void writeZoneIc(std::string& output, int start = 0);
       template <class T>
-      std::string writeSectionVector(std::vector<T> vector, std::string label = std::string(), int start = 0);
+      void writeSectionVector(std::string& output, std::vector<T>& vector, const std::string& label = std::string(), int start = 0);
       template <class T>
-      std::string writeSectionVector(std::vector<std::shared_ptr<T>> vector, std::string label = std::string(), int start = 0);
+      void writeSectionVector(std::string& output, std::vector<std::shared_ptr<T>>& vector, const std::string& label = std::string(),
+                              int start = 0);
       template <class T>
-      std::string writeArray(std::vector<T> vector, std::string label = std::string(), int start = 0);
+      void writeArray(std::string& output, const std::vector<T>& vector, const std::string& label = std::string(), int start = 0);
       template <class T>
       void renumberVector(std::vector<T>& vector);
 
@@ -490,50 +491,49 @@ namespace contam {
     };
 
     template <class T>
-    std::string IndexModelImpl::writeSectionVector(std::vector<T> vector, std::string label, int start) {
-      std::string string;
+    void IndexModelImpl::writeSectionVector(std::string& output, std::vector<T>& vector, const std::string& label, int start) {
       int number = vector.size() - start;
-      if (label.empty()) {
-        string += openstudio::toString(number) + '\n';
-      } else {
-        string += openstudio::toString(number) + " ! " + label + '\n';
+      output += ANY_TO_STR(number);
+      if (!label.empty()) {
+        output += " ! ";
+        output += label;
       }
+      output += '\n';
       for (unsigned int i = start; i < vector.size(); i++) {
-        string += vector[i].write();
+        output += vector[i].write();
       }
-      string += "-999\n";
-      return string;
+      output += "-999\n";
     }
 
     template <class T>
-    std::string IndexModelImpl::writeSectionVector(std::vector<std::shared_ptr<T>> vector, std::string label, int start) {
-      std::string string;
+    void IndexModelImpl::writeSectionVector(std::string& output, std::vector<std::shared_ptr<T>>& vector, const std::string& label, int start) {
       int number = vector.size() - start;
-      if (label.empty()) {
-        string += openstudio::toString(number) + '\n';
-      } else {
-        string += openstudio::toString(number) + " ! " + label + '\n';
+      output += ANY_TO_STR(number);
+      if (!label.empty()) {
+        output += " ! ";
+        output += label;
       }
+      output += '\n';
       for (unsigned int i = start; i < vector.size(); i++) {
-        string += vector[i]->write();
+        output += vector[i]->write();
       }
-      string += "-999\n";
-      return string;
+      output += "-999\n";
     }
 
     template <class T>
-    std::string IndexModelImpl::writeArray(std::vector<T> vector, std::string label, int start) {
-      std::string string;
+    void IndexModelImpl::writeArray(std::string& output, const std::vector<T>& vector, const std::string& label, int start) {
       int number = vector.size() - start;
-      if (label.empty()) {
-        string += openstudio::toString(number) + '\n';
-      } else {
-        string += openstudio::toString(number) + " ! " + label + '\n';
+      output += ANY_TO_STR(number);
+      if (!label.empty()) {
+        output += " ! ";
+        output += label;
       }
+      output += '\n';
       for (unsigned int i = start; i < vector.size(); i++) {
-        string += ' ' + openstudio::toString(vector[i]);
+        output += ' ';
+        output += ANY_TO_STR(vector[i]);
       }
-      return string + '\n';
+      output += '\n';
     }
 
     template <class T>
@@ -42,10 +42,10 @@ namespace contam {
       m_pc = 0;
       m_pk = 0;
       m_pl = 0;
-      m_relHt = PRJFLOAT("0.0");
-      m_Vol = PRJFLOAT("0.0");
-      m_T0 = PRJFLOAT("0.0");
-      m_P0 = PRJFLOAT("0.0");
+      m_relHt = PRJFLOAT(0.0);
+      m_Vol = PRJFLOAT(0.0);
+      m_T0 = PRJFLOAT(0.0);
+      m_P0 = PRJFLOAT(0.0);
       m_color = 0;
       m_u_Ht = 0;
       m_u_V = 0;
@@ -53,14 +53,14 @@ namespace contam {
       m_u_P = 0;
       m_cdaxis = 0;
       m_cfd = 0;
-      m_X1 = PRJFLOAT("0.0");
-      m_Y1 = PRJFLOAT("0.0");
-      m_H1 = PRJFLOAT("0.0");
-      m_X2 = PRJFLOAT("0.0");
-      m_Y2 = PRJFLOAT("0.0");
-      m_H2 = PRJFLOAT("0.0");
-      m_celldx = PRJFLOAT("0.0");
-      m_axialD = PRJFLOAT("0.0");
+      m_X1 = PRJFLOAT(0.0);
+      m_Y1 = PRJFLOAT(0.0);
+      m_H1 = PRJFLOAT(0.0);
+      m_X2 = PRJFLOAT(0.0);
+      m_Y2 = PRJFLOAT(0.0);
+      m_H2 = PRJFLOAT(0.0);
+      m_celldx = PRJFLOAT(0.0);
+      m_axialD = PRJFLOAT(0.0);
       m_u_aD = 0;
       m_u_L = 0;
     }
@@ -147,10 +147,10 @@ namespace contam {
       setPc(input.readInt());
       setPk(input.readInt());
       setPl(input.readInt());
-      setRelHt(input.readNumber<std::string>());
-      setVol(input.readNumber<std::string>());
-      setT0(input.readNumber<std::string>());
-      setP0(input.readNumber<std::string>());
+      setRelHt(input.readNumber<double>());
+      setVol(input.readNumber<double>());
+      setT0(input.readNumber<double>());
+      setP0(input.readNumber<double>());
       setName(input.readString());
       setColor(input.readInt());
       setU_Ht(input.readInt());
@@ -163,14 +163,14 @@ namespace contam {
         setCfdname(input.readString());
       } else if (cdaxis() != 0) {
         input.readString();  // Read "1D:"
-        setX1(input.readNumber<std::string>());
-        setY1(input.readNumber<std::string>());
-        setH1(input.readNumber<std::string>());
-        setX2(input.readNumber<std::string>());
-        setY2(input.readNumber<std::string>());
-        setH2(input.readNumber<std::string>());
-        setCelldx(input.readNumber<std::string>());
-        setAxialD(input.readNumber<std::string>());
+        setX1(input.readNumber<double>());
+        setY1(input.readNumber<double>());
+        setH1(input.readNumber<double>());
+        setX2(input.readNumber<double>());
+        setY2(input.readNumber<double>());
+        setH2(input.readNumber<double>());
+        setCelldx(input.readNumber<double>());
+        setAxialD(input.readNumber<double>());
         setU_aD(input.readInt());
         setU_L(input.readInt());
       }
@@ -240,55 +240,55 @@ namespace contam {
     }
 
     double ZoneImpl::relHt() const {
-      return openstudio::string_conversions::to<double>(m_relHt);
+      return m_relHt.value();
     }
 
     bool ZoneImpl::setRelHt(const double relHt) {
-      m_relHt = openstudio::string_conversions::number(relHt);
+      m_relHt = PRJFLOAT(relHt);
       return true;
     }
 
     bool ZoneImpl::setRelHt(const std::string& relHt) {
-      return assign_if_valid<double>(relHt, m_relHt);
+      return m_relHt.assign(relHt);
     }
 
     double ZoneImpl::Vol() const {
-      return openstudio::string_conversions::to<double>(m_Vol);
+      return m_Vol.value();
     }
 
     bool ZoneImpl::setVol(const double Vol) {
-      m_Vol = openstudio::string_conversions::number(Vol);
+      m_Vol = PRJFLOAT(Vol);
       return true;
     }
 
     bool ZoneImpl::setVol(const std::string& Vol) {
-      return assign_if_valid<double>(Vol, m_Vol);
+      return m_Vol.assign(Vol);
     }
 
     double ZoneImpl::T0() const {
-      return openstudio::string_conversions::to<double>(m_T0);
+      return m_T0.value();
     }
 
     bool ZoneImpl::setT0(const double T0) {
-      m_T0 = openstudio::string_conversions::number(T0);
+      m_T0 = PRJFLOAT(T0);
       return true;
     }
 
     bool ZoneImpl::setT0(const std::string& T0) {
-      return assign_if_valid<double>(T0, m_T0);
+      return m_T0.assign(T0);
     }
 
     double ZoneImpl::P0() const {
-      return openstudio::string_conversions::to<double>(m_P0);
+      return m_P0.value();
     }
 
     bool ZoneImpl::setP0(const double P0) {
-      m_P0 = openstudio::string_conversions::number(P0);
+      m_P0 = PRJFLOAT(P0);
       return true;
     }
 
     bool ZoneImpl::setP0(const std::string& P0) {
-      return assign_if_valid<double>(P0, m_P0);
+      return m_P0.assign(P0);
     }
 
     std::string ZoneImpl::name() const {
@@ -364,107 +364,107 @@ namespace contam {
     }
 
     double ZoneImpl::X1() const {
-      return openstudio::string_conversions::to<double>(m_X1);
+      return m_X1.value();
     }
 
     bool ZoneImpl::setX1(const double X1) {
-      m_X1 = openstudio::string_conversions::number(X1);
+      m_X1 = PRJFLOAT(X1);
       return true;
     }
 
     bool ZoneImpl::setX1(const std::string& X1) {
-      return assign_if_valid<double>(X1, m_X1);
+      return m_X1.assign(X1);
     }
 
     double ZoneImpl::Y1() const {
-      return openstudio::string_conversions::to<double>(m_Y1);
+      return m_Y1.value();
     }
 
     bool ZoneImpl::setY1(const double Y1) {
-      m_Y1 = openstudio::string_conversions::number(Y1);
+      m_Y1 = PRJFLOAT(Y1);
       return true;
     }
 
     bool ZoneImpl::setY1(const std::string& Y1) {
-      return assign_if_valid<double>(Y1, m_Y1);
+      return m_Y1.assign(Y1);
     }
 
     double ZoneImpl::H1() const {
-      return openstudio::string_conversions::to<double>(m_H1);
+      return m_H1.value();
     }
 
     bool ZoneImpl::setH1(const double H1) {
-      m_H1 = openstudio::string_conversions::number(H1);
+      m_H1 = PRJFLOAT(H1);
       return true;
     }
 
     bool ZoneImpl::setH1(const std::string& H1) {
-      return assign_if_valid<double>(H1, m_H1);
+      return m_H1.assign(H1);
     }
 
     double ZoneImpl::X2() const {
-      return openstudio::string_conversions::to<double>(m_X2);
+      return m_X2.value();
     }
 
     bool ZoneImpl::setX2(const double X2) {
-      m_X2 = openstudio::string_conversions::number(X2);
+      m_X2 = PRJFLOAT(X2);
       return true;
     }
 
     bool ZoneImpl::setX2(const std::string& X2) {
-      return assign_if_valid<double>(X2, m_X2);
+      return m_X2.assign(X2);
     }
 
     double ZoneImpl::Y2() const {
-      return openstudio::string_conversions::to<double>(m_Y2);
+      return m_Y2.value();
     }
 
     bool ZoneImpl::setY2(const double Y2) {
-      m_Y2 = openstudio::string_conversions::number(Y2);
+      m_Y2 = PRJFLOAT(Y2);
       return true;
     }
 
     bool ZoneImpl::setY2(const std::string& Y2) {
-      return assign_if_valid<double>(Y2, m_Y2);
+      return m_Y2.assign(Y2);
     }
 
     double ZoneImpl::H2() const {
-      return openstudio::string_conversions::to<double>(m_H2);
+      return m_H2.value();
     }
 
     bool ZoneImpl::setH2(const double H2) {
-      m_H2 = openstudio::string_conversions::number(H2);
+      m_H2 = PRJFLOAT(H2);
       return true;
     }
 
     bool ZoneImpl::setH2(const std::string& H2) {
-      return assign_if_valid<double>(H2, m_H2);
+      return m_H2.assign(H2);
     }
 
     double ZoneImpl::celldx() const {
-      return openstudio::string_conversions::to<double>(m_celldx);
+      return m_celldx.value();
     }
 
     bool ZoneImpl::setCelldx(const double celldx) {
-      m_celldx = openstudio::string_conversions::number(celldx);
+      m_celldx = PRJFLOAT(celldx);
       return true;
     }
 
     bool ZoneImpl::setCelldx(const std::string& celldx) {
-      return assign_if_valid<double>(celldx, m_celldx);
+      return m_celldx.assign(celldx);
     }
 
     double ZoneImpl::axialD() const {
-      return openstudio::string_conversions::to<double>(m_axialD);
+      return m_axialD.value();
     }
 
     bool ZoneImpl::setAxialD(const double axialD) {
-      m_axialD = openstudio::string_conversions::number(axialD);
+      m_axialD = PRJFLOAT(axialD);
       return true;
     }
 
     bool ZoneImpl::setAxialD(const std::string& axialD) {
-      return assign_if_valid<double>(axialD, m_axialD);
+      return m_axialD.assign(axialD);
     }
 
     int ZoneImpl::u_aD() const {
@@ -520,41 +520,44 @@ namespace contam {
     }
 
     double ZoneImpl::ic(const int i) const {
-      return openstudio::string_conversions::to<double>(m_ic[i]);
+      return m_ic[i].value();
     }
 
     std::vector<double> ZoneImpl::ic() const {
       std::vector<double> out;
       for (std::size_t i = 0; i < m_ic.size(); i++) {
-        out.push_back(openstudio::string_conversions::to<double>(m_ic[i]));
+        out.push_back(m_ic[i].value());
       }
       return out;
     }
 
     bool ZoneImpl::setIc(const int i, const double value) {
-      m_ic[i] = openstudio::string_conversions::number(value);
+      m_ic[i] = PRJFLOAT(value);
       return true;
     }
 
     bool ZoneImpl::setIc(const int i, const std::string& value) {
-      return assign_if_valid<double>(value, m_ic[i]);
+      return m_ic[i].assign(value);
     }
 
     bool ZoneImpl::setIc(const std::vector<double>& ic) {
-      std::vector<std::string> in;
+      m_ic.clear();
       for (const auto& input : ic) {
-        in.push_back(openstudio::string_conversions::number(input));
+        m_ic.push_back(PRJFLOAT(input));
       }
       return true;
     }
 
     bool ZoneImpl::setIc(const std::vector<std::string>& ic) {
+      std::vector<PRJFLOAT> values;
       for (const auto& input : ic) {
-        if (!is_valid<double>(input)) {
+        auto value = PRJFLOAT::parse(input);
+        if (!value) {
           return false;
         }
+        values.push_back(value.get());
       }
-      m_ic = ic;
+      m_ic = values;
       return true;
     }
 
@@ -562,13 +565,13 @@ namespace contam {
       m_nr = 0;
       m_sflag = 0;
       m_ntflag = 0;
-      m_molwt = PRJFLOAT("0.0");
-      m_mdiam = PRJFLOAT("0.0");
-      m_edens = PRJFLOAT("0.0");
-      m_decay = PRJFLOAT("0.0");
-      m_Dm = PRJFLOAT("0.0");
-      m_ccdef = PRJFLOAT("0.0");
-      m_Cp = PRJFLOAT("0.0");
+      m_molwt = PRJFLOAT(0.0);
+      m_mdiam = PRJFLOAT(0.0);
+      m_edens = PRJFLOAT(0.0);
+      m_decay = PRJFLOAT(0.0);
+      m_Dm = PRJFLOAT(0.0);
+      m_ccdef = PRJFLOAT(0.0);
+      m_Cp = PRJFLOAT(0.0);
       m_ucc = 0;
       m_umd = 0;
       m_ued = 0;
@@ -680,94 +683,94 @@ namespace contam {
     }
 
     double SpeciesImpl::molwt() const {
-      return openstudio::string_conversions::to<double>(m_molwt);
+      return m_molwt.value();
     }
 
     bool SpeciesImpl::setMolwt(const double molwt) {
-      m_molwt = openstudio::string_conversions::number(molwt);
+      m_molwt = PRJFLOAT(molwt);
       return true;
     }
 
     bool SpeciesImpl::setMolwt(const std::string& molwt) {
-      return assign_if_valid<double>(molwt, m_molwt);
+      return m_molwt.assign(molwt);
     }
 
     double SpeciesImpl::mdiam() const {
-      return openstudio::string_conversions::to<double>(m_mdiam);
+      return m_mdiam.value();
     }
 
     bool SpeciesImpl::setMdiam(const double mdiam) {
-      m_mdiam = openstudio::string_conversions::number(mdiam);
+      m_mdiam = PRJFLOAT(mdiam);
       return true;
     }
 
     bool SpeciesImpl::setMdiam(const std::string& mdiam) {
-      return assign_if_valid<double>(mdiam, m_mdiam);
+      return m_mdiam.assign(mdiam);
     }
 
     double SpeciesImpl::edens() const {
-      return openstudio::string_conversions::to<double>(m_edens);
+      return m_edens.value();
     }
 
     bool SpeciesImpl::setEdens(const double edens) {
-      m_edens = openstudio::string_conversions::number(edens);
+      m_edens = PRJFLOAT(edens);
       return true;
     }
 
     bool SpeciesImpl::setEdens(const std::string& edens) {
-      return assign_if_valid<double>(edens, m_edens);
+      return m_edens.assign(edens);
     }
 
     double SpeciesImpl::decay() const {
-      return openstudio::string_conversions::to<double>(m_decay);
+      return m_decay.value();
     }
 
     bool SpeciesImpl::setDecay(const double decay) {
-      m_decay = openstudio::string_conversions::number(decay);
+      m_decay = PRJFLOAT(decay);
       return true;
     }
 
     bool SpeciesImpl::setDecay(const std::string& decay) {
-      return assign_if_valid<double>(decay, m_decay);
+      return m_decay.assign(decay);
     }
 
     double SpeciesImpl::Dm() const {
-      return openstudio::string_conversions::to<double>(m_Dm);
+      return m_Dm.value();
     }
 
     bool SpeciesImpl::setDm(const double Dm) {
-      m_Dm = openstudio::string_conversions::number(Dm);
+      m_Dm = PRJFLOAT(Dm);
       return true;
     }
 
     bool SpeciesImpl::setDm(const std::string& Dm) {
-      return assign_if_valid<double>(Dm, m_Dm);
+      return m_Dm.assign(Dm);
     }
 
     double SpeciesImpl::ccdef() const {
-      return openstudio::string_conversions::to<double>(m_ccdef);
+      return m_ccdef.value();
     }
 
     bool SpeciesImpl::setCcdef(const double ccdef) {
-      m_ccdef = openstudio::string_conversions::number(ccdef);
+      m_ccdef = PRJFLOAT(ccdef);
       return true;
     }
 
     bool SpeciesImpl::setCcdef(const std::string& ccdef) {
-      return assign_if_valid<double>(ccdef, m_ccdef);
+      return m_ccdef.assign(ccdef);
     }
 
     double SpeciesImpl::Cp() const {
-      return openstudio::string_conversions::to<double>(m_Cp);
+      return m_Cp.value();
     }
 
     bool SpeciesImpl::setCp(const double Cp) {
-      m_Cp = openstudio::string_conversions::number(Cp);
+      m_Cp = PRJFLOAT(Cp);
       return true;
     }
 
     bool SpeciesImpl::setCp(const std::string& Cp) {
-      return assign_if_valid<double>(Cp, m_Cp);
+      return m_Cp.assign(Cp);
     }
 
     int SpeciesImpl::ucc() const {
@@ -946,16 +949,16 @@ namespace contam {
       m_ps = 0;
       m_pc = 0;
       m_pld = 0;
-      m_X = PRJFLOAT("0.0");
-      m_Y = PRJFLOAT("0.0");
-      m_relHt = PRJFLOAT("0.0");
-      m_mult = PRJFLOAT("0.0");
-      m_wPset = PRJFLOAT("0.0");
-      m_wPmod = PRJFLOAT("0.0");
-      m_wazm = PRJFLOAT("0.0");
-      m_Fahs = PRJFLOAT("0.0");
-      m_Xmax = PRJFLOAT("0.0");
-      m_Xmin = PRJFLOAT("0.0");
+      m_X = PRJFLOAT(0.0);
+      m_Y = PRJFLOAT(0.0);
+      m_relHt = PRJFLOAT(0.0);
+      m_mult = PRJFLOAT(0.0);
+      m_wPset = PRJFLOAT(0.0);
+      m_wPmod = PRJFLOAT(0.0);
+      m_wazm = PRJFLOAT(0.0);
+      m_Fahs = PRJFLOAT(0.0);
+      m_Xmax = PRJFLOAT(0.0);
+      m_Xmin = PRJFLOAT(0.0);
       m_icon = 0;
       m_dir = 0;
       m_u_Ht = 0;
@@ -1062,16 +1065,16 @@ namespace contam {
       setPs(input.read<int>());
       setPc(input.read<int>());
       setPld(input.read<int>());
-      setX(input.readNumber<std::string>());
-      setY(input.readNumber<std::string>());
-      setRelHt(input.readNumber<std::string>());
-      setMult(input.readNumber<std::string>());
-      setWPset(input.readNumber<std::string>());
-      setWPmod(input.readNumber<std::string>());
-      setWazm(input.readNumber<std::string>());
-      setFahs(input.readNumber<std::string>());
-      setXmax(input.readNumber<std::string>());
-      setXmin(input.readNumber<std::string>());
+      setX(input.readNumber<double>());
+      setY(input.readNumber<double>());
+      setRelHt(input.readNumber<double>());
+      setMult(input.readNumber<double>());
+      setWPset(input.readNumber<double>());
+      setWPmod(input.readNumber<double>());
+      setWazm(input.readNumber<double>());
+      setFahs(input.readNumber<double>());
+      setXmax(input.readNumber<double>());
+      setXmin(input.readNumber<double>());
       setIcon(input.read<unsigned int>());
       setDir(input.read<unsigned int>());
       setU_Ht(input.read<int>());
@@ -1190,133 +1193,133 @@ namespace contam {
     }
 
     double AirflowPathImpl::X() const {
-      return openstudio::string_conversions::to<double>(m_X);
+      return m_X.value();
     }
 
     bool AirflowPathImpl::setX(const double X) {
-      m_X = openstudio::string_conversions::number(X);
+      m_X = PRJFLOAT(X);
       return true;
     }
 
     bool AirflowPathImpl::setX(const std::string& X) {
-      return assign_if_valid<double>(X, m_X);
+      return m_X.assign(X);
     }
 
     double AirflowPathImpl::Y() const {
-      return openstudio::string_conversions::to<double>(m_Y);
+      return m_Y.value();
     }
 
     bool AirflowPathImpl::setY(const double Y) {
-      m_Y = openstudio::string_conversions::number(Y);
+      m_Y = PRJFLOAT(Y);
       return true;
     }
 
     bool AirflowPathImpl::setY(const std::string& Y) {
-      return assign_if_valid<double>(Y, m_Y);
+      return m_Y.assign(Y);
     }
 
     double AirflowPathImpl::relHt() const {
-      return openstudio::string_conversions::to<double>(m_relHt);
+      return m_relHt.value();
     }
 
     bool AirflowPathImpl::setRelHt(const double relHt) {
-      m_relHt = openstudio::string_conversions::number(relHt);
+      m_relHt = PRJFLOAT(relHt);
       return true;
     }
 
     bool AirflowPathImpl::setRelHt(const std::string& relHt) {
-      return assign_if_valid<double>(relHt, m_relHt);
+      return m_relHt.assign(relHt);
     }
 
     double AirflowPathImpl::mult() const {
-      return openstudio::string_conversions::to<double>(m_mult);
+      return m_mult.value();
     }
 
     bool AirflowPathImpl::setMult(const double mult) {
-      m_mult = openstudio::string_conversions::number(mult);
+      m_mult = PRJFLOAT(mult);
       return true;
     }
 
     bool AirflowPathImpl::setMult(const std::string& mult) {
-      return assign_if_valid<double>(mult, m_mult);
+      return m_mult.assign(mult);
     }
 
     double AirflowPathImpl::wPset() const {
-      return openstudio::string_conversions::to<double>(m_wPset);
+      return m_wPset.value();
     }
 
     bool AirflowPathImpl::setWPset(const double wPset) {
-      m_wPset = openstudio::string_conversions::number(wPset);
+      m_wPset = PRJFLOAT(wPset);
       return true;
     }
 
     bool AirflowPathImpl::setWPset(const std::string& wPset) {
-      return assign_if_valid<double>(wPset, m_wPset);
+      return m_wPset.assign(wPset);
     }
 
     double AirflowPathImpl::wPmod() const {
-      return openstudio::string_conversions::to<double>(m_wPmod);
+      return m_wPmod.value();
     }
 
     bool AirflowPathImpl::setWPmod(const double wPmod) {
-      m_wPmod = openstudio::string_conversions::number(wPmod);
+      m_wPmod = PRJFLOAT(wPmod);
       return true;
     }
 
     bool AirflowPathImpl::setWPmod(const std::string& wPmod) {
-      return assign_if_valid<double>(wPmod, m_wPmod);
+      return m_wPmod.assign(wPmod);
     }
 
     double AirflowPathImpl::wazm() const {
-      return openstudio::string_conversions::to<double>(m_wazm);
+      return m_wazm.value();
     }
 
     bool AirflowPathImpl::setWazm(const double wazm) {
-      m_wazm = openstudio::string_conversions::number(wazm);
+      m_wazm = PRJFLOAT(wazm);
       return true;
     }
 
     bool AirflowPathImpl::setWazm(const std::string& wazm) {
-      return assign_if_valid<double>(wazm, m_wazm);
+      return m_wazm.assign(wazm);
     }
 
     double AirflowPathImpl::Fahs() const {
-      return openstudio::string_conversions::to<double>(m_Fahs);
+      return m_Fahs.value();
     }
 
     bool AirflowPathImpl::setFahs(const double Fahs) {
-      m_Fahs = openstudio::string_conversions::number(Fahs);
+      m_Fahs = PRJFLOAT(Fahs);
       return true;
     }
 
     bool AirflowPathImpl::setFahs(const std::string& Fahs) {
-      return assign_if_valid<double>(Fahs, m_Fahs);
+      return m_Fahs.assign(Fahs);
     }
 
     double AirflowPathImpl::Xmax() const {
-      return openstudio::string_conversions::to<double>(m_Xmax);
+      return m_Xmax.value();
     }
 
     bool AirflowPathImpl::setXmax(const double Xmax) {
-      m_Xmax = openstudio::string_conversions::number(Xmax);
+      m_Xmax = PRJFLOAT(Xmax);
       return true;
     }
 
     bool AirflowPathImpl::setXmax(const std::string& Xmax) {
-      return assign_if_valid<double>(Xmax, m_Xmax);
+      return m_Xmax.assign(Xmax);
     }
 
     double AirflowPathImpl::Xmin() const {
-      return openstudio::string_conversions::to<double>(m_Xmin);
+      return m_Xmin.value();
     }
 
     bool AirflowPathImpl::setXmin(const double Xmin) {
-      m_Xmin = openstudio::string_conversions::number(Xmin);
+      m_Xmin = PRJFLOAT(Xmin);
       return true;
     }
 
     bool AirflowPathImpl::setXmin(const std::string& Xmin) {
-      return assign_if_valid<double>(Xmin, m_Xmin);
+      return m_Xmin.assign(Xmin);
     }
 
     unsigned int AirflowPathImpl::icon() const {
@@ -1471,59 +1474,59 @@ namespace contam {
       m_sim_af = 0;
       m_afcalc = 0;
       m_afmaxi = 0;
-      m_afrcnvg = PRJFLOAT("0.0");
-      m_afacnvg = PRJFLOAT("0.0");
-      m_afrelax = PRJFLOAT("0.0");
+      m_afrcnvg = PRJFLOAT(0.0);
+      m_afacnvg = PRJFLOAT(0.0);
+      m_afrelax = PRJFLOAT(0.0);
       m_uac2 = 0;
-      m_Pres = PRJFLOAT("0.0");
+      m_Pres = PRJFLOAT(0.0);
       m_uPres = 0;
       m_afslae = 0;
       m_afrseq = 0;
       m_aflmaxi = 0;
-      m_aflcnvg = PRJFLOAT("0.0");
+      m_aflcnvg = PRJFLOAT(0.0);
       m_aflinit = 0;
       m_Tadj = 0;
       m_sim_mf = 0;
       m_ccmaxi = 0;
-      m_ccrcnvg = PRJFLOAT("0.0");
-      m_ccacnvg = PRJFLOAT("0.0");
-      m_ccrelax = PRJFLOAT("0.0");
+      m_ccrcnvg = PRJFLOAT(0.0);
+      m_ccacnvg = PRJFLOAT(0.0);
+      m_ccrelax = PRJFLOAT(0.0);
       m_uccc = 0;
       m_mfnmthd = 0;
       m_mfnrseq = 0;
       m_mfnmaxi = 0;
-      m_mfnrcnvg = PRJFLOAT("0.0");
-      m_mfnacnvg = PRJFLOAT("0.0");
-      m_mfnrelax = PRJFLOAT("0.0");
-      m_mfngamma = PRJFLOAT("0.0");
+      m_mfnrcnvg = PRJFLOAT(0.0);
+      m_mfnacnvg = PRJFLOAT(0.0);
+      m_mfnrelax = PRJFLOAT(0.0);
+      m_mfngamma = PRJFLOAT(0.0);
       m_uccn = 0;
       m_mftmthd = 0;
       m_mftrseq = 0;
       m_mftmaxi = 0;
-      m_mftrcnvg = PRJFLOAT("0.0");
-      m_mftacnvg = PRJFLOAT("0.0");
-      m_mftrelax = PRJFLOAT("0.0");
-      m_mftgamma = PRJFLOAT("0.0");
+      m_mftrcnvg = PRJFLOAT(0.0);
+      m_mftacnvg = PRJFLOAT(0.0);
+      m_mftrelax = PRJFLOAT(0.0);
+      m_mftgamma = PRJFLOAT(0.0);
       m_ucct = 0;
       m_mfvmthd = 0;
       m_mfvrseq = 0;
       m_mfvmaxi = 0;
-      m_mfvrcnvg = PRJFLOAT("0.0");
-      m_mfvacnvg = PRJFLOAT("0.0");
-      m_mfvrelax = PRJFLOAT("0.0");
+      m_mfvrcnvg = PRJFLOAT(0.0);
+      m_mfvacnvg = PRJFLOAT(0.0);
+      m_mfvrelax = PRJFLOAT(0.0);
       m_uccv = 0;
       m_mf_solver = 0;
       m_sim_1dz = 0;
       m_sim_1dd = 0;
-      m_celldx = PRJFLOAT("0.0");
+      m_celldx = PRJFLOAT(0.0);
       m_sim_vjt = 0;
       m_udx = 0;
       m_cvode_mth = 0;
-      m_cvode_rcnvg = PRJFLOAT("0.0");
-      m_cvode_acnvg = PRJFLOAT("0.0");
-      m_cvode_dtmax = PRJFLOAT("0.0");
+      m_cvode_rcnvg = PRJFLOAT(0.0);
+      m_cvode_acnvg = PRJFLOAT(0.0);
+      m_cvode_dtmax = PRJFLOAT(0.0);
       m_tsdens = 0;
-      m_tsrelax = PRJFLOAT("0.0");
+      m_tsrelax = PRJFLOAT(0.0);
       m_tsmaxi = 0;
       m_cnvgSS = 0;
       m_densZP = 0;
@@ -1553,7 +1556,7 @@ namespace contam {
       m_BldgFlowD = 0;
       m_BldgFlowC = 0;
       m_cfd_ctype = 0;
-      m_cfd_convcpl = PRJFLOAT("0.0");
+      m_cfd_convcpl = PRJFLOAT(0.0);
       m_cfd_var = 0;
       m_cfd_zref = 0;
       m_cfd_imax = 0;
@@ -1811,59 +1814,59 @@ namespace contam {
       setSim_af(input.read<int>());
       setAfcalc(input.read<int>());
       setAfmaxi(input.read<int>());
-      setAfrcnvg(input.readNumber<std::string>());
-      setAfacnvg(input.readNumber<std::string>());
-      setAfrelax(input.readNumber<std::string>());
+      setAfrcnvg(input.readNumber<double>());
+      setAfacnvg(input.readNumber<double>());
+      setAfrelax(input.readNumber<double>());
       setUac2(input.read<int>());
-      setPres(input.readNumber<std::string>());
+      setPres(input.readNumber<double>());
       setUPres(input.read<int>());
       setAfslae(input.read<int>());
       setAfrseq(input.read<int>());
       setAflmaxi(input.read<int>());
-      setAflcnvg(input.readNumber<std::string>());
+      setAflcnvg(input.readNumber<double>());
       setAflinit(input.read<int>());
       setTadj(input.read<int>());
       setSim_mf(input.read<int>());
       setCcmaxi(input.read<int>());
-      setCcrcnvg(input.readNumber<std::string>());
-      setCcacnvg(input.readNumber<std::string>());
-      setCcrelax(input.readNumber<std::string>());
+      setCcrcnvg(input.readNumber<double>());
+      setCcacnvg(input.readNumber<double>());
+      setCcrelax(input.readNumber<double>());
       setUccc(input.read<int>());
       setMfnmthd(input.read<int>());
       setMfnrseq(input.read<int>());
       setMfnmaxi(input.read<int>());
-      setMfnrcnvg(input.readNumber<std::string>());
-      setMfnacnvg(input.readNumber<std::string>());
-      setMfnrelax(input.readNumber<std::string>());
-      setMfngamma(input.readNumber<std::string>());
+      setMfnrcnvg(input.readNumber<double>());
+      setMfnacnvg(input.readNumber<double>());
+      setMfnrelax(input.readNumber<double>());
+      setMfngamma(input.readNumber<double>());
       setUccn(input.read<int>());
       setMftmthd(input.read<int>());
       setMftrseq(input.read<int>());
       setMftmaxi(input.read<int>());
-      setMftrcnvg(input.readNumber<std::string>());
-      setMftacnvg(input.readNumber<std::string>());
-      setMftrelax(input.readNumber<std::string>());
-      setMftgamma(input.readNumber<std::string>());
+      setMftrcnvg(input.readNumber<double>());
+      setMftacnvg(input.readNumber<double>());
+      setMftrelax(input.readNumber<double>());
+      setMftgamma(input.readNumber<double>());
       setUcct(input.read<int>());
       setMfvmthd(input.read<int>());
       setMfvrseq(input.read<int>());
       setMfvmaxi(input.read<int>());
-      setMfvrcnvg(input.readNumber<std::string>());
-      setMfvacnvg(input.readNumber<std::string>());
-      setMfvrelax(input.readNumber<std::string>());
+      setMfvrcnvg(input.readNumber<double>());
+      setMfvacnvg(input.readNumber<double>());
+      setMfvrelax(input.readNumber<double>());
       setUccv(input.read<int>());
       setMf_solver(input.read<int>());
       setSim_1dz(input.read<int>());
       setSim_1dd(input.read<int>());
-      setCelldx(input.readNumber<std::string>());
+      setCelldx(input.readNumber<double>());
       setSim_vjt(input.read<int>());
       setUdx(input.read<int>());
       setCvode_mth(input.read<int>());
-      setCvode_rcnvg(input.readNumber<std::string>());
-      setCvode_acnvg(input.readNumber<std::string>());
-      setCvode_dtmax(input.readNumber<std::string>());
+      setCvode_rcnvg(input.readNumber<double>());
+      setCvode_acnvg(input.readNumber<double>());
+      setCvode_dtmax(input.readNumber<double>());
       setTsdens(input.read<int>());
-      setTsrelax(input.readNumber<std::string>());
+      setTsrelax(input.readNumber<double>());
       setTsmaxi(input.read<int>());
       setCnvgSS(input.read<int>());
       setDensZP(input.read<int>());
@@ -1906,16 +1909,16 @@ namespace contam {
       }
       setSave(save);
       int nrvals = input.read<int>();
-      std::vector<std::string> rvals;
+      std::vector<double> rvals;
       for (int i = 0; i < nrvals; i++) {
-        rvals.push_back(input.read<std::string>());
+        rvals.push_back(input.read<double>());
       }
       setRvals(rvals);
       setBldgFlowZ(input.read<int>());
       setBldgFlowD(input.read<int>());
       setBldgFlowC(input.read<int>());
       setCfd_ctype(input.read<int>());
-      setCfd_convcpl(input.readNumber<std::string>());
+      setCfd_convcpl(input.readNumber<double>());
       setCfd_var(input.read<int>());
       setCfd_zref(input.read<int>());
       setCfd_imax(input.read<int>());
@@ -1991,42 +1994,42 @@ namespace contam {
     }
 
     double RunControlImpl::afrcnvg() const {
-      return openstudio::string_conversions::to<double>(m_afrcnvg);
+      return m_afrcnvg.value();
     }
 
     bool RunControlImpl::setAfrcnvg(const double afrcnvg) {
-      m_afrcnvg = openstudio::string_conversions::number(afrcnvg);
+      m_afrcnvg = PRJFLOAT(afrcnvg);
       return true;
     }
 
     bool RunControlImpl::setAfrcnvg(const std::string& afrcnvg) {
-      return assign_if_valid<double>(afrcnvg, m_afrcnvg);
+      return m_afrcnvg.assign(afrcnvg);
     }
 
     double RunControlImpl::afacnvg() const {
-      return openstudio::string_conversions::to<double>(m_afacnvg);
+      return m_afacnvg.value();
     }
 
     bool RunControlImpl::setAfacnvg(const double afacnvg) {
-      m_afacnvg = openstudio::string_conversions::number(afacnvg);
+      m_afacnvg = PRJFLOAT(afacnvg);
       return true;
     }
 
     bool RunControlImpl::setAfacnvg(const std::string& afacnvg) {
-      return assign_if_valid<double>(afacnvg, m_afacnvg);
+      return m_afacnvg.assign(afacnvg);
     }
 
     double RunControlImpl::afrelax() const {
-      return openstudio::string_conversions::to<double>(m_afrelax);
+      return m_afrelax.value();
     }
 
     bool RunControlImpl::setAfrelax(const double afrelax) {
-      m_afrelax = openstudio::string_conversions::number(afrelax);
+      m_afrelax = PRJFLOAT(afrelax);
       return true;
     }
 
     bool RunControlImpl::setAfrelax(const std::string& afrelax) {
-      return assign_if_valid<double>(afrelax, m_afrelax);
+      return m_afrelax.assign(afrelax);
     }
 
     int RunControlImpl::uac2() const {
@@ -2038,16 +2041,16 @@ namespace contam {
     }
 
     double RunControlImpl::Pres() const {
-      return openstudio::string_conversions::to<double>(m_Pres);
+      return m_Pres.value();
     }
 
     bool RunControlImpl::setPres(const double Pres) {
-      m_Pres = openstudio::string_conversions::number(Pres);
+      m_Pres = PRJFLOAT(Pres);
       return true;
     }
 
     bool RunControlImpl::setPres(const std::string& Pres) {
-      return assign_if_valid<double>(Pres, m_Pres);
+      return m_Pres.assign(Pres);
     }
 
     int RunControlImpl::uPres() const {
@@ -2083,16 +2086,16 @@ namespace contam {
     }
 
     double RunControlImpl::aflcnvg() const {
-      return openstudio::string_conversions::to<double>(m_aflcnvg);
+      return m_aflcnvg.value();
     }
 
     bool RunControlImpl::setAflcnvg(const double aflcnvg) {
-      m_aflcnvg = openstudio::string_conversions::number(aflcnvg);
+      m_aflcnvg = PRJFLOAT(aflcnvg);
       return true;
     }
 
     bool RunControlImpl::setAflcnvg(const std::string& aflcnvg) {
-      return assign_if_valid<double>(aflcnvg, m_aflcnvg);
+      return m_aflcnvg.assign(aflcnvg);
     }
 
     int RunControlImpl::aflinit() const {
@@ -2128,42 +2131,42 @@ namespace contam {
     }
 
     double RunControlImpl::ccrcnvg() const {
-      return openstudio::string_conversions::to<double>(m_ccrcnvg);
+      return m_ccrcnvg.value();
     }
 
     bool RunControlImpl::setCcrcnvg(const double ccrcnvg) {
-      m_ccrcnvg = openstudio::string_conversions::number(ccrcnvg);
+      m_ccrcnvg = PRJFLOAT(ccrcnvg);
       return true;
     }
 
     bool RunControlImpl::setCcrcnvg(const std::string& ccrcnvg) {
-      return assign_if_valid<double>(ccrcnvg, m_ccrcnvg);
+      return m_ccrcnvg.assign(ccrcnvg);
     }
 
     double RunControlImpl::ccacnvg() const {
-      return openstudio::string_conversions::to<double>(m_ccacnvg);
+      return m_ccacnvg.value();
     }
 
     bool RunControlImpl::setCcacnvg(const double ccacnvg) {
-      m_ccacnvg = openstudio::string_conversions::number(ccacnvg);
+      m_ccacnvg = PRJFLOAT(ccacnvg);
       return true;
     }
 
     bool RunControlImpl::setCcacnvg(const std::string& ccacnvg) {
-      return assign_if_valid<double>(ccacnvg, m_ccacnvg);
+      return m_ccacnvg.assign(ccacnvg);
     }
 
     double RunControlImpl::ccrelax() const {
-      return openstudio::string_conversions::to<double>(m_ccrelax);
+      return m_ccrelax.value();
     }
 
     bool RunControlImpl::setCcrelax(const double ccrelax) {
-      m_ccrelax = openstudio::string_conversions::number(ccrelax);
+      m_ccrelax = PRJFLOAT(ccrelax);
       return true;
     }
 
     bool RunControlImpl::setCcrelax(const std::string& ccrelax) {
-      return assign_if_valid<double>(ccrelax, m_ccrelax);
+      return m_ccrelax.assign(ccrelax);
     }
 
     int RunControlImpl::uccc() const {
@@ -2199,55 +2202,55 @@ namespace contam {
     }
 
     double RunControlImpl::mfnrcnvg() const {
-      return openstudio::string_conversions::to<double>(m_mfnrcnvg);
+      return m_mfnrcnvg.value();
     }
 
     bool RunControlImpl::setMfnrcnvg(const double mfnrcnvg) {
-      m_mfnrcnvg = openstudio::string_conversions::number(mfnrcnvg);
+      m_mfnrcnvg = PRJFLOAT(mfnrcnvg);
       return true;
     }
 
     bool RunControlImpl::setMfnrcnvg(const std::string& mfnrcnvg) {
-      return assign_if_valid<double>(mfnrcnvg, m_mfnrcnvg);
+      return m_mfnrcnvg.assign(mfnrcnvg);
     }
 
     double RunControlImpl::mfnacnvg() const {
-      return openstudio::string_conversions::to<double>(m_mfnacnvg);
+      return m_mfnacnvg.value();
     }
 
     bool RunControlImpl::setMfnacnvg(const double mfnacnvg) {
-      m_mfnacnvg = openstudio::string_conversions::number(mfnacnvg);
+      m_mfnacnvg = PRJFLOAT(mfnacnvg);
       return true;
     }
 
     bool RunControlImpl::setMfnacnvg(const std::string& mfnacnvg) {
-      return assign_if_valid<double>(mfnacnvg, m_mfnacnvg);
+      return m_mfnacnvg.assign(mfnacnvg);
     }
 
     double RunControlImpl::mfnrelax() const {
-      return openstudio::string_conversions::to<double>(m_mfnrelax);
+      return m_mfnrelax.value();
     }
 
     bool RunControlImpl::setMfnrelax(const double mfnrelax) {
-      m_mfnrelax = openstudio::string_conversions::number(mfnrelax);
+      m_mfnrelax = PRJFLOAT(mfnrelax);
       return true;
     }
 
     bool RunControlImpl::setMfnrelax(const std::string& mfnrelax) {
-      return assign_if_valid<double>(mfnrelax, m_mfnrelax);
+      return m_mfnrelax.assign(mfnrelax);
     }
 
     double RunControlImpl::mfngamma() const {
-      return openstudio::string_conversions::to<double>(m_mfngamma);
+      return m_mfngamma.value();
     }
 
     bool RunControlImpl::setMfngamma(const double mfngamma) {
-      m_mfngamma = openstudio::string_conversions::number(mfngamma);
+      m_mfngamma = PRJFLOAT(mfngamma);
       return true;
     }
 
     bool RunControlImpl::setMfngamma(const std::string& mfngamma) {
-      return assign_if_valid<double>(mfngamma, m_mfngamma);
+      return m_mfngamma.assign(mfngamma);
     }
 
     int RunControlImpl::uccn() const {
@@ -2283,55 +2286,55 @@ namespace contam {
     }
 
     double RunControlImpl::mftrcnvg() const {
-      return openstudio::string_conversions::to<double>(m_mftrcnvg);
+      return m_mftrcnvg.value();
     }
 
     bool RunControlImpl::setMftrcnvg(const double mftrcnvg) {
-      m_mftrcnvg = openstudio::string_conversions::number(mftrcnvg);
+      m_mftrcnvg = PRJFLOAT(mftrcnvg);
       return true;
     }
 
     bool RunControlImpl::setMftrcnvg(const std::string& mftrcnvg) {
-      return assign_if_valid<double>(mftrcnvg, m_mftrcnvg);
+      return m_mftrcnvg.assign(mftrcnvg);
     }
 
     double RunControlImpl::mftacnvg() const {
-      return openstudio::string_conversions::to<double>(m_mftacnvg);
+      return m_mftacnvg.value();
     }
 
     bool RunControlImpl::setMftacnvg(const double mftacnvg) {
-      m_mftacnvg = openstudio::string_conversions::number(mftacnvg);
+      m_mftacnvg = PRJFLOAT(mftacnvg);
       return true;
     }
 
     bool RunControlImpl::setMftacnvg(const std::string& mftacnvg) {
-      return assign_if_valid<double>(mftacnvg, m_mftacnvg);
+      return m_mftacnvg.assign(mftacnvg);
     }
 
     double RunControlImpl::mftrelax() const {
-      return openstudio::string_conversions::to<double>(m_mftrelax);
+      return m_mftrelax.value();
     }
 
     bool RunControlImpl::setMftrelax(const double mftrelax) {
-      m_mftrelax = openstudio::string_conversions::number(mftrelax);
+      m_mftrelax = PRJFLOAT(mftrelax);
       return true;
     }
 
     bool RunControlImpl::setMftrelax(const std::string& mftrelax) {
-      return assign_if_valid<double>(mftrelax, m_mftrelax);
+      return m_mftrelax.assign(mftrelax);
     }
 
     double RunControlImpl::mftgamma() const {
-      return openstudio::string_conversions::to<double>(m_mftgamma);
+      return m_mftgamma.value();
     }
 
     bool RunControlImpl::setMftgamma(const double mftgamma) {
-      m_mftgamma = openstudio::string_conversions::number(mftgamma);
+      m_mftgamma = PRJFLOAT(mftgamma);
       return true;
     }
 
     bool RunControlImpl::setMftgamma(const std::string& mftgamma) {
-      return assign_if_valid<double>(mftgamma, m_mftgamma);
+      return m_mftgamma.assign(mftgamma);
     }
 
     int RunControlImpl::ucct() const {
@@ -2367,42 +2370,42 @@ namespace contam {
     }
 
     double RunControlImpl::mfvrcnvg() const {
-      return openstudio::string_conversions::to<double>(m_mfvrcnvg);
+      return m_mfvrcnvg.value();
     }
 
     bool RunControlImpl::setMfvrcnvg(const double mfvrcnvg) {
-      m_mfvrcnvg = openstudio::string_conversions::number(mfvrcnvg);
+      m_mfvrcnvg = PRJFLOAT(mfvrcnvg);
       return true;
     }
 
     bool RunControlImpl::setMfvrcnvg(const std::string& mfvrcnvg) {
-      return assign_if_valid<double>(mfvrcnvg, m_mfvrcnvg);
+      return m_mfvrcnvg.assign(mfvrcnvg);
     }
 
     double RunControlImpl::mfvacnvg() const {
-      return openstudio::string_conversions::to<double>(m_mfvacnvg);
+      return m_mfvacnvg.value();
     }
 
     bool RunControlImpl::setMfvacnvg(const double mfvacnvg) {
-      m_mfvacnvg = openstudio::string_conversions::number(mfvacnvg);
+      m_mfvacnvg = PRJFLOAT(mfvacnvg);
       return true;
     }
 
     bool RunControlImpl::setMfvacnvg(const std::string& mfvacnvg) {
-      return assign_if_valid<double>(mfvacnvg, m_mfvacnvg);
+      return m_mfvacnvg.assign(mfvacnvg);
     }
 
     double RunControlImpl::mfvrelax() const {
-      return openstudio::string_conversions::to<double>(m_mfvrelax);
+      return m_mfvrelax.value();
     }
 
     bool RunControlImpl::setMfvrelax(const double mfvrelax) {
-      m_mfvrelax = openstudio::string_conversions::number(mfvrelax);
+      m_mfvrelax = PRJFLOAT(mfvrelax);
       return true;
     }
 
     bool RunControlImpl::setMfvrelax(const std::string& mfvrelax) {
-      return assign_if_valid<double>(mfvrelax, m_mfvrelax);
+      return m_mfvrelax.assign(mfvrelax);
     }
 
     int RunControlImpl::uccv() const {
@@ -2438,16 +2441,16 @@ namespace contam {
     }
 
     double RunControlImpl::celldx() const {
-      return openstudio::string_conversions::to<double>(m_celldx);
+      return m_celldx.value();
     }
 
     bool RunControlImpl::setCelldx(const double celldx) {
-      m_celldx = openstudio::string_conversions::number(celldx);
+      m_celldx = PRJFLOAT(celldx);
       return true;
     }
 
     bool RunControlImpl::setCelldx(const std::string& celldx) {
-      return assign_if_valid<double>(celldx, m_celldx);
+      return m_celldx.assign(celldx);
     }
 
     int RunControlImpl::sim_vjt() const {
@@ -2475,42 +2478,42 @@ namespace contam {
     }
 
     double RunControlImpl::cvode_rcnvg() const {
-      return openstudio::string_conversions::to<double>(m_cvode_rcnvg);
+      return m_cvode_rcnvg.value();
     }
 
     bool RunControlImpl::setCvode_rcnvg(const double cvode_rcnvg) {
-      m_cvode_rcnvg = openstudio::string_conversions::number(cvode_rcnvg);
+      m_cvode_rcnvg = PRJFLOAT(cvode_rcnvg);
       return true;
     }
 
     bool RunControlImpl::setCvode_rcnvg(const std::string& cvode_rcnvg) {
-      return assign_if_valid<double>(cvode_rcnvg, m_cvode_rcnvg);
+      return m_cvode_rcnvg.assign(cvode_rcnvg);
     }
 
     double RunControlImpl::cvode_acnvg() const {
-      return openstudio::string_conversions::to<double>(m_cvode_acnvg);
+      return m_cvode_acnvg.value();
     }
 
     bool RunControlImpl::setCvode_acnvg(const double cvode_acnvg) {
-      m_cvode_acnvg = openstudio::string_conversions::number(cvode_acnvg);
+      m_cvode_acnvg = PRJFLOAT(cvode_acnvg);
       return true;
     }
 
     bool RunControlImpl::setCvode_acnvg(const std::string& cvode_acnvg) {
-      return assign_if_valid<double>(cvode_acnvg, m_cvode_acnvg);
+      return m_cvode_acnvg.assign(cvode_acnvg);
     }
 
     double RunControlImpl::cvode_dtmax() const {
-      return openstudio::string_conversions::to<double>(m_cvode_dtmax);
+      return m_cvode_dtmax.value();
     }
 
     bool RunControlImpl::setCvode_dtmax(const double cvode_dtmax) {
-      m_cvode_dtmax = openstudio::string_conversions::number(cvode_dtmax);
+      m_cvode_dtmax = PRJFLOAT(cvode_dtmax);
       return true;
     }
 
     bool RunControlImpl::setCvode_dtmax(const std::string& cvode_dtmax) {
-      return assign_if_valid<double>(cvode_dtmax, m_cvode_dtmax);
+      return m_cvode_dtmax.assign(cvode_dtmax);
     }
 
     int RunControlImpl::tsdens() const {
@@ -2522,16 +2525,16 @@ namespace contam {
     }
 
     double RunControlImpl::tsrelax() const {
-      return openstudio::string_conversions::to<double>(m_tsrelax);
+      return m_tsrelax.value();
     }
 
     bool RunControlImpl::setTsrelax(const double tsrelax) {
-      m_tsrelax = openstudio::string_conversions::number(tsrelax);
+      m_tsrelax = PRJFLOAT(tsrelax);
       return true;
     }
 
     bool RunControlImpl::setTsrelax(const std::string& tsrelax) {
-      return assign_if_valid<double>(tsrelax, m_tsrelax);
+      return m_tsrelax.assign(tsrelax);
     }
 
     int RunControlImpl::tsmaxi() const {
@@ -2833,27 +2836,31 @@ namespace contam {
     std::vector<double> RunControlImpl::rvals() const {
       std::vector<double> out;
       for (const auto& val : m_rvals) {
-        out.push_back(openstudio::string_conversions::to<double>(val));
+        out.push_back(val.value());
       }
       return out;
     }
 
     bool RunControlImpl::setRvals(const std::vector<double>& rvals) {
-      std::vector<std::string> new_vals;
+      std::vector<PRJFLOAT> new_vals;
       for (const auto& val : rvals) {
-        new_vals.push_back(openstudio::string_conversions::number(val));
+        new_vals.push_back(PRJFLOAT(val));
       }
       m_rvals = new_vals;
       return true;
     }
 
     bool RunControlImpl::setRvals(const std::vector<std::string>& rvals) {
-      if (std::all_of(rvals.begin(), rvals.end(), is_valid<double, std::string>)) {
-        m_rvals = rvals;
-        return true;
-      } else {
-        return false;
+      std::vector<PRJFLOAT> new_vals;
+      for (const auto& val : rvals) {
+        auto value = PRJFLOAT::parse(val);
+        if (!value) {
+          return false;
+        }
+        new_vals.push_back(value.get());
       }
+      m_rvals = new_vals;
+      return true;
     }
 
     int RunControlImpl::BldgFlowZ() const {
@@ -2889,16 +2896,16 @@ namespace contam {
     }
 
     double RunControlImpl::cfd_convcpl() const {
-      return openstudio::string_conversions::to<double>(m_cfd_convcpl);
+      return m_cfd_convcpl.value();
     }
 
     bool RunControlImpl::setCfd_convcpl(const double cfd_convcpl) {
-      m_cfd_convcpl = openstudio::string_conversions::number(cfd_convcpl);
+      m_cfd_convcpl = PRJFLOAT(cfd_convcpl);
       return true;
     }
 
     bool RunControlImpl::setCfd_convcpl(const std::string& cfd_convcpl) {
-      return assign_if_valid<double>(cfd_convcpl, m_cfd_convcpl);
+      return m_cfd_convcpl.assign(cfd_convcpl);
     }
 
     int RunControlImpl::cfd_var() const {
@@ -2935,8 +2942,8 @@ namespace contam {
 
     void LevelImpl::setDefaults() {
       m_nr = 0;
-      m_refht = PRJFLOAT("0.0");
-      m_delht = PRJFLOAT("0.0");
+      m_refht = PRJFLOAT(0.0);
+      m_delht = PRJFLOAT(0.0);
       m_u_rfht = 0;
       m_u_dlht = 0;
     }
@@ -2969,8 +2976,8 @@ namespace contam {
 
     void LevelImpl::read(Reader& input) {
       setNr(input.read<int>());
-      setRefht(input.readNumber<std::string>());
-      setDelht(input.readNumber<std::string>());
+      setRefht(input.readNumber<double>());
+      setDelht(input.readNumber<double>());
       int nicon = input.read<int>();
       setU_rfht(input.read<int>());
       setU_dlht(input.read<int>());
@@ -3003,29 +3010,29 @@ namespace contam {
     }
 
     double LevelImpl::refht() const {
-      return openstudio::string_conversions::to<double>(m_refht);
+      return m_refht.value();
     }
 
     bool LevelImpl::setRefht(const double refht) {
-      m_refht = openstudio::string_conversions::number(refht);
+      m_refht = PRJFLOAT(refht);
       return true;
     }
 
     bool LevelImpl::setRefht(const std::string& refht) {
-      return assign_if_valid<double>(refht, m_refht);
+      return m_refht.assign(refht);
     }
 
     double LevelImpl::delht() const {
-      return openstudio::string_conversions::to<double>(m_delht);
+      return m_delht.value();
     }
 
     bool LevelImpl::setDelht(const double delht) {
-      m_delht = openstudio::string_conversions::number(delht);
+      m_delht = PRJFLOAT(delht);
       return true;
     }
 
     bool LevelImpl::setDelht(const std::string& delht) {
-      return assign_if_valid<double>(delht, m_delht);
+      return m_delht.assign(delht);
     }
 
     int LevelImpl::u_rfht() const {
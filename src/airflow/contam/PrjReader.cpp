@@ -26,10 +26,8 @@
 *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
 *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ***********************************************************************************************************************/
-
 #include "PrjReader.hpp"
-#include <iostream>
-#include <stdlib.h>
+#include <charconv>
 
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/FilesystemHelpers.hpp"
@@ -38,148 +36,142 @@
 namespace openstudio {
 namespace contam {
 
-  Reader::Reader(openstudio::filesystem::ifstream& file) : m_stream(openstudio::filesystem::read_as_string(file)), m_lineNumber(0) {}
+  static bool isSeparator(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+  }
 
-  Reader::Reader(const std::string& string, int starting) : m_lineNumber(starting) {
-    m_stream.str(string);
+  template <typename T>
+  static bool parseInteger(std::string_view token, T& value) {
+    if (!token.empty() && token.front() == '+') {
+      token.remove_prefix(1);
+    }
+    // Like std::stoi, trailing characters after the number are ignored
+    return std::from_chars(token.data(), token.data() + token.size(), value).ec == std::errc();
   }
 
-  double Reader::readDouble() {
-    const auto string = readString();
-    try {
-      return openstudio::string_conversions::to<double>(string);
-    } catch (const std::bad_cast&) {
-      LOG_AND_THROW("Floating point (double) conversion error at line " << m_lineNumber << " for \"" << string << "\"");
+  Reader::Reader(openstudio::filesystem::ifstream& file)
+    : m_buffer(openstudio::filesystem::read_as_string(file)), m_position(0), m_lineNumber(0) {}
+
+  Reader::Reader(const std::string& string, int starting) : m_buffer(string), m_position(0), m_lineNumber(starting) {}
+
+  std::string_view Reader::nextLine() {
+    if (m_position >= m_buffer.size()) {
+      LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
+    }
+    std::size_t end = m_buffer.find('\n', m_position);
+    if (end == std::string::npos) {
+      end = m_buffer.size();
     }
+    std::string_view line(m_buffer.data() + m_position, end - m_position);
+    m_position = end + 1;
+    m_lineNumber++;
+    return line;
   }
 
-  std::string Reader::readString() {
+  std::string_view Reader::nextDataLine() {
+    std::string_view input = nextLine();
+    while (!input.empty() && input[0] == '!') {
+      input = nextLine();
+    }
+    return input;
+  }
+
+  std::string_view Reader::readToken() {
     while (true) {
-      while (m_entries.empty()) {
-        std::string input;
-        std::getline(m_stream, input);
-        LOG(Debug, "Line read: " << input);
-        if (!m_stream) {
-          LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-        }
-        m_lineNumber++;
-        while (input[0] == '!') {
-          std::getline(m_stream, input);
-          LOG(Debug, "Line read: " << input);
-          if (!m_stream) {
-            LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-          }
-          m_lineNumber++;
-        }
-
-        std::vector<std::string> strs;
-        boost::split(strs, input, boost::is_any_of(" "));
-
-        m_entries.clear();
-        for (const auto& s : strs) {
-          std::string s2 = boost::replace_all_copy(s, " ", "");
-          boost::replace_all(s2, "\r", "");
-          boost::replace_all(s2, "\n", "");
-          boost::replace_all(s2, "\t", "");
-          if (!s2.empty()) {
-            m_entries.push_back(s2);
-          }
-        }
+      std::size_t start = 0;
+      while (start < m_entries.size() && isSeparator(m_entries[start])) {
+        ++start;
       }
-      std::string out = m_entries.front();
-      m_entries.pop_front();
+      if (start == m_entries.size()) {
+        m_entries = nextDataLine();
+        continue;
+      }
+      std::size_t end = start;
+      while (end < m_entries.size() && !isSeparator(m_entries[end])) {
+        ++end;
+      }
+      std::string_view out = m_entries.substr(start, end - start);
       if (out[0] == '!') {
-        m_entries.clear();
+        // The rest of the line is a comment
+        m_entries = std::string_view();
       } else {
-        LOG(Debug, "String return: " << out);
+        m_entries.remove_prefix(end);
         return out;
       }
     }
   }
 
+  double Reader::readDouble() {
+    const std::string_view token = readToken();
+    auto value = PrjFloat::parse(token);
+    if (!value) {
+      LOG_AND_THROW("Floating point (double) conversion error at line " << m_lineNumber << " for \"" << token << "\"");
+    }
+    return value->value();
+  }
+
+  std::string Reader::readString() {
+    return std::string(readToken());
+  }
+
   int Reader::readInt() {
-    std::string string = readString();
+    const std::string_view token = readToken();
     int value = 0;
-    try {
-      value = std::stoi(string);
-    } catch (const std::exception&) {
-      LOG_AND_THROW("Integer conversion error at line " << m_lineNumber << " for \"" << string << "\"");
+    if (!parseInteger(token, value)) {
+      LOG_AND_THROW("Integer conversion error at line " << m_lineNumber << " for \"" << token << "\"");
     }
     return value;
   }
 
   unsigned int Reader::readUInt() {
-    std::string string = readString();
-    int value = 0;
-    try {
-      value = std::stoul(string);
-    } catch (const std::exception&) {
-      LOG_AND_THROW("Unsigned Integer conversion error at line " << m_lineNumber << " for \"" << string << "\"");
+    const std::string_view token = readToken();
+    unsigned int value = 0;
+    if (!parseInteger(token, value)) {
+      LOG_AND_THROW("Unsigned Integer conversion error at line " << m_lineNumber << " for \"" << token << "\"");
     }
     return value;
   }
 
   std::string Reader::readLine() {
     /* Dump any other input */
-    if (!m_entries.empty()) {
-      m_entries.clear();
-    }
-    std::string input;
-    std::getline(m_stream, input);
-    LOG(Debug, "Line read: " << input);
-    if (!m_stream) {
-      LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-    }
-    m_lineNumber++;
-    while (input[0] == '!') {
-      std::getline(m_stream, input);
-      LOG(Debug, "Line read: " << input);
-      if (!m_stream) {
-        LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-      }
-      m_lineNumber++;
-    }
-    return input;
+    m_entries = std::string_view();
+    return std::string(nextDataLine());
   }
 
   void Reader::read999() {
-    std::string input = readLine();
-    if (!boost::starts_with(input, "-999")) {
+    m_entries = std::string_view();
+    if (nextDataLine().substr(0, 4) != "-999") {
       LOG_AND_THROW("Failed to read -999 at line " << m_lineNumber);
     }
   }
 
   void Reader::read999(std::string mesg) {
-    std::string input = readLine();
-    if (!boost::starts_with(input, "-999")) {
+    m_entries = std::string_view();
+    if (nextDataLine().substr(0, 4) != "-999") {
       LOG_AND_THROW(mesg << " at line " << m_lineNumber);
     }
   }
 
   void Reader::readEnd() {
-    std::string input = readLine();
-    if (!boost::starts_with(input, "* end project file.")) {
+    m_entries = std::string_view();
+    std::string_view end("* end project file.");
+    if (nextDataLine().substr(0, end.size()) != end) {
       LOG_AND_THROW("Failed to read file end at line " << m_lineNumber);
     }
   }
 
   void Reader::skipSection() {
-    readSection();
+    while (nextLine().substr(0, 4) != "-999") {
+    }
   }
 
   std::string Reader::readSection() {
-    std::string section;
-    while (true) {
-      std::string input;
-      std::getline(m_stream, input);
-      if (!m_stream) {
-        LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-      }
-      m_lineNumber++;
-      section += std::string(input + '\n');
-      if (input.find("-999") == 0) {
-        break;
-      }
+    const std::size_t start = m_position;
+    while (nextLine().substr(0, 4) != "-999") {
+    }
+    std::string section = m_buffer.substr(start, m_position - start);
+    if (section.empty() || section.back() != '\n') {
+      section += '\n';
     }
     return section;
   }
@@ -187,6 +179,7 @@ namespace contam {
   std::vector<int> Reader::readIntVector(bool terminated) {
     int n = readInt();
     std::vector<int> vector;
+    vector.reserve(n > 0 ? n : 0);
     for (int i = 0; i < n; i++) {
       vector.push_back(readInt());
     }
@@ -218,16 +211,22 @@ namespace contam {
 
   template <>
   double Reader::readNumber<double>() {
-    return readInt();
+    return readDouble();
   }
 
   template <>
-  std::string Reader::readNumber<std::string>() {
-    std::string string = readString();
-    if (!openstudio::contam::is_valid<double>(string)) {
-      LOG_AND_THROW("Invalid number \"" << string << "\" on line " << m_lineNumber);
+  PRJFLOAT Reader::readNumber<PRJFLOAT>() {
+    const std::string_view token = readToken();
+    auto value = PrjFloat::parse(token);
+    if (!value) {
+      LOG_AND_THROW("Invalid number \"" << token << "\" on line " << m_lineNumber);
     }
-    return string;
+    return value.get();
+  }
+
+  template <>
+  std::string Reader::readNumber<std::string>() {
+    return readNumber<PRJFLOAT>().toString();
   }
 
 }  // namespace contam
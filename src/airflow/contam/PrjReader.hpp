@@ -30,7 +30,7 @@
 #ifndef AIRFLOW_CONTAM_PRJREADER_HPP
 #define AIRFLOW_CONTAM_PRJREADER_HPP
 
-#include <sstream>
+#include <string_view>
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/Filesystem.hpp"
 
@@ -80,12 +80,15 @@ namespace contam {
     T readNumber();
 
    private:
-    std::string readStdString();
-    std::string readLineString();
+    // Tokens and lines are views into m_buffer, nothing is copied until a string is returned
+    std::string_view readToken();
+    std::string_view nextLine();
+    std::string_view nextDataLine();
 
-    std::stringstream m_stream;
+    std::string m_buffer;
+    std::size_t m_position;
     int m_lineNumber;
-    std::list<std::string> m_entries;
+    std::string_view m_entries;  // the unread remainder of the current line
 
     REGISTER_LOGGER("openstudio.contam.Reader");
   };
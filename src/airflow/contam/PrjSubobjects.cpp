@@ -228,11 +228,11 @@ namespace contam {
   }
 
   void FanDataPoint::setDefaults() {
-    m_mF = PRJFLOAT("0.0");
+    m_mF = PRJFLOAT(0.0);
     m_u_mF = 0;
-    m_dP = PRJFLOAT("0.0");
+    m_dP = PRJFLOAT(0.0);
     m_u_dP = 0;
-    m_rP = PRJFLOAT("0.0");
+    m_rP = PRJFLOAT(0.0);
     m_u_rP = 0;
   }
 
@@ -261,11 +261,11 @@ namespace contam {
   }
 
   void FanDataPoint::read(Reader& input) {
-    setMF(input.readNumber<std::string>());
+    setMF(input.readNumber<double>());
     setU_mF(input.read<int>());
-    setDP(input.readNumber<std::string>());
+    setDP(input.readNumber<double>());
     setU_dP(input.read<int>());
-    setRP(input.readNumber<std::string>());
+    setRP(input.readNumber<double>());
     setU_rP(input.read<int>());
   }
 
@@ -277,16 +277,16 @@ namespace contam {
   }
 
   double FanDataPoint::mF() const {
-    return openstudio::string_conversions::to<double>(m_mF);
+    return m_mF.value();
   }
 
   bool FanDataPoint::setMF(const double mF) {
-    m_mF = openstudio::string_conversions::number(mF);
+    m_mF = PRJFLOAT(mF);
     return true;
   }
 
   bool FanDataPoint::setMF(const std::string& mF) {
-    return assign_if_valid<double>(mF, m_mF);
+    return m_mF.assign(mF);
   }
 
   int FanDataPoint::u_mF() const {
@@ -298,16 +298,16 @@ namespace contam {
   }
 
   double FanDataPoint::dP() const {
-    return openstudio::string_conversions::to<double>(m_dP);
+    return m_dP.value();
   }
 
   bool FanDataPoint::setDP(const double dP) {
-    m_dP = openstudio::string_conversions::number(dP);
+    m_dP = PRJFLOAT(dP);
     return true;
   }
 
   bool FanDataPoint::setDP(const std::string& dP) {
-    return assign_if_valid<double>(dP, m_dP);
+    return m_dP.assign(dP);
   }
 
   int FanDataPoint::u_dP() const {
@@ -319,16 +319,16 @@ namespace contam {
   }
 
   double FanDataPoint::rP() const {
-    return openstudio::string_conversions::to<double>(m_rP);
+    return m_rP.value();
   }
 
   bool FanDataPoint::setRP(const double rP) {
-    m_rP = openstudio::string_conversions::number(rP);
+    m_rP = PRJFLOAT(rP);
     return true;
   }
 
   bool FanDataPoint::setRP(const std::string& rP) {
-    return assign_if_valid<double>(rP, m_rP);
+    return m_rP.assign(rP);
   }
 
   int FanDataPoint::u_rP() const {
@@ -340,8 +340,8 @@ namespace contam {
   }
 
   void XyDataPoint::setDefaults() {
-    m_x = PRJFLOAT("0.0");
-    m_y = PRJFLOAT("0.0");
+    m_x = PRJFLOAT(0.0);
+    m_y = PRJFLOAT(0.0);
   }
 
   XyDataPoint::XyDataPoint() {
@@ -361,8 +361,8 @@ namespace contam {
   }
 
   void XyDataPoint::read(Reader& input) {
-    setX(input.readNumber<std::string>());
-    setY(input.readNumber<std::string>());
+    setX(input.readNumber<double>());
+    setY(input.readNumber<double>());
   }
 
   std::string XyDataPoint::write() {
@@ -372,34 +372,34 @@ namespace contam {
   }
 
   double XyDataPoint::x() const {
-    return openstudio::string_conversions::to<double>(m_x);
+    return m_x.value();
   }
 
   bool XyDataPoint::setX(const double x) {
-    m_x = openstudio::string_conversions::number(x);
+    m_x = PRJFLOAT(x);
     return true;
   }
 
   bool XyDataPoint::setX(const std::string& x) {
-    return assign_if_valid<double>(x, m_x);
+    return m_x.assign(x);
   }
 
   double XyDataPoint::y() const {
-    return openstudio::string_conversions::to<double>(m_y);
+    return m_y.value();
   }
 
   bool XyDataPoint::setY(const double y) {
-    m_y = openstudio::string_conversions::number(y);
+    m_y = PRJFLOAT(y);
     return true;
   }
 
   bool XyDataPoint::setY(const std::string& y) {
-    return assign_if_valid<double>(y, m_y);
+    return m_y.assign(y);
   }
 
   void AirflowSubelementData::setDefaults() {
     m_nr = 0;
-    m_relHt = PRJFLOAT("0.0");
+    m_relHt = PRJFLOAT(0.0);
     m_filt = 0;
   }
 
@@ -423,7 +423,7 @@ namespace contam {
 
   void AirflowSubelementData::read(Reader& input) {
     setNr(input.read<int>());
-    setRelHt(input.readNumber<std::string>());
+    setRelHt(input.readNumber<double>());
     setFilt(input.read<int>());
   }
 
@@ -442,16 +442,16 @@ namespace contam {
   }
 
   double AirflowSubelementData::relHt() const {
-    return openstudio::string_conversions::to<double>(m_relHt);
+    return m_relHt.value();
   }
 
   bool AirflowSubelementData::setRelHt(const double relHt) {
-    m_relHt = openstudio::string_conversions::number(relHt);
+    m_relHt = PRJFLOAT(relHt);
     return true;
   }
 
   bool AirflowSubelementData::setRelHt(const std::string& relHt) {
-    return assign_if_valid<double>(relHt, m_relHt);
+    return m_relHt.assign(relHt);
   }
 
   int AirflowSubelementData::filt() const {
@@ -463,8 +463,8 @@ namespace contam {
   }
 
   void PressureCoefficientPoint::setDefaults() {
-    m_azm = PRJFLOAT("0.0");
-    m_coef = PRJFLOAT("0.0");
+    m_azm = PRJFLOAT(0.0);
+    m_coef = PRJFLOAT(0.0);
   }
 
   PressureCoefficientPoint::PressureCoefficientPoint() {
@@ -484,8 +484,8 @@ namespace contam {
   }
 
   void PressureCoefficientPoint::read(Reader& input) {
-    setAzm(input.readNumber<std::string>());
-    setCoef(input.readNumber<std::string>());
+    setAzm(input.readNumber<double>());
+    setCoef(input.readNumber<double>());
   }
 
   std::string PressureCoefficientPoint::write() {
@@ -495,34 +495,34 @@ namespace contam {
   }
 
   double PressureCoefficientPoint::azm() const {
-    return openstudio::string_conversions::to<double>(m_azm);
+    return m_azm.value();
   }
 
   bool PressureCoefficientPoint::setAzm(const double azm) {
-    m_azm = openstudio::string_conversions::number(azm);
+    m_azm = PRJFLOAT(azm);
     return true;
   }
 
   bool PressureCoefficientPoint::setAzm(const std::string& azm) {
-    return assign_if_valid<double>(azm, m_azm);
+    return m_azm.assign(azm);
   }
 
   double PressureCoefficientPoint::coef() const {
-    return openstudio::string_conversions::to<double>(m_coef);
+    return m_coef.value();
   }
 
   bool PressureCoefficientPoint::setCoef(const double coef) {
-    m_coef = openstudio::string_conversions::number(coef);
+    m_coef = PRJFLOAT(coef);
     return true;
   }
 
   bool PressureCoefficientPoint::setCoef(const std::string& coef) {
-    return assign_if_valid<double>(coef, m_coef);
+    return m_coef.assign(coef);
   }
 
   void SchedulePoint::setDefaults() {
     m_time = std::string("00:00:00");
-    m_ctrl = PRJFLOAT("0.0");
+    m_ctrl = PRJFLOAT(0.0);
   }
 
   SchedulePoint::SchedulePoint() {
@@ -543,7 +543,7 @@ namespace contam {
 
   void SchedulePoint::read(Reader& input) {
     setTime(input.readString());
-    setCtrl(input.readNumber<std::string>());
+    setCtrl(input.readNumber<double>());
   }
 
   std::string SchedulePoint::write() {
@@ -561,16 +561,16 @@ namespace contam {
   }
 
   double SchedulePoint::ctrl() const {
-    return openstudio::string_conversions::to<double>(m_ctrl);
+    return m_ctrl.value();
   }
 
   bool SchedulePoint::setCtrl(const double ctrl) {
-    m_ctrl = openstudio::string_conversions::number(ctrl);
+    m_ctrl = PRJFLOAT(ctrl);
     return true;
   }
 
   bool SchedulePoint::setCtrl(const std::string& ctrl) {
-    return assign_if_valid<double>(ctrl, m_ctrl);
+    return m_ctrl.assign(ctrl);
   }
 
 }  // namespace contam
@@ -34,11 +34,11 @@ namespace contam {
   namespace detail {
 
     void WeatherDataImpl::setDefaults() {
-      m_Tambt = PRJFLOAT("0.0");
-      m_barpres = PRJFLOAT("0.0");
-      m_windspd = PRJFLOAT("0.0");
-      m_winddir = PRJFLOAT("0.0");
-      m_relhum = PRJFLOAT("0.0");
+      m_Tambt = PRJFLOAT(0.0);
+      m_barpres = PRJFLOAT(0.0);
+      m_windspd = PRJFLOAT(0.0);
+      m_winddir = PRJFLOAT(0.0);
+      m_relhum = PRJFLOAT(0.0);
       m_daytyp = 0;
       m_uTa = 0;
       m_ubP = 0;
@@ -81,11 +81,11 @@ namespace contam {
     }
 
     void WeatherDataImpl::read(Reader& input) {
-      setTambt(input.readNumber<std::string>());
-      setBarpres(input.readNumber<std::string>());
-      setWindspd(input.readNumber<std::string>());
-      setWinddir(input.readNumber<std::string>());
-      setRelhum(input.readNumber<std::string>());
+      setTambt(input.readNumber<double>());
+      setBarpres(input.readNumber<double>());
+      setWindspd(input.readNumber<double>());
+      setWinddir(input.readNumber<double>());
+      setRelhum(input.readNumber<double>());
       setDaytyp(input.read<int>());
       setUTa(input.read<int>());
       setUbP(input.read<int>());
@@ -102,68 +102,68 @@ namespace contam {
     }
 
     double WeatherDataImpl::Tambt() const {
-      return openstudio::string_conversions::to<double>(m_Tambt);
+      return m_Tambt.value();
     }
 
     bool WeatherDataImpl::setTambt(const double Tambt) {
-      m_Tambt = openstudio::string_conversions::number(Tambt);
+      m_Tambt = PRJFLOAT(Tambt);
       return true;
     }
 
     bool WeatherDataImpl::setTambt(const std::string& Tambt) {
-      return assign_if_valid<double>(Tambt, m_Tambt);
+      return m_Tambt.assign(Tambt);
     }
 
     double WeatherDataImpl::barpres() const {
-      return openstudio::string_conversions::to<double>(m_barpres);
+      return m_barpres.value();
     }
 
     bool WeatherDataImpl::setBarpres(const double barpres) {
-      m_barpres = openstudio::string_conversions::number(barpres);
+      m_barpres = PRJFLOAT(barpres);
       return true;
     }
 
     bool WeatherDataImpl::setBarpres(const std::string& barpres) {
-      return assign_if_valid<double>(barpres, m_barpres);
+      return m_barpres.assign(barpres);
     }
 
     double WeatherDataImpl::windspd() const {
-      return openstudio::string_conversions::to<double>(m_windspd);
+      return m_windspd.value();
     }
 
     bool WeatherDataImpl::setWindspd(const double windspd) {
-      m_windspd = openstudio::string_conversions::number(windspd);
+      m_windspd = PRJFLOAT(windspd);
       return true;
     }
 
     bool WeatherDataImpl::setWindspd(const std::string& windspd) {
-      return assign_if_valid<double>(windspd, m_windspd);
+      return m_windspd.assign(windspd);
     }
 
     double WeatherDataImpl::winddir() const {
-      return openstudio::string_conversions::to<double>(m_winddir);
+      return m_winddir.value();
     }
 
     bool WeatherDataImpl::setWinddir(const double winddir) {
-      m_winddir = openstudio::string_conversions::number(winddir);
+      m_winddir = PRJFLOAT(winddir);
       return true;
     }
 
     bool WeatherDataImpl::setWinddir(const std::string& winddir) {
-      return assign_if_valid<double>(winddir, m_winddir);
+      return m_winddir.assign(winddir);
     }
 
     double WeatherDataImpl::relhum() const {
-      return openstudio::string_conversions::to<double>(m_relhum);
+      return m_relhum.value();
     }
 
     bool WeatherDataImpl::setRelhum(const double relhum) {
-      m_relhum = openstudio::string_conversions::number(relhum);
+      m_relhum = PRJFLOAT(relhum);
       return true;
     }
 
     bool WeatherDataImpl::setRelhum(const std::string& relhum) {
-      return assign_if_valid<double>(relhum, m_relhum);
+      return m_relhum.assign(relhum);
     }
 
     int WeatherDataImpl::daytyp() const {
@@ -29,8 +29,12 @@
 
 #include "SimFile.hpp"
 
-#include <boost/algorithm/string.hpp>
-#include <boost/algorithm/string/classification.hpp>
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/StringHelpers.hpp"
+
+#include <array>
+#include <charconv>
+#include <type_traits>
 
 namespace openstudio {
 namespace contam {
@@ -44,165 +48,252 @@ namespace contam {
     return -1;
   }
 
-  SimFile::SimFile(openstudio::path path) {
-    m_hasLfr = false;
-    m_hasNfr = false;
-    m_hasNcr = false;
-    // For now, we need to cheat and assume that the .lfr etc. actually exist
-    // This means that simread has to have been run for this to work
-    openstudio::path lfrPath = path.replace_extension(openstudio::toPath("lfr").string());
-    m_hasLfr = readLfr(openstudio::toString(lfrPath));
-    openstudio::path nfrPath = path.replace_extension(openstudio::toPath("nfr").string());
-    m_hasNfr = readNfr(openstudio::toString(nfrPath));
-  }
-
-  bool SimFile::computeDateTimes(const std::vector<std::string>& day, const std::vector<std::string>& time) {
-    int n = std::min((int)day.size(), (int)time.size());
-    for (int i = 0; i < n; i++) {
-      std::vector<std::string> split;
-      boost::split(split, day[i], boost::is_any_of("/"));
-      if (split.size() != 2) {
-        return false;
-      }
-
-      unsigned month;
-      unsigned dayOfMonth;
-      try {
-        month = std::stoul(split[0]);
-        dayOfMonth = std::stoul(split[1]);
-        // DLM: what about month == 0?
-        if (month > 12) {
+  // Calls lineFunction on every non-empty line of the file, the file is read a block at a time so that large
+  // result files are never held in memory as text. Stops and returns false if lineFunction returns false.
+  template <typename LineFunction>
+  static bool forEachLine(openstudio::filesystem::ifstream& file, LineFunction lineFunction) {
+    constexpr std::size_t blockSize = 1 << 20;
+    std::string buffer;
+    std::string block(blockSize, '\0');
+    while (file) {
+      file.read(&block[0], blockSize);
+      buffer.append(block, 0, file.gcount());
+      std::size_t start = 0;
+      std::size_t end = buffer.find('\n');
+      while (end != std::string::npos) {
+        std::string_view line(buffer.data() + start, end - start);
+        if (!line.empty() && line.back() == '\r') {
+          line.remove_suffix(1);
+        }
+        if (!line.empty() && !lineFunction(line)) {
           return false;
         }
+        start = end + 1;
+        end = buffer.find('\n', start);
+      }
+      buffer.erase(0, start);
+    }
+    std::string_view line(buffer);
+    if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
+    return line.empty() || lineFunction(line);
+  }
 
-        m_dateTimes.push_back(DateTime(Date(monthOfYear(month), dayOfMonth), Time(time[i])));
-      } catch (const std::exception&) {
-        return false;
+  // Splits a tab separated line into at most fields.size() fields, returns the number of fields in the line
+  template <std::size_t N>
+  static std::size_t splitTabs(std::string_view line, std::array<std::string_view, N>& fields) {
+    std::size_t count = 0;
+    while (true) {
+      std::size_t tab = line.find('\t');
+      if (count < N) {
+        fields[count] = line.substr(0, tab);
       }
+      ++count;
+      if (tab == std::string_view::npos) {
+        return count;
+      }
+      line.remove_prefix(tab + 1);
     }
-    return true;
   }
 
-  void SimFile::clearLfr() {
-    m_dP.clear();
-    m_F0.clear();
-    m_F1.clear();
+  static std::string_view trim(std::string_view field) {
+    while (!field.empty() && field.front() == ' ') {
+      field.remove_prefix(1);
+    }
+    while (!field.empty() && field.back() == ' ') {
+      field.remove_suffix(1);
+    }
+    return field;
   }
 
-  bool SimFile::readLfr(const std::string& fileName) {
-    clearLfr();
-    std::vector<std::string> day;
-    std::vector<std::string> time;
-    openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-    if (!file.is_open()) {
-      LOG(Error, "Failed to open LFR file '" << fileName << "'");
-      return false;
+  template <typename T>
+  static bool parseField(std::string_view field, T& value) {
+    field = trim(field);
+    if (!field.empty() && field.front() == '+') {
+      field.remove_prefix(1);
     }
-    std::map<int, int> nrMap;
-    // Read the header
-    std::string headerstr;
-    std::getline(file, headerstr);
-    std::string header = headerstr;
-    if (header.empty()) {
-      LOG(Error, "No data in LFR file '" << fileName << "'");
-      return false;
+    const char* last = field.data() + field.size();
+    if constexpr (std::is_floating_point_v<T>) {
+      // std::from_chars for doubles is missing from some of the standard libraries we support
+      return openstudio::string_conversions::parseDouble(field.data(), last, value) == last;
+    } else {
+      auto [ptr, ec] = std::from_chars(field.data(), last, value);
+      return ec == std::errc() && ptr == last;
     }
-    std::vector<std::string> row;
-    boost::split(row, header, boost::is_any_of("\t"));
-    unsigned ncols = 6;
-    if (row.size() != ncols) {
-      LOG(Error, "LFR file has " << row.size() << " columns, not the expected " << ncols);
-      return false;
+  }
+
+  static boost::optional<DateTime> parseDateTime(std::string_view day, std::string_view time) {
+    std::size_t slash = day.find('/');
+    if (slash == std::string_view::npos) {
+      return boost::none;
+    }
+    unsigned month = 0;
+    unsigned dayOfMonth = 0;
+    if (!parseField(day.substr(0, slash), month) || !parseField(day.substr(slash + 1), dayOfMonth)) {
+      return boost::none;
+    }
+    // DLM: what about month == 0?
+    if (month > 12) {
+      return boost::none;
+    }
+    try {
+      return DateTime(Date(monthOfYear(month), dayOfMonth), Time(std::string(trim(time))));
+    } catch (const std::exception&) {
+      return boost::none;
     }
-    // Read the data
-    while (file.good()) {
-      std::string linestr;
-      std::getline(file, linestr);
-      std::string line = linestr;
-      std::vector<std::string> row;
-      boost::split(row, line, boost::is_any_of("\t"));
-      if (row.size() != ncols) {
-        clearLfr();
-        LOG(Error, "LFR data line has " << row.size() << " columns, not the expected " << ncols);
+  }
+
+  // Reads an LFR or NFR file in a single pass. Both have day, time, number and three value columns, one row per path
+  // or node per time step. The values are stored in one vector per path or node, in the order that the numbers appear
+  // in the first time step. Every time step must have exactly one row for each of these numbers.
+  struct ResultTable
+  {
+    std::vector<int> nrs;
+    std::array<std::vector<std::vector<double>>, 3> values;
+    std::vector<DateTime> dateTimes;
+  };
+
+  static bool readResultTable(openstudio::filesystem::ifstream& file, const std::string& kind, std::size_t ncols, std::size_t altNcols,
+                              const std::array<const char*, 4>& labels, bool allowBadValueForNrZero, ResultTable& table) {
+    std::vector<int> indexOfNr;
+    std::string lastDay;
+    std::string lastTime;
+    std::size_t ntimes = 0;
+    std::size_t rowsInStep = 0;
+    bool header = true;
+    auto stepIsComplete = [&]() {
+      if (rowsInStep != table.nrs.size()) {
+        LOG_FREE(Error, "openstudio.contam.SimFile",
+                 kind << " time step " << lastDay << " " << lastTime << " has " << rowsInStep << " rows, expected " << table.nrs.size());
         return false;
       }
-      if (!time.empty()) {
-        if (time[time.size() - 1] != row[1]) {
-          day.push_back(row[0]);
-          time.push_back(row[1]);
+      return true;
+    };
+    bool ok = forEachLine(file, [&](std::string_view line) {
+      std::array<std::string_view, 8> row;
+      std::size_t count = splitTabs(line, row);
+      if (count != ncols && count != altNcols) {
+        if (header) {
+          LOG_FREE(Error, "openstudio.contam.SimFile", kind << " file has " << count << " columns, not the expected " << ncols);
+        } else {
+          LOG_FREE(Error, "openstudio.contam.SimFile", kind << " data line has " << count << " columns, not the expected " << ncols);
         }
-      } else {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
-      }
-
-      int nr = 0;
-      try {
-        nr = std::stoi(row[2]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid link number '" << row[2] << "'");
         return false;
       }
-      if (nrMap.find(nr) == nrMap.end()) {
-        int sz = nrMap.size();
-        nrMap[nr] = sz;
-        m_dP.resize(sz + 1);
-        m_F0.resize(sz + 1);
-        m_F1.resize(sz + 1);
+      if (header) {
+        header = false;
+        return true;
       }
-      double dP = 0;
-      try {
-        dP = std::stod(row[3]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid pressure difference '" << row[3] << "'");
-        return false;
+      if (ntimes == 0 || row[0] != lastDay || row[1] != lastTime) {
+        if (ntimes > 0 && !stepIsComplete()) {
+          return false;
+        }
+        boost::optional<DateTime> dateTime = parseDateTime(row[0], row[1]);
+        if (!dateTime) {
+          LOG_FREE(Error, "openstudio.contam.SimFile", "Failed to compute date and time objects from " << kind << " input");
+          return false;
+        }
+        table.dateTimes.push_back(dateTime.get());
+        lastDay = std::string(row[0]);
+        lastTime = std::string(row[1]);
+        ++ntimes;
+        rowsInStep = 0;
       }
+      ++rowsInStep;
 
-      double F0 = 0;
-      try {
-        F0 = std::stod(row[4]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid flow 0 '" << row[4] << "'");
+      int nr = 0;
+      if (!parseField(row[2], nr) || nr < 0) {
+        LOG_FREE(Error, "openstudio.contam.SimFile", "Invalid " << labels[0] << " number '" << row[2] << "'");
         return false;
       }
-
-      double F1 = 0;
-      try {
-        F1 = std::stod(row[5]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid flow 1 '" << row[5] << "'");
-        return false;
+      std::size_t column = 0;
+      if ((std::size_t)nr < indexOfNr.size() && indexOfNr[nr] >= 0) {
+        column = indexOfNr[nr];
+        if (table.values[0][column].size() == ntimes) {
+          LOG_FREE(Error, "openstudio.contam.SimFile",
+                   labels[0] << " " << nr << " appears more than once in " << kind << " time step " << lastDay << " " << lastTime);
+          return false;
+        }
+      } else {
+        if (ntimes > 1) {
+          LOG_FREE(Error, "openstudio.contam.SimFile", labels[0] << " " << nr << " is not in the first time step");
+          return false;
+        }
+        if ((std::size_t)nr >= indexOfNr.size()) {
+          indexOfNr.resize(nr + 1, -1);
+        }
+        column = table.nrs.size();
+        indexOfNr[nr] = column;
+        table.nrs.push_back(nr);
+        for (auto& values : table.values) {
+          values.emplace_back();
+        }
       }
 
-      m_dP[nrMap[nr]].push_back(dP);
-      m_F0[nrMap[nr]].push_back(F0);
-      m_F1[nrMap[nr]].push_back(F1);
-    }
-    // Unwind the zone number map;
-    std::vector<int> keys;
-    for (const auto& pair : nrMap) {
-      keys.push_back(pair.first);
+      for (std::size_t i = 0; i < 3; ++i) {
+        double value = 0.0;
+        if (!parseField(row[3 + i], value)) {
+          if (i == 2 && allowBadValueForNrZero && nr == 0) {
+            value = 0.0;
+          } else {
+            LOG_FREE(Error, "openstudio.contam.SimFile", "Invalid " << labels[1 + i] << " '" << row[3 + i] << "'");
+            return false;
+          }
+        }
+        table.values[i][column].push_back(value);
+      }
+      return true;
+    });
+    if (ok && header) {
+      LOG_FREE(Error, "openstudio.contam.SimFile", "No data in " << kind << " file");
+      return false;
     }
-    m_pathNr.resize(keys.size());
-    for (std::vector<int>::size_type i = 0; i < keys.size(); ++i) {
-      m_pathNr[nrMap[keys[i]]] = keys[i];
+    // The last time step is not followed by another one that would have checked it
+    return ok && (ntimes == 0 || stepIsComplete());
+  }
+
+  SimFile::SimFile(openstudio::path path) {
+    m_hasLfr = false;
+    m_hasNfr = false;
+    m_hasNcr = false;
+    // For now, we need to cheat and assume that the .lfr etc. actually exist
+    // This means that simread has to have been run for this to work
+    openstudio::path lfrPath = path.replace_extension(openstudio::toPath("lfr").string());
+    m_hasLfr = readLfr(openstudio::toString(lfrPath));
+    openstudio::path nfrPath = path.replace_extension(openstudio::toPath("nfr").string());
+    m_hasNfr = readNfr(openstudio::toString(nfrPath));
+  }
+
+  void SimFile::clearLfr() {
+    m_pathNr.clear();
+    m_dP.clear();
+    m_F0.clear();
+    m_F1.clear();
+  }
+
+  bool SimFile::readLfr(const std::string& fileName) {
+    clearLfr();
+    openstudio::filesystem::ifstream file(openstudio::toPath(fileName), std::ios_base::binary);
+    if (!file.is_open()) {
+      LOG(Error, "Failed to open LFR file '" << fileName << "'");
+      return false;
     }
-    file.close();
-    // Compute the required date/time objects - this needs to be moved elsewhere if the NCR and NFR are also read
-    if (!computeDateTimes(day, time)) {
-      clearLfr();
-      m_dateTimes.clear();
-      LOG(Error, "Failed to compute date and time objects from LFR input");
+    ResultTable table;
+    if (!readResultTable(file, "LFR", 6, 6, {"link", "pressure difference", "flow 0", "flow 1"}, false, table)) {
+      LOG(Error, "Failed to read LFR file '" << fileName << "'");
       return false;
     }
+    m_pathNr = std::move(table.nrs);
+    m_dP = std::move(table.values[0]);
+    m_F0 = std::move(table.values[1]);
+    m_F1 = std::move(table.values[2]);
+    m_dateTimes = std::move(table.dateTimes);
     return true;
   }
 
   void SimFile::clearNfr() {
+    m_nodeNr.clear();
     m_T.clear();
     m_P.clear();
     m_D.clear();
@@ -210,206 +301,130 @@ namespace contam {
 
   bool SimFile::readNfr(const std::string& fileName) {
     clearNfr();
-    std::vector<std::string> day;
-    std::vector<std::string> time;
-    openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-    if (file.is_open()) {
+    openstudio::filesystem::ifstream file(openstudio::toPath(fileName), std::ios_base::binary);
+    if (!file.is_open()) {
       LOG(Error, "Failed to open NFR file '" << fileName << "'");
       return false;
     }
-
-    std::map<int, int> nrMap;
-    // Read the header
-    std::string headerstr;
-    std::getline(file, headerstr);
-    std::string header = headerstr;
-    if (header.empty()) {
-      LOG(Error, "No data in LFR file '" << fileName << "'");
+    ResultTable table;
+    if (!readResultTable(file, "NFR", 6, 8, {"node", "temperature", "pressure", "density"}, true, table)) {
+      LOG(Error, "Failed to read NFR file '" << fileName << "'");
       return false;
     }
-    std::vector<std::string> row;
-    boost::split(row, header, boost::is_any_of("\t"));
-    unsigned ncols = 6;
-    if (row.size() != ncols && row.size() != ncols + 2) {
-      LOG(Error, "NFR file has " << row.size() << " columns, not the expected " << ncols);
+    // Something should probably be done here to make sure that the times here match up with what we
+    // already have. For now, if nothing is known about the dates, then use these
+    if (m_dateTimes.empty()) {
+      m_dateTimes = std::move(table.dateTimes);
+    } else if (table.dateTimes.size() != m_dateTimes.size()) {
+      LOG(Error, "NFR file '" << fileName << "' has " << table.dateTimes.size() << " times, but the LFR file has " << m_dateTimes.size());
       return false;
     }
-    // Read the data
-    while (file.good()) {
-      std::string linestr;
-      std::getline(file, linestr);
-      std::string line = linestr;
-
-      std::vector<std::string> row;
-      boost::split(row, line, boost::is_any_of("\t"));
-      if (row.size() != ncols && row.size() != ncols + 2) {
-        clearNfr();
-        LOG(Error, "NFR data line has " << row.size() << " columns, not the expected " << ncols);
-        return false;
-      }
-      if (!time.empty()) {
-        if (time[time.size() - 1] != row[1]) {
-          day.push_back(row[0]);
-          time.push_back(row[1]);
-        }
-      } else {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
-      }
-
-      int nr = 0;
-      try {
-        nr = std::stoi(row[2]);
-      } catch (const std::exception&) {
-        clearNfr();
-        LOG(Error, "Invalid node number '" << row[2] << "'");
-        return false;
-      }
-      if (nrMap.find(nr) == nrMap.end()) {
-        int sz = nrMap.size();
-        nrMap[nr] = sz;
-        m_T.resize(sz + 1);
-        m_P.resize(sz + 1);
-        m_D.resize(sz + 1);
-      }
-      double T = 0;
-      try {
-        T = std::stod(row[3]);
-      } catch (const std::exception&) {
-        clearNfr();
-        LOG(Error, "Invalid temperature '" << row[3] << "'");
-        return false;
-      }
-
-      double P = 0;
-      try {
-        P = std::stod(row[4]);
-      } catch (const std::exception&) {
-        clearNfr();
-        LOG(Error, "Invalid pressure '" << row[4] << "'");
-        return false;
-      }
+    m_nodeNr = std::move(table.nrs);
+    m_T = std::move(table.values[0]);
+    m_P = std::move(table.values[1]);
+    m_D = std::move(table.values[2]);
+    return true;
+  }
 
-      double D = 0;
-      try {
-        D = std::stod(row[5]);
-      } catch (const std::exception&) {
-        if (nr == 0) {
-          D = 0.0;
-        } else {
-          clearNfr();
-          LOG(Error, "Invalid density '" << row[5] << "'");
-          return false;
-        }
-      }
-      m_T[nrMap[nr]].push_back(T);
-      m_P[nrMap[nr]].push_back(P);
-      m_D[nrMap[nr]].push_back(D);
-    }
-    // Unwind the zone number map;
-    std::vector<int> keys;
-    for (const auto& pair : nrMap) {
-      keys.push_back(pair.first);
-    }
-    m_nodeNr.resize(keys.size());
-    for (std::vector<int>::size_type i = 0; i < keys.size(); ++i) {
-      m_nodeNr[nrMap[keys[i]]] = keys[i];
+  SimFile::Column SimFile::pathColumn(const std::vector<std::vector<double>>& values, int nr) const {
+    int index = indexOf(m_pathNr, nr);
+    if (index == -1 || (std::size_t)index >= values.size()) {
+      return {};
     }
-    file.close();
-    // Something should probably be done here to make sure that the times here match up with what we
-    // already have. For now, if nothing is known about the dates, then try to compute it
-    if (m_dateTimes.empty()) {
-      if (!computeDateTimes(day, time)) {
-        clearLfr();
-        m_dateTimes.clear();
-        LOG(Error, "Failed to compute date and time objects from NFR input");
-        return false;
-      }
+    return {values[index].data(), values[index].size()};
+  }
+
+  SimFile::Column SimFile::nodeColumn(const std::vector<std::vector<double>>& values, int nr) const {
+    int index = indexOf(m_nodeNr, nr);
+    if (index == -1 || (std::size_t)index >= values.size()) {
+      return {};
     }
-    return true;
+    return {values[index].data(), values[index].size()};
   }
 
-  static openstudio::TimeSeries convertData(std::vector<openstudio::DateTime> inputDateTimes, std::vector<double> inputValues, std::string units) {
+  SimFile::Column SimFile::pathDeltaPValues(int nr) const {
+    return pathColumn(m_dP, nr);
+  }
+
+  SimFile::Column SimFile::pathFlow0Values(int nr) const {
+    return pathColumn(m_F0, nr);
+  }
+
+  SimFile::Column SimFile::pathFlow1Values(int nr) const {
+    return pathColumn(m_F1, nr);
+  }
+
+  SimFile::Column SimFile::nodeTemperatureValues(int nr) const {
+    return nodeColumn(m_T, nr);
+  }
+
+  SimFile::Column SimFile::nodePressureValues(int nr) const {
+    return nodeColumn(m_P, nr);
+  }
+
+  SimFile::Column SimFile::nodeDensityValues(int nr) const {
+    return nodeColumn(m_D, nr);
+  }
+
+  template <typename ValueFunction>
+  static openstudio::TimeSeries convertData(const std::vector<openstudio::DateTime>& inputDateTimes, std::size_t n, ValueFunction inputValue,
+                                            const std::string& units) {
     // Use a per-interval trapezoidal approximation to convert the CONTAM point data into E+ interval data
-    std::vector<openstudio::DateTime> dateTimes;
-    std::vector<double> values;
-    if (inputDateTimes.size() == 1)  // Account for steady simulation results
+    if (n == 1)  // Account for steady simulation results
     {
-      return openstudio::TimeSeries(inputDateTimes, createVector(inputValues), units);
+      Vector values(1);
+      values[0] = inputValue(0);
+      return openstudio::TimeSeries(std::vector<openstudio::DateTime>(inputDateTimes.begin(), inputDateTimes.begin() + 1), values, units);
     }
-    for (unsigned i = 1; i < inputDateTimes.size(); i++) {
-      dateTimes.push_back(inputDateTimes[i]);
-      values.push_back(0.5 * (inputValues[i - 1] + inputValues[i]));
+    Vector values(n - 1);
+    for (std::size_t i = 1; i < n; i++) {
+      values[i - 1] = 0.5 * (inputValue(i - 1) + inputValue(i));
     }
-    return openstudio::TimeSeries(dateTimes, createVector(values), units);
+    return openstudio::TimeSeries(std::vector<openstudio::DateTime>(inputDateTimes.begin() + 1, inputDateTimes.begin() + n), values, units);
   }
 
-  boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const {
-    int index = indexOf(m_pathNr, nr);
-    if (index == -1) {
+  static boost::optional<openstudio::TimeSeries> convertColumn(const std::vector<openstudio::DateTime>& dateTimes, const SimFile::Column& column,
+                                                               const std::string& units) {
+    if (column.empty() || column.size() > dateTimes.size()) {
       return {};
     }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_dP[index], "Pa");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertData(
+      dateTimes, column.size(), [&column](std::size_t i) { return column[i]; }, units);
+  }
+
+  boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const {
+    return convertColumn(m_dateTimes, pathDeltaPValues(nr), "Pa");
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathFlow0(int nr) const {
-    int index = indexOf(m_pathNr, nr);
-    if (index == -1) {
-      return {};
-    }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_F0[index], "kg/s");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertColumn(m_dateTimes, pathFlow0Values(nr), "kg/s");
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathFlow1(int nr) const {
-    int index = indexOf(m_pathNr, nr);
-    if (index == -1) {
-      return {};
-    }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_F1[index], "kg/s");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertColumn(m_dateTimes, pathFlow1Values(nr), "kg/s");
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathFlow(int nr) const {
-    int index = indexOf(m_pathNr, nr);
-    if (index == -1) {
+    Column F0 = pathFlow0Values(nr);
+    Column F1 = pathFlow1Values(nr);
+    if (F0.empty() || F0.size() > m_dateTimes.size()) {
       return {};
     }
-    std::vector<double> flow(m_dateTimes.size());
-    for (unsigned i = 0; i < m_dateTimes.size(); i++) {
-      flow[i] = m_F0[index][i] + m_F1[index][i];
-    }
     // Need to confirm that the total flow is F0+F1, since it also could be F0-F1
-    openstudio::TimeSeries series = convertData(m_dateTimes, flow, "kg/s");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertData(
+      m_dateTimes, F0.size(), [&F0, &F1](std::size_t i) { return F0[i] + F1[i]; }, "kg/s");
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::nodeTemperature(int nr) const {
-    int index = indexOf(m_nodeNr, nr);
-    if (index == -1) {
-      return {};
-    }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_T[index], "K");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertColumn(m_dateTimes, nodeTemperatureValues(nr), "K");
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::nodePressure(int nr) const {
-    int index = indexOf(m_nodeNr, nr);
-    if (index == -1) {
-      return {};
-    }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_P[index], "Pa");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertColumn(m_dateTimes, nodePressureValues(nr), "Pa");
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::nodeDensity(int nr) const {
-    int index = indexOf(m_nodeNr, nr);
-    if (index == -1) {
-      return {};
-    }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_D[index], "kg/m^3");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertColumn(m_dateTimes, nodeDensityValues(nr), "kg/m^3");
   }
 
   std::vector<openstudio::DateTime> SimFile::dateTimes() const {
@@ -43,6 +43,29 @@ namespace contam {
   class AIRFLOW_API SimFile
   {
    public:
+    /** A read-only view of one path or node result over all of the SIM file times. The view is only valid
+   *  while the SimFile that produced it is alive. */
+    class Column
+    {
+     public:
+      Column() = default;
+      Column(const double* data, std::size_t size) : m_data(data), m_size(size) {}
+
+      std::size_t size() const {
+        return m_size;
+      }
+      bool empty() const {
+        return m_size == 0;
+      }
+      double operator[](std::size_t i) const {
+        return m_data[i];
+      }
+
+     private:
+      const double* m_data = nullptr;
+      std::size_t m_size = 0;
+    };
+
     explicit SimFile(openstudio::path path);
 
     // These are provided for advanced use
@@ -73,6 +96,16 @@ namespace contam {
     boost::optional<openstudio::TimeSeries> nodeTemperature(int nr) const;
     boost::optional<openstudio::TimeSeries> nodePressure(int nr) const;
     boost::optional<openstudio::TimeSeries> nodeDensity(int nr) const;
+
+    /** Returns views of the raw results at the SIM file times (see fileDateTimes) without copying them.
+   *  The views are empty if the path or node is not in the results. */
+    Column pathDeltaPValues(int nr) const;
+    Column pathFlow0Values(int nr) const;
+    Column pathFlow1Values(int nr) const;
+    Column nodeTemperatureValues(int nr) const;
+    Column nodePressureValues(int nr) const;
+    Column nodeDensityValues(int nr) const;
+
     /** Returns a vector of DateTime objects that give the EnergyPlus-style
    *  end of interval times. These are not the actual times in the SIM file */
     std::vector<openstudio::DateTime> dateTimes() const;
@@ -89,8 +122,11 @@ namespace contam {
     bool readLfr(const std::string& fileName);
     void clearNfr();
     bool readNfr(const std::string& fileName);
-    bool computeDateTimes(const std::vector<std::string>& day, const std::vector<std::string>& time);
 
+    Column pathColumn(const std::vector<std::vector<double>>& values, int nr) const;
+    Column nodeColumn(const std::vector<std::vector<double>>& values, int nr) const;
+
+    // Results are stored one contiguous vector per path or node, [path][time] and [node][time]
     std::vector<int> m_pathNr;  // the CONTAM path index
     std::vector<std::vector<double>> m_dP;
     std::vector<std::vector<double>> m_F0;
@@ -69,6 +69,16 @@ namespace cli {
       "--export-epJSON", [opt](std::int64_t val) { (val != 0) && opt->runOptions.setEpjson((val == 1)); },
       "export epJSON file format. The default is IDF");
 
+    app->add_flag(
+      "--direct-epJSON",
+      [opt](std::int64_t val) {
+        if (val == 1) {
+          opt->direct_epjson = true;
+          opt->runOptions.setEpjson(true);
+        }
+      },
+      "Write the epJSON directly from the translated model, skipping the intermediate IDF and ExpandObjects when they are not needed");
+
     app->add_option("-s,--socket", opt->socket_port, "Pipe status messages to a socket on localhost PORT")->option_text("PORT");
 
     auto* stdout_opt = app->add_flag("--show-stdout", opt->show_stdout, "export epJSON file format. The default is IDF")->group("Stdout Options");
@@ -0,0 +1,53 @@
+import openstudio
+
+
+class AddHVACTemplateThermostat(openstudio.measure.EnergyPlusMeasure):
+    """An EnergyPlusMeasure that adds an object that ExpandObjects has to rewrite."""
+
+    def name(self):
+        return "Add HVACTemplate Thermostat"
+
+    def description(self):
+        return "Adds an HVACTemplate:Thermostat to the Workspace"
+
+    def modeler_description(self):
+        return "Used to test that the --direct-epJSON workflow still runs ExpandObjects when HVACTemplate objects are present"
+
+    def arguments(self, workspace: openstudio.Workspace):
+        args = openstudio.measure.OSArgumentVector()
+
+        thermostat_name = openstudio.measure.OSArgument.makeStringArgument("thermostat_name", True)
+        thermostat_name.setDisplayName("Thermostat Name")
+        thermostat_name.setDefaultValue("Direct epJSON Thermostat")
+        args.append(thermostat_name)
+
+        return args
+
+    def run(
+        self,
+        workspace: openstudio.Workspace,
+        runner: openstudio.measure.OSRunner,
+        user_arguments: openstudio.measure.OSArgumentMap,
+    ):
+        super().run(workspace, runner, user_arguments)  # Do **NOT** remove this line
+
+        if not (runner.validateUserArguments(self.arguments(workspace), user_arguments)):
+            return False
+
+        thermostat_name = runner.getStringArgumentValue("thermostat_name", user_arguments)
+
+        idfObject = openstudio.IdfObject(openstudio.IddObjectType("HVACTemplate:Thermostat"))
+        idfObject.setString(0, thermostat_name)
+        idfObject.setDouble(2, 20.0)  # Constant Heating Setpoint
+        idfObject.setDouble(4, 24.0)  # Constant Cooling Setpoint
+        wsObject_ = workspace.addObject(idfObject)
+        if not wsObject_.is_initialized():
+            runner.registerError(f"Couldn't add idfObject to workspace:\n{idfObject}")
+            return False
+
+        runner.registerInfo(f"Added:\n'{wsObject_.get()}'")
+        return True
+
+
+# register the measure to be used by the application
+AddHVACTemplateThermostat().registerWithApplication()
@@ -0,0 +1,89 @@
+import argparse
+import json
+import shutil
+import subprocess
+import tempfile
+from pathlib import Path
+
+
+def validate_file(arg):
+    if (filepath := Path(arg)).is_file():
+        return filepath
+    else:
+        raise FileNotFoundError(arg)
+
+
+def validate_dir(arg):
+    if (dirpath := Path(arg)).is_dir():
+        return dirpath
+    else:
+        raise NotADirectoryError(arg)
+
+
+THERMOSTAT_NAME = "Direct epJSON Thermostat"
+
+
+def run_direct_epjson(os_cli_path: Path, working_dir: Path, files_dir: Path, with_hvac_template: bool):
+    """Runs `labs run --direct-epJSON` on the seb.osm seed, optionally adding an HVACTemplate:Thermostat, returns the run directory"""
+    # Copied, so that the measure.xml is never rewritten in the source tree
+    shutil.copytree(Path(__file__).parent / "direct_epjson_measures", working_dir / "measures")
+
+    osw = {
+        "weather_file": "srrl_2013_amy.epw",
+        "seed_file": "seb.osm",
+        "file_paths": [str(files_dir)],
+        "measure_paths": ["measures"],
+        "steps": [],
+    }
+    if with_hvac_template:
+        osw["steps"].append(
+            {
+                "measure_dir_name": "AddHVACTemplateThermostat",
+                "arguments": {"thermostat_name": THERMOSTAT_NAME},
+            }
+        )
+    osw_path = working_dir / "direct_epjson.osw"
+    osw_path.write_text(json.dumps(osw, indent=2))
+
+    command = [str(os_cli_path), "labs", "run", "--direct-epJSON", "-w", str(osw_path)]
+    print(f"Running: {' '.join(command)}")
+    subprocess.check_call(command)
+
+    return working_dir / "run"
+
+
+def load_epjson(run_dir: Path):
+    in_epjson = run_dir / "in.epJSON"
+    if not in_epjson.is_file():
+        raise FileNotFoundError(f"Expected {in_epjson} to be written")
+    with open(in_epjson, "r") as f:
+        return json.load(f)
+
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(description="Run the workflow with --direct-epJSON and check the written in.epJSON.")
+    parser.add_argument("os_cli_path", type=validate_file, help="Path to the OS CLI")
+    parser.add_argument("compact_osw_dir", type=validate_dir, help="Path to the compact_osw example directory, for seb.osm and its weather")
+    args = parser.parse_args()
+    print(args)
+
+    # Without any HVACTemplate object, the epJSON is written straight from the Workspace and ExpandObjects is skipped
+    with tempfile.TemporaryDirectory() as tmpdir:
+        working_dir = Path(tmpdir)
+        run_dir = run_direct_epjson(args.os_cli_path, working_dir, args.compact_osw_dir / "files", with_hvac_template=False)
+        epjson = load_epjson(run_dir)
+        assert "Version" in epjson
+        assert "Building" in epjson
+        assert len(epjson.get("Zone", {})) > 0
+        assert not any(key.startswith("HVACTemplate:") for key in epjson)
+        assert not (run_dir / "pre-expand.idf").exists(), "ExpandObjects should not have run"
+
+    # With an HVACTemplate object, ExpandObjects runs and the epJSON is written from the expanded IDF
+    with tempfile.TemporaryDirectory() as tmpdir:
+        working_dir = Path(tmpdir)
+        run_dir = run_direct_epjson(args.os_cli_path, working_dir, args.compact_osw_dir / "files", with_hvac_template=True)
+        epjson = load_epjson(run_dir)
+        assert (run_dir / "pre-expand.idf").is_file(), "ExpandObjects should have run"
+        assert not any(key.startswith("HVACTemplate:") for key in epjson), "The HVACTemplate objects should have been expanded"
+        assert THERMOSTAT_NAME in (run_dir / "pre-expand.idf").read_text(), "The HVACTemplate:Thermostat should have been passed to ExpandObjects"
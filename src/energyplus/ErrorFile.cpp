@@ -29,31 +29,162 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
-#include <boost/algorithm/string.hpp>
+#include "../utilities/core/Filesystem.hpp"
+
+#include <cctype>
 
 namespace openstudio {
 namespace energyplus {
 
+  // The err file lines are classified by hand rather than with regexes, err files with hundreds of thousands of
+  // warnings are common and this is called for every line of them. Each matcher is equivalent to the regex noted.
+
+  static bool isSpace(char c) {
+    return std::isspace(static_cast<unsigned char>(c)) != 0;
+  }
+
+  static std::size_t skipSpace(std::string_view line, std::size_t i) {
+    while (i < line.size() && isSpace(line[i])) {
+      ++i;
+    }
+    return i;
+  }
+
+  static std::string_view trimRight(std::string_view s) {
+    while (!s.empty() && isSpace(s.back())) {
+      s.remove_suffix(1);
+    }
+    return s;
+  }
+
+  static std::string_view trim(std::string_view s) {
+    return trimRight(s.substr(skipSpace(s, 0)));
+  }
+
+  // Matches the "\s*\**\s+\*\*" that starts message lines, calling tail with the position after the "**" for the ways
+  // the prefix can match until tail accepts one
+  template <typename Tail>
+  static bool matchMessagePrefix(std::string_view line, Tail tail) {
+    const std::size_t start = skipSpace(line, 0);
+    std::size_t stars = start;
+    while (stars < line.size() && line[stars] == '*') {
+      ++stars;
+    }
+    const std::size_t marker = skipSpace(line, stars);
+    // leading stars, then whitespace and the marker
+    if (marker > stars && line.compare(marker, 2, "**") == 0 && tail(marker + 2)) {
+      return true;
+    }
+    // no leading stars, the run of stars is the marker itself
+    return start > 0 && stars - start >= 2 && tail(start + 2);
+  }
+
+  // ^\s*\**\s+\*\*\s*([[:alpha:]]+)\s*\*\*(.*)$
+  static bool matchMessage(std::string_view line, std::string_view& type, std::string_view& rest) {
+    return matchMessagePrefix(line, [&](std::size_t i) {
+      i = skipSpace(line, i);
+      const std::size_t typeStart = i;
+      while (i < line.size() && std::isalpha(static_cast<unsigned char>(line[i]))) {
+        ++i;
+      }
+      if (i == typeStart) {
+        return false;
+      }
+      type = line.substr(typeStart, i - typeStart);
+      i = skipSpace(line, i);
+      if (line.compare(i, 2, "**") != 0) {
+        return false;
+      }
+      rest = line.substr(i + 2);
+      return true;
+    });
+  }
+
+  // ^\s*\**\s+\*\*\s*~~~\s*\*\*(.*)$
+  static bool matchContinuation(std::string_view line, std::string_view& rest) {
+    return matchMessagePrefix(line, [&](std::size_t i) {
+      i = skipSpace(line, i);
+      if (line.compare(i, 3, "~~~") != 0) {
+        return false;
+      }
+      i = skipSpace(line, i + 3);
+      if (line.compare(i, 2, "**") != 0) {
+        return false;
+      }
+      rest = line.substr(i + 2);
+      return true;
+    });
+  }
+
+  // The text after "\s*\*+" for lines that start with a run of stars, or nothing
+  static bool afterStars(std::string_view line, std::string_view& rest) {
+    std::size_t i = skipSpace(line, 0);
+    const std::size_t start = i;
+    while (i < line.size() && line[i] == '*') {
+      ++i;
+    }
+    if (i == start) {
+      return false;
+    }
+    rest = line.substr(i);
+    return true;
+  }
+
+  static bool startsWith(std::string_view s, std::string_view prefix) {
+    return s.compare(0, prefix.size(), prefix) == 0;
+  }
+
+  // ^\s*\*+ EnergyPlus Completed Successfully.* or ^\s*\*+ GroundTempCalc\S* Completed Successfully.*
+  static bool matchCompletedSuccessfully(std::string_view line) {
+    std::string_view rest;
+    if (!afterStars(line, rest)) {
+      return false;
+    }
+    if (startsWith(rest, " EnergyPlus Completed Successfully")) {
+      return true;
+    }
+    constexpr std::string_view groundTemp(" GroundTempCalc");
+    if (!startsWith(rest, groundTemp)) {
+      return false;
+    }
+    std::size_t i = groundTemp.size();
+    while (i < rest.size() && !isSpace(rest[i])) {
+      ++i;
+    }
+    return startsWith(rest.substr(i), " Completed Successfully");
+  }
+
+  // ^\s*\*+ EnergyPlus Terminated.*
+  static bool matchTerminated(std::string_view line) {
+    std::string_view rest;
+    return afterStars(line, rest) && startsWith(rest, " EnergyPlus Terminated");
+  }
+
   /// constructor
-  ErrorFile::ErrorFile(const openstudio::path& errPath) : m_completed(false), m_completedSuccessfully(false) {
-    openstudio::filesystem::ifstream ifs(errPath);
-    parse(ifs);
-    ifs.close();
+  ErrorFile::ErrorFile(const openstudio::path& errPath) : ErrorFile(errPath, false) {}
+
+  ErrorFile::ErrorFile(const openstudio::path& errPath, bool follow)
+    : m_path(errPath),
+      m_offset(0),
+      m_inMessage(false),
+      m_changed(false),
+      m_completed(false),
+      m_completedSuccessfully(false) {
+    update(!follow);
   }
 
   /// get warnings
-  std::vector<std::string> ErrorFile::warnings() const {
+  const std::vector<std::string>& ErrorFile::warnings() const {
     return m_warnings;
   }
 
   /// get severe errors
-  std::vector<std::string> ErrorFile::severeErrors() const {
+  const std::vector<std::string>& ErrorFile::severeErrors() const {
     return m_severeErrors;
   }
 
   /// get fatal errors
-  std::vector<std::string> ErrorFile::fatalErrors() const {
+  const std::vector<std::string>& ErrorFile::fatalErrors() const {
     return m_fatalErrors;
   }
 
@@ -67,97 +198,108 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is) {
-    std::string line;
-
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError(R"(^\s*\**\s+\*\*\s*([[:alpha:]]+)\s*\*\*(.*)$)");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue(R"(^\s*\**\s+\*\*\s*~~~\s*\*\*(.*)$)");
-
-    // completed successfully
-    boost::regex completedSuccessful(R"(^\s*\*+ EnergyPlus Completed Successfully.*)");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful(R"(^\s*\*+ GroundTempCalc\S* Completed Successfully.*)");
-
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful(R"(^\s*\*+ EnergyPlus Terminated.*)");
-
-    // repeat count
+  bool ErrorFile::update(bool endOfFile) {
+    m_changed = false;
+    if (!m_completed) {
+      openstudio::filesystem::ifstream is(m_path, std::ios_base::binary);
+      if (is.is_open()) {
+        is.seekg(0, std::ios_base::end);
+        const auto size = static_cast<std::uintmax_t>(is.tellg());
+        if (size > m_offset) {
+          std::string text(size - m_offset, '\0');
+          is.seekg(m_offset, std::ios_base::beg);
+          is.read(&text[0], text.size());
+          text.resize(is.gcount());
+          m_offset += text.size();
+          m_partialLine += text;
+        }
+      }
 
-    // read the file line by line using regexes
-    bool alreadyGotLine = false;
+      std::string_view remaining(m_partialLine);
+      std::size_t end = remaining.find('\n');
+      while (end != std::string_view::npos && !m_completed) {
+        parseLine(remaining.substr(0, end));
+        remaining.remove_prefix(end + 1);
+        end = remaining.find('\n');
+      }
+      if (m_completed) {
+        remaining = std::string_view();
+      } else if (endOfFile && !remaining.empty()) {
+        parseLine(remaining);
+        remaining = std::string_view();
+      }
+      m_partialLine = std::string(remaining);
+    }
+    if (endOfFile && m_inMessage) {
+      recordMessage();
+    }
+    return m_changed;
+  }
 
-    while (alreadyGotLine || std::getline(is, line)) {
+  void ErrorFile::parseLine(std::string_view line) {
+    if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
 
-      alreadyGotLine = false;
-      boost::smatch matches;
+    std::string_view type;
+    std::string_view rest;
+    if (m_inMessage) {
+      // read the rest of the multi line warning or error
+      if (matchContinuation(line, rest)) {
+        m_message += '\n';
+        m_message += trimRight(rest);
+        return;
+      }
+      recordMessage();
+    }
 
-      LOG(Debug, "Parsing ErrorFile Line '" << line << "'");
+    if (matchMessage(line, type, rest)) {
+      m_messageType = std::string(type);
+      m_message = std::string(trim(rest));
+      m_inMessage = true;
+    } else if (matchCompletedSuccessfully(line)) {
+      m_completed = true;
+      m_completedSuccessfully = true;
+      m_changed = true;
+    } else if (matchTerminated(line)) {
+      m_completed = true;
+      m_completedSuccessfully = false;
+      m_changed = true;
+    }
+  }
 
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)) {
+  void ErrorFile::recordMessage() {
+    m_inMessage = false;
+    m_changed = true;
 
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second);
-        boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second);
-        boost::trim(warningOrErrorString);
+    // correctly sort warnings and errors
+    if (m_messageType == "Warning") {
+      m_warnings.push_back(std::move(m_message));
+    } else if (m_messageType == "Severe") {
+      m_severeErrors.push_back(std::move(m_message));
+    } else if (m_messageType == "Fatal") {
+      m_fatalErrors.push_back(std::move(m_message));
+    } else {
+      try {
+        ErrorLevel level(m_messageType);
 
-        // read the rest of the multi line warning or error
-        while (true) {
-          // std::streampos pos = is.tellg();
-          if (!std::getline(is, line)) {
+        switch (level.value()) {
+          case ErrorLevel::Warning:
+            m_warnings.push_back(std::move(m_message));
             break;
-          }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)) {
-            std::string temp = std::string(matches[1].first, matches[1].second);
-            boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
-          } else {
-            // unget the line
-            // is.seekg(pos);
-            // Instead of rewind then reread (which fails on Windows if you have LF line endings)
-            // We just use this bool to avoid having to re-read the line.
-            alreadyGotLine = true;
+          case ErrorLevel::Severe:
+            m_severeErrors.push_back(std::move(m_message));
+            break;
+          case ErrorLevel::Fatal:
+            m_fatalErrors.push_back(std::move(m_message));
             break;
-          }
-        }
-
-        LOG(Trace, "Error parsed: " << warningOrErrorString);
-
-        // correctly sort warnings and errors
-        try {
-          ErrorLevel level(warningOrErrorType);
-
-          switch (level.value()) {
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
-          }
-
-        } catch (...) {
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
         }
 
-      } else if (boost::regex_match(line, completedSuccessful) || boost::regex_match(line, groundTempCompletedSuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = true;
-        break;
-      } else if (boost::regex_match(line, completedUnsuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = false;
-        break;
+      } catch (...) {
+        LOG(Error, "Unknown warning or error level '" << m_messageType << "'");
       }
     }
+    m_message.clear();
   }
 
 }  // namespace energyplus
@@ -36,7 +36,9 @@
 #include "../utilities/core/Enum.hpp"
 #include "../utilities/core/Logger.hpp"
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace openstudio {
@@ -57,17 +59,26 @@ namespace energyplus {
   class ENERGYPLUS_API ErrorFile
   {
    public:
-    /// constructor
+    /// constructor, parses the complete err file
     ErrorFile(const openstudio::path& errPath);
 
+    /// constructor for an err file that EnergyPlus may still be writing, if follow is true only the complete lines are
+    /// parsed and update() picks up whatever is appended afterwards
+    ErrorFile(const openstudio::path& errPath, bool follow);
+
+    /// parse the lines appended to the err file since the last call, returns true if a new warning or error or the
+    /// completion status was recorded. A message is recorded once the line after it is written, if endOfFile is true
+    /// the last line and message are recorded as well.
+    bool update(bool endOfFile = false);
+
     /// get warnings
-    std::vector<std::string> warnings() const;
+    const std::vector<std::string>& warnings() const;
 
     /// get severe errors
-    std::vector<std::string> severeErrors() const;
+    const std::vector<std::string>& severeErrors() const;
 
     /// get fatal errors
-    std::vector<std::string> fatalErrors() const;
+    const std::vector<std::string>& fatalErrors() const;
 
     /// did EnergyPlus complete or crash
     bool completed() const;
@@ -78,7 +89,16 @@ namespace energyplus {
    private:
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(openstudio::filesystem::ifstream& is);
+    void parseLine(std::string_view line);
+    void recordMessage();
+
+    openstudio::path m_path;
+    std::uintmax_t m_offset;
+    std::string m_partialLine;
+    std::string m_messageType;
+    std::string m_message;
+    bool m_inMessage;
+    bool m_changed;
 
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
@@ -32,6 +32,7 @@
 #include "GeometryTranslator.hpp"
 
 #include "../model/ModelObject.hpp"
+#include "../model/ModelObject_Impl.hpp"
 
 #include "../utilities/idf/IdfFile.hpp"
 #include "../utilities/idf/WorkspaceObject.hpp"
@@ -42,9 +43,15 @@
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
 
-#include <thread>
 #include <boost/serialization/version.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
 using namespace openstudio::model;
 
 using namespace std;
@@ -53,7 +60,7 @@ namespace openstudio {
 
 namespace energyplus {
 
-  ReverseTranslator::ReverseTranslator() {
+  ReverseTranslator::ReverseTranslator() : m_progressBar(nullptr), m_parallelTranslation(false) {
     m_logSink.setLogLevel(Warn);
     m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
     m_logSink.setThreadId(std::this_thread::get_id());
@@ -69,8 +76,12 @@ namespace energyplus {
 
     m_untranslatedIdfObjects.clear();
 
+    m_untranslatedHandles.clear();
+
     m_logSink.resetStringStream();
 
+    m_parallelLogMessages.clear();
+
     m_logSink.setThreadId(std::this_thread::get_id());
 
     m_logSink.setChannelRegex(boost::regex("openstudio\\.IdfFile"));
@@ -131,7 +142,8 @@ namespace energyplus {
         workspace.disconnectProgressBar(*progressBar);
       }
 
-      return this->translateWorkspace(workspace, progressBar, false);
+      // the Workspace only lives for this import, no need to clone it
+      return this->translateWorkspaceInPlace(workspace, progressBar, false);
     }
 
     return boost::none;
@@ -140,6 +152,26 @@ namespace energyplus {
   Model ReverseTranslator::translateWorkspace(const Workspace& workspace, ProgressBar* progressBar, bool clearLogSink) {
     if (clearLogSink) {
       m_logSink.resetStringStream();
+      m_parallelLogMessages.clear();
+    }
+
+    m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
+
+    // check input
+    if (workspace.iddFileType() != IddFileType::EnergyPlus) {
+      LOG(Error, "Cannot translate Workspace with IddFileType = '" << workspace.iddFileType().valueName() << "'");
+      return {};
+    }
+
+    m_workspace = workspace.clone();
+
+    return translateCurrentWorkspace(progressBar);
+  }
+
+  Model ReverseTranslator::translateWorkspaceInPlace(Workspace& workspace, ProgressBar* progressBar, bool clearLogSink) {
+    if (clearLogSink) {
+      m_logSink.resetStringStream();
+      m_parallelLogMessages.clear();
     }
 
     m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
@@ -150,15 +182,29 @@ namespace energyplus {
       return {};
     }
 
+    m_workspace = workspace;
+
+    return translateCurrentWorkspace(progressBar);
+  }
+
+  bool ReverseTranslator::parallelTranslation() const {
+    return m_parallelTranslation;
+  }
+
+  void ReverseTranslator::setParallelTranslation(bool parallelTranslation) {
+    m_parallelTranslation = parallelTranslation;
+  }
+
+  Model ReverseTranslator::translateCurrentWorkspace(ProgressBar* progressBar) {
     m_model = Model();
     m_model.setFastNaming(false);
 
-    m_workspace = workspace.clone();
-
     m_workspaceToModelMap.clear();
 
     m_untranslatedIdfObjects.clear();
 
+    m_untranslatedHandles.clear();
+
     // if multiple runperiod objects in idf, remove them all
     vector<WorkspaceObject> runPeriods = m_workspace.getObjectsByType(IddObjectType::RunPeriod);
     if (runPeriods.size() > 1) {
@@ -174,7 +220,7 @@ namespace energyplus {
     m_progressBar = progressBar;
     if (m_progressBar) {
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(workspace.numObjects());
+      m_progressBar->setMaximum(m_workspace.numObjects());
     }
 
     LOG(Trace, "Calling geometry translator.");
@@ -183,6 +229,11 @@ namespace energyplus {
 
     m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
 
+    if (m_parallelTranslation) {
+      LOG(Trace, "Translating independent object categories in parallel.");
+      translateIndependentCategoriesInParallel();
+    }
+
     // look for site object in workspace and translate if found
     LOG(Trace, "Translating Site:Location object.");
     vector<WorkspaceObject> site = m_workspace.getObjectsByType(IddObjectType::Site_Location);
@@ -200,9 +251,8 @@ namespace energyplus {
     // loop over all of the air loops
     LOG(Trace, "Translating AirLoops.");
     vector<WorkspaceObject> airLoops = m_workspace.getObjectsByType(IddObjectType::AirLoopHVAC);
-    for (auto it = airLoops.begin(), iend = airLoops.end(); it != iend; ++it) {
-      LOG(Trace, "Translating AirLoop '" << it->name().get() << "'.");
-      translateAndMapWorkspaceObject(*it);
+    for (auto& elem : airLoops) {
+      translateAndMapWorkspaceObject(elem);
     }
 
     // Now loop over all objects to make sure nothing as missed.
@@ -218,9 +268,137 @@ namespace energyplus {
     return m_model;
   }
 
+  void ReverseTranslator::translateIndependentCategoriesInParallel() {
+    // Each category only references objects of its own category, so it can be translated on its own. Schedule:File (which brings an
+    // ExternalFile along) and Construction:AirBoundary (which references a Schedule) are left to the serial translation, as is
+    // Schedule:Year, whose dates depend on the Model's YearDescription
+    static const std::vector<std::vector<IddObjectType>> categories{
+      {IddObjectType::Curve_Bicubic, IddObjectType::Curve_Biquadratic, IddObjectType::Curve_Cubic, IddObjectType::Curve_DoubleExponentialDecay,
+       IddObjectType::Curve_ExponentialDecay, IddObjectType::Curve_ExponentialSkewNormal, IddObjectType::Curve_FanPressureRise,
+       IddObjectType::Curve_Functional_PressureDrop, IddObjectType::Curve_Linear, IddObjectType::Curve_QuadLinear, IddObjectType::Curve_Quadratic,
+       IddObjectType::Curve_QuadraticLinear, IddObjectType::Curve_Quartic, IddObjectType::Curve_QuintLinear, IddObjectType::Curve_RectangularHyperbola1,
+       IddObjectType::Curve_RectangularHyperbola2, IddObjectType::Curve_Sigmoid, IddObjectType::Curve_Triquadratic, IddObjectType::Table_Lookup},
+      {IddObjectType::ScheduleTypeLimits, IddObjectType::Schedule_Compact, IddObjectType::Schedule_Constant, IddObjectType::Schedule_Day_Hourly,
+       IddObjectType::Schedule_Day_Interval, IddObjectType::Schedule_Week_Daily},
+      {IddObjectType::Material, IddObjectType::Material_AirGap, IddObjectType::Material_NoMass, IddObjectType::MaterialProperty_GlazingSpectralData,
+       IddObjectType::WindowMaterial_Gas, IddObjectType::WindowMaterial_Glazing, IddObjectType::WindowMaterial_SimpleGlazingSystem,
+       IddObjectType::Construction, IddObjectType::ConstructionProperty_InternalHeatSource},
+    };
+
+    const size_t n = categories.size();
+    std::vector<std::vector<WorkspaceObject>> categoryObjects(n);
+    for (size_t i = 0; i < n; ++i) {
+      for (const IddObjectType& iddObjectType : categories[i]) {
+        std::vector<WorkspaceObject> objects = m_workspace.getObjectsByType(iddObjectType);
+        categoryObjects[i].insert(categoryObjects[i].end(), objects.begin(), objects.end());
+      }
+    }
+
+    // Each category gets its own thread and its own ReverseTranslator, which writes to its own Model and only reads m_workspace. The
+    // ReverseTranslators are constructed on their thread, so their log sinks only ever collect the messages of that thread: the messages
+    // logged on this thread go to m_logSink alone
+    std::vector<std::unique_ptr<ReverseTranslator>> workers(n);
+    std::vector<std::set<Handle>> initialHandles(n);
+    std::exception_ptr error;
+    std::atomic<bool> failed{false};
+    auto worker = [&](size_t i) {
+      try {
+        workers[i] = std::make_unique<ReverseTranslator>();
+        ReverseTranslator& rt = *workers[i];
+        rt.m_workspace = m_workspace;
+        rt.m_model.setFastNaming(false);
+        for (const Handle& handle : rt.m_model.handles()) {
+          initialHandles[i].insert(handle);
+        }
+        for (const WorkspaceObject& workspaceObject : categoryObjects[i]) {
+          if (failed) {
+            return;
+          }
+          rt.translateAndMapWorkspaceObject(workspaceObject);
+        }
+      } catch (...) {
+        if (!failed.exchange(true)) {
+          error = std::current_exception();
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+      threads.emplace_back(worker, i);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    if (error) {
+      std::rethrow_exception(error);
+    }
+
+    // Merge in category order. Unique objects (YearDescription, ...) are Model wide settings, which none of the categories should create: the
+    // ones a worker did create anyway are only merged if m_model does not have one yet. They are never pointed to, so dropping them does not
+    // leave any dangling pointer behind. Anything that does not make it in is translated again by the serial pass
+    for (size_t i = 0; i < n; ++i) {
+      ReverseTranslator& rt = *workers[i];
+
+      std::vector<LogMessage> logMessages = rt.m_logSink.logMessages();
+      m_parallelLogMessages.insert(m_parallelLogMessages.end(), logMessages.begin(), logMessages.end());
+
+      std::vector<WorkspaceObject> translated;
+      for (const WorkspaceObject& object : rt.m_model.objects(true)) {
+        if (initialHandles[i].find(object.handle()) == initialHandles[i].end()) {
+          if (object.iddObject().properties().unique && !m_model.getObjectsByType(object.iddObject().type()).empty()) {
+            LOG(Error, "Dropping the " << object.briefDescription() << " created while translating in parallel, the Model already has one.");
+            continue;
+          }
+          translated.push_back(object);
+        }
+      }
+      if (translated.empty()) {
+        continue;
+      }
+
+      std::vector<WorkspaceObject> merged = m_model.addObjects(translated);
+      if (merged.size() != translated.size()) {
+        LOG(Error, "Could not merge the objects translated in parallel, translating them again.");
+        continue;
+      }
+
+      std::unordered_map<Handle, size_t, UUIDHash> mergedIndex;
+      mergedIndex.reserve(translated.size());
+      for (size_t j = 0; j < translated.size(); ++j) {
+        mergedIndex.emplace(translated[j].handle(), j);
+      }
+
+      for (const auto& [workspaceHandle, modelObject] : rt.m_workspaceToModelMap) {
+        auto it = mergedIndex.find(modelObject.handle());
+        if (it != mergedIndex.end()) {
+          m_workspaceToModelMap.insert(std::make_pair(workspaceHandle, merged[it->second].cast<ModelObject>()));
+        }
+      }
+
+      for (const IdfObject& idfObject : rt.m_untranslatedIdfObjects) {
+        if (m_untranslatedHandles.insert(idfObject.handle()).second) {
+          m_untranslatedIdfObjects.push_back(idfObject);
+        }
+      }
+    }
+
+    if (m_progressBar) {
+      m_progressBar->setValue(m_untranslatedIdfObjects.size() + m_workspaceToModelMap.size());
+    }
+  }
+
   std::vector<LogMessage> ReverseTranslator::warnings() const {
     std::vector<LogMessage> result;
 
+    for (const LogMessage& logMessage : m_parallelLogMessages) {
+      if (logMessage.logLevel() == Warn) {
+        result.push_back(logMessage);
+      }
+    }
+
     for (const LogMessage& logMessage : m_logSink.logMessages()) {
       if (logMessage.logLevel() == Warn) {
         result.push_back(logMessage);
@@ -233,6 +411,12 @@ namespace energyplus {
   std::vector<LogMessage> ReverseTranslator::errors() const {
     std::vector<LogMessage> result;
 
+    for (const LogMessage& logMessage : m_parallelLogMessages) {
+      if (logMessage.logLevel() > Warn) {
+        result.push_back(logMessage);
+      }
+    }
+
     for (const LogMessage& logMessage : m_logSink.logMessages()) {
       if (logMessage.logLevel() > Warn) {
         result.push_back(logMessage);
@@ -246,17 +430,6 @@ namespace energyplus {
     return m_untranslatedIdfObjects;
   }
 
-  struct IdfObjectEqual
-  {
-    explicit IdfObjectEqual(const IdfObject& target) : m_target(target) {}
-
-    bool operator()(const IdfObject& other) const {
-      return (m_target == other);
-    }
-
-    IdfObject m_target;
-  };
-
   boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(const WorkspaceObject& workspaceObject) {
     auto i = m_workspaceToModelMap.find(workspaceObject.handle());
 
@@ -266,8 +439,6 @@ namespace energyplus {
       return boost::optional<ModelObject>(i->second);
     }
 
-    LOG(Trace, "Translating " << workspaceObject.briefDescription() << ".");
-
     // DLM: the scope of this translator is being changed, we now only import objects from idf
     // in the geometry, loads, resources, and general simulation control portions of the model.
     // Users can add idf objects to their model using idf measures.  Only objects viewable in the
@@ -1079,13 +1250,10 @@ namespace energyplus {
     }
 
     if (modelObject) {
-      LOG(Trace, "Adding " << modelObject.get().briefDescription() << " to map.");
       m_workspaceToModelMap.insert(make_pair(workspaceObject.handle(), modelObject.get()));
     } else {
       if (addToUntranslated) {
-        if (std::find_if(m_untranslatedIdfObjects.begin(), m_untranslatedIdfObjects.end(), IdfObjectEqual(workspaceObject.idfObject()))
-            == m_untranslatedIdfObjects.end()) {
-          LOG(Trace, "Ignoring " << workspaceObject.briefDescription() << ".");
+        if (m_untranslatedHandles.insert(workspaceObject.handle()).second) {
           m_untranslatedIdfObjects.push_back(workspaceObject.idfObject());
         }
       }
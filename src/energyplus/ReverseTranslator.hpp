@@ -35,6 +35,8 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <set>
+
 namespace openstudio {
 
 class ProgressBar;
@@ -50,6 +52,19 @@ namespace energyplus {
 
     model::Model translateWorkspace(const Workspace& workspace, ProgressBar* progressBar = nullptr, bool clearLogSink = true);
 
+    /** Same as translateWorkspace, but works on the given Workspace directly instead of on a clone of it. The Workspace is modified
+     *  in the process (duplicate RunPeriods are removed and geometry is converted to relative coordinates), so this is meant for
+     *  Workspaces that are thrown away after the import, as loadModel does. */
+    model::Model translateWorkspaceInPlace(Workspace& workspace, ProgressBar* progressBar = nullptr, bool clearLogSink = true);
+
+    /** Whether the object categories that only reference objects of their own category (curves and tables, schedules, materials and
+     *  constructions) are translated concurrently before the rest of the Workspace. Each category is translated into its own Model,
+     *  and these are merged into the result in a fixed order, so the resulting Model does not depend on thread scheduling.
+     *  Defaults to false. */
+    bool parallelTranslation() const;
+
+    void setParallelTranslation(bool parallelTranslation);
+
     /** Get warning messages generated by the last translation. */
     std::vector<LogMessage> warnings() const;
 
@@ -75,6 +90,11 @@ namespace energyplus {
    *  concern of translating an object twice, provided that workspace objects are always translated using the
    *  translateAndMapWorkspaceObject() interface as opposed to the type specific translators.
    */
+    model::Model translateCurrentWorkspace(ProgressBar* progressBar);
+
+    /** Translates the independent object categories in worker ReverseTranslators, and merges their Models into m_model */
+    void translateIndependentCategoriesInParallel();
+
     boost::optional<model::ModelObject> translateAndMapWorkspaceObject(const WorkspaceObject& workspaceObject);
 
     boost::optional<model::ModelObject> translateAirLoopHVAC(const WorkspaceObject& workspaceObject);
@@ -437,9 +457,16 @@ namespace energyplus {
 
     std::vector<IdfObject> m_untranslatedIdfObjects;
 
+    std::set<openstudio::Handle> m_untranslatedHandles;
+
     StringStreamLogSink m_logSink;
 
+    // messages logged by the worker threads of the last parallel translation
+    std::vector<LogMessage> m_parallelLogMessages;
+
     ProgressBar* m_progressBar;
+
+    bool m_parallelTranslation;
   };
 
   ENERGYPLUS_API boost::optional<openstudio::model::Model> loadAndTranslateIdf(const openstudio::path& path);
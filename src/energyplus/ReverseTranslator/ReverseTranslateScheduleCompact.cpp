@@ -65,15 +65,15 @@ namespace energyplus {
       scheduleCompact.setName(*os);
     }
 
-    for (IdfExtensibleGroup& eg : workspaceObject.extensibleGroups()) {
-      for (unsigned i = 0; i < eg.numFields(); ++i) {
-        if (auto value = eg.getString(i)) {
-          if (istringEqual(value.get(), "Interpolate:Average")) {
-            eg.setString(i, "Interpolate:Yes");
-          }
+    for (const IdfExtensibleGroup& eg : workspaceObject.extensibleGroups()) {
+      // Normalized on a copy of the fields, the Workspace being translated is never modified
+      std::vector<std::string> fields = eg.fields();
+      for (std::string& field : fields) {
+        if (istringEqual(field, "Interpolate:Average")) {
+          field = "Interpolate:Yes";
         }
       }
-      scheduleCompact.pushExtensibleGroup(eg.fields());
+      scheduleCompact.pushExtensibleGroup(fields);
     }
 
     return scheduleCompact;
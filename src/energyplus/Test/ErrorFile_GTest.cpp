@@ -114,3 +114,60 @@ TEST_F(EnergyPlusFixture, ErrorFile_WarningsAndCrash) {
   EXPECT_FALSE(errorFile.completed());
   EXPECT_FALSE(errorFile.completedSuccessfully());
 }
+
+TEST_F(EnergyPlusFixture, ErrorFile_Follow) {
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/WarningsAndSevere.err");
+  std::string content;
+  {
+    std::ifstream ifs(openstudio::toString(path), std::ios::binary);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    content = ss.str();
+  }
+
+  openstudio::path followPath = openstudio::filesystem::temp_directory_path() / openstudio::toPath("ErrorFile_Follow.err");
+  if (openstudio::filesystem::exists(followPath)) {
+    openstudio::filesystem::remove(followPath);
+  }
+
+  // Following a file that does not exist yet is fine, nothing is read
+  ErrorFile errorFile(followPath, true);
+  EXPECT_FALSE(errorFile.update());
+  EXPECT_EQ(0u, errorFile.warnings().size());
+  EXPECT_FALSE(errorFile.completed());
+
+  // Append the file in chunks that split lines at arbitrary places, the counts may only grow
+  std::size_t lastWarnings = 0;
+  std::size_t lastSevere = 0;
+  std::size_t lastFatal = 0;
+  const std::size_t chunkSize = 97;
+  for (std::size_t pos = 0; pos < content.size(); pos += chunkSize) {
+    {
+      std::ofstream ofs(openstudio::toString(followPath), std::ios::binary | std::ios::app);
+      ofs << content.substr(pos, chunkSize);
+    }
+    errorFile.update();
+    EXPECT_GE(errorFile.warnings().size(), lastWarnings);
+    EXPECT_GE(errorFile.severeErrors().size(), lastSevere);
+    EXPECT_GE(errorFile.fatalErrors().size(), lastFatal);
+    lastWarnings = errorFile.warnings().size();
+    lastSevere = errorFile.severeErrors().size();
+    lastFatal = errorFile.fatalErrors().size();
+  }
+  errorFile.update(true);
+
+  ErrorFile reference(path);
+  EXPECT_EQ(reference.warnings(), errorFile.warnings());
+  EXPECT_EQ(reference.severeErrors(), errorFile.severeErrors());
+  EXPECT_EQ(reference.fatalErrors(), errorFile.fatalErrors());
+  EXPECT_EQ(reference.completed(), errorFile.completed());
+  EXPECT_EQ(reference.completedSuccessfully(), errorFile.completedSuccessfully());
+
+  // Same result as parsing the whole file at once
+  ErrorFile whole(followPath);
+  EXPECT_EQ(reference.warnings(), whole.warnings());
+  EXPECT_EQ(reference.severeErrors(), whole.severeErrors());
+  EXPECT_EQ(reference.fatalErrors(), whole.fatalErrors());
+
+  openstudio::filesystem::remove(followPath);
+}
@@ -99,6 +99,12 @@
 #include "../../model/CurveBiquadratic_Impl.hpp"
 #include "../../model/CurveQuadratic.hpp"
 #include "../../model/CurveQuadratic_Impl.hpp"
+#include "../../model/ScheduleRuleset.hpp"
+#include "../../model/ScheduleRuleset_Impl.hpp"
+#include "../../model/ScheduleRule.hpp"
+#include "../../model/ScheduleRule_Impl.hpp"
+#include "../../model/YearDescription.hpp"
+#include "../../model/YearDescription_Impl.hpp"
 
 #include "../../utilities/core/Optional.hpp"
 #include "../../utilities/core/Checksum.hpp"
@@ -106,6 +112,7 @@
 #include "../../utilities/core/UUID.hpp"
 #include "../../utilities/sql/SqlFile.hpp"
 #include "../../utilities/idf/IdfFile.hpp"
+#include "../../utilities/idf/IdfObject.hpp"
 #include "../../utilities/idf/IdfExtensibleGroup.hpp"
 #include "../../utilities/idf/WorkspaceExtensibleGroup.hpp"
 #include "../../utilities/idd/IddEnums.hpp"
@@ -113,6 +120,7 @@
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/Version_FieldEnums.hxx>
 #include <utilities/idd/Lights_FieldEnums.hxx>
+#include <utilities/idd/Schedule_Day_Interval_FieldEnums.hxx>
 #include <utilities/idd/Site_Location_FieldEnums.hxx>
 #include <utilities/idd/Foundation_Kiva_Settings_FieldEnums.hxx>
 #include <utilities/idd/Output_Table_SummaryReports_FieldEnums.hxx>
@@ -133,10 +141,12 @@
 #include <utilities/idd/Curve_Biquadratic_FieldEnums.hxx>
 #include <utilities/idd/Curve_Quadratic_FieldEnums.hxx>
 
+#include "../../utilities/time/Date.hpp"
 #include "../../utilities/time/Time.hpp"
 
 #include <resources.hxx>
 
+#include <algorithm>
 #include <sstream>
 
 using namespace openstudio::energyplus;
@@ -442,6 +452,142 @@ TEST_F(EnergyPlusFixture, ReverseTranslatorTest_LargeOffice) {
   EXPECT_EQ("Adiabatic", osurf->outsideBoundaryCondition());
 }
 
+// One string per object of the Model, with its type and all of its fields, sorted. Handles are left out and pointer fields give the name
+// of their target, so Models translated separately can be compared field by field
+static std::vector<std::string> modelObjectsAsStrings(const Model& model) {
+  std::vector<std::string> result;
+  for (const WorkspaceObject& object : model.objects()) {
+    std::string s = object.iddObject().name();
+    for (unsigned i = (object.iddObject().hasHandleField() ? 1 : 0); i < object.numFields(); ++i) {
+      s += "," + object.getString(i).value_or("");
+    }
+    result.push_back(s);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+TEST_F(EnergyPlusFixture, ReverseTranslatorTest_ParallelTranslation) {
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("energyplus/RefLargeOffice/RefBldgLargeOfficeNew2004_Chicago.idf");
+  Workspace ws = Workspace::load(inputPath).get();
+
+  // A Schedule:Year, which needs the YearDescription of the Model
+  for (const std::string& text :
+       {"Schedule:Day:Interval, Year Sch Day, , No, Until: 24:00, 0.5;",
+        "Schedule:Week:Daily, Year Sch Week, Year Sch Day, Year Sch Day, Year Sch Day, Year Sch Day, Year Sch Day, Year Sch Day, Year Sch Day, "
+        "Year Sch Day, Year Sch Day, Year Sch Day, Year Sch Day, Year Sch Day;",
+        "Schedule:Year, Year Sch, , Year Sch Week, 1, 1, 6, 30, Year Sch Week, 7, 1, 12, 31;"}) {
+    OptionalIdfObject idfObject = IdfObject::load(text);
+    ASSERT_TRUE(idfObject);
+    ASSERT_TRUE(ws.addObject(*idfObject));
+  }
+
+  ReverseTranslator rt;
+  EXPECT_FALSE(rt.parallelTranslation());
+  Model serialModel = rt.translateWorkspace(ws);
+
+  ReverseTranslator parallelRt;
+  parallelRt.setParallelTranslation(true);
+  EXPECT_TRUE(parallelRt.parallelTranslation());
+  Model parallelModel = parallelRt.translateWorkspace(ws);
+
+  EXPECT_EQ(serialModel.numObjects(), parallelModel.numObjects());
+  EXPECT_EQ(rt.untranslatedIdfObjects().size(), parallelRt.untranslatedIdfObjects().size());
+  EXPECT_EQ(rt.warnings().size(), parallelRt.warnings().size());
+  EXPECT_EQ(rt.errors().size(), parallelRt.errors().size());
+  EXPECT_EQ(serialModel.getConcreteModelObjects<Construction>().size(), parallelModel.getConcreteModelObjects<Construction>().size());
+  EXPECT_EQ(serialModel.getConcreteModelObjects<StandardOpaqueMaterial>().size(),
+            parallelModel.getConcreteModelObjects<StandardOpaqueMaterial>().size());
+  EXPECT_EQ(serialModel.getConcreteModelObjects<ScheduleCompact>().size(), parallelModel.getConcreteModelObjects<ScheduleCompact>().size());
+
+  // Merging the categories never fails, nor creates a second unique object
+  for (const LogMessage& logMessage : parallelRt.errors()) {
+    EXPECT_EQ(std::string::npos, logMessage.logMessage().find("translated in parallel")) << logMessage.logMessage();
+  }
+
+  // Field by field, the parallel translation gives the same Model as the serial one
+  std::vector<std::string> serialObjects = modelObjectsAsStrings(serialModel);
+  std::vector<std::string> parallelObjects = modelObjectsAsStrings(parallelModel);
+  ASSERT_EQ(serialObjects.size(), parallelObjects.size());
+  for (size_t i = 0; i < serialObjects.size(); ++i) {
+    ASSERT_EQ(serialObjects[i], parallelObjects[i]);
+  }
+
+  ASSERT_EQ(1u, serialModel.getConcreteModelObjects<YearDescription>().size());
+  ASSERT_EQ(1u, parallelModel.getConcreteModelObjects<YearDescription>().size());
+  YearDescription serialYearDescription = serialModel.getUniqueModelObject<YearDescription>();
+  YearDescription parallelYearDescription = parallelModel.getUniqueModelObject<YearDescription>();
+  EXPECT_EQ(serialYearDescription.assumedYear(), parallelYearDescription.assumedYear());
+  EXPECT_EQ(serialYearDescription.dayofWeekforStartDay(), parallelYearDescription.dayofWeekforStartDay());
+
+  OptionalScheduleRuleset serialYearSchedule = serialModel.getConcreteModelObjectByName<ScheduleRuleset>("Year Sch");
+  OptionalScheduleRuleset parallelYearSchedule = parallelModel.getConcreteModelObjectByName<ScheduleRuleset>("Year Sch");
+  ASSERT_TRUE(serialYearSchedule);
+  ASSERT_TRUE(parallelYearSchedule);
+  std::vector<ScheduleRule> serialRules = serialYearSchedule->scheduleRules();
+  std::vector<ScheduleRule> parallelRules = parallelYearSchedule->scheduleRules();
+  ASSERT_FALSE(serialRules.empty());
+  ASSERT_EQ(serialRules.size(), parallelRules.size());
+  for (size_t i = 0; i < serialRules.size(); ++i) {
+    EXPECT_EQ(serialRules[i].startDate(), parallelRules[i].startDate());
+    EXPECT_EQ(serialRules[i].endDate(), parallelRules[i].endDate());
+  }
+
+  // Objects translated in parallel are properly connected to the ones translated afterwards
+  for (const Surface& serialSurface : serialModel.getConcreteModelObjects<Surface>()) {
+    OptionalSurface parallelSurface = parallelModel.getConcreteModelObjectByName<Surface>(serialSurface.nameString());
+    ASSERT_TRUE(parallelSurface);
+    ASSERT_EQ(serialSurface.construction().has_value(), parallelSurface->construction().has_value());
+    if (serialSurface.construction()) {
+      EXPECT_EQ(serialSurface.construction()->nameString(), parallelSurface->construction()->nameString());
+    }
+  }
+
+  // Translating in place gives the same Model, and leaves the geometry of the input converted
+  Workspace ws2 = Workspace::load(inputPath).get();
+  ReverseTranslator inPlaceRt;
+  inPlaceRt.setParallelTranslation(true);
+  Model inPlaceModel = inPlaceRt.translateWorkspaceInPlace(ws2);
+  EXPECT_EQ(serialModel.numObjects(), inPlaceModel.numObjects());
+  EXPECT_EQ(serialModel.getConcreteModelObjects<Surface>().size(), inPlaceModel.getConcreteModelObjects<Surface>().size());
+}
+
+TEST_F(EnergyPlusFixture, ReverseTranslatorTest_ParallelTranslation_Messages) {
+  openstudio::Workspace ws(openstudio::StrictnessLevel::Minimal, openstudio::IddFileType::EnergyPlus);
+
+  // The schedule category logs a warning for the extensible group that has no value
+  openstudio::IdfObject dayInterval(openstudio::IddObjectType::Schedule_Day_Interval);
+  dayInterval.setName("Incomplete Day");
+  IdfExtensibleGroup eg = dayInterval.pushExtensibleGroup();
+  EXPECT_TRUE(eg.setString(Schedule_Day_IntervalExtensibleFields::Time, "Until: 24:00"));
+  ASSERT_TRUE(ws.addObject(dayInterval));
+
+  openstudio::IdfObject compact(openstudio::IddObjectType::Schedule_Compact);
+  compact.setName("Averaged");
+  for (const std::string& field : {"Through: 12/31", "For: AllDays", "Interpolate:Average", "Until: 24:00", "1"}) {
+    compact.pushExtensibleGroup({field});
+  }
+  WorkspaceObject epCompact = ws.addObject(compact).get();
+
+  for (bool parallel : {false, true}) {
+    ReverseTranslator rt;
+    rt.setParallelTranslation(parallel);
+    Model model = rt.translateWorkspace(ws);
+
+    std::vector<LogMessage> warnings = rt.warnings();
+    auto n = std::count_if(warnings.begin(), warnings.end(), [](const LogMessage& logMessage) {
+      return logMessage.logMessage().find("Encountered extensible group with incomplete or improperly formatted data") != std::string::npos;
+    });
+    EXPECT_EQ(1, n) << (parallel ? "parallel" : "serial");
+
+    // Interpolate:Average is translated, but the Workspace is left as is
+    std::vector<ScheduleCompact> schedules = model.getConcreteModelObjects<ScheduleCompact>();
+    ASSERT_EQ(1u, schedules.size());
+    EXPECT_EQ("Interpolate:Yes", schedules[0].extensibleGroups()[2].getString(0).get());
+    EXPECT_EQ("Interpolate:Average", epCompact.extensibleGroups()[2].getString(0).get());
+  }
+}
+
 TEST_F(EnergyPlusFixture, ReverseTranslatorTest_ZoneBoundaryCondition) {
   openstudio::path inputPath = resourcesPath() / openstudio::toPath("energyplus/ZoneBoundaryCondition/Bug_486_zone_bdr_test.idf");
   Workspace ws = Workspace::load(inputPath).get();
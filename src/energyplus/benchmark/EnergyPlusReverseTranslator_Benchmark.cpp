@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include "../ReverseTranslator.hpp"
+
+#include "../../model/Model.hpp"
+
+#include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/FileLogSink.hpp"
+#include "../../utilities/idf/IdfFile.hpp"
+#include "../../utilities/idf/Workspace.hpp"
+
+#include <fmt/format.h>
+
+#include <sstream>
+
+using namespace openstudio;
+using namespace openstudio::model;
+using namespace openstudio::energyplus;
+
+// A synthetic IDF as exported by other tools: each of the nZones blocks has its own material, construction, schedule, curve, zone and floor
+static IdfFile makeIdfFileWithNZones(size_t nZones) {
+  std::stringstream ss;
+  ss << "Version,23.1;\n";
+  ss << "GlobalGeometryRules,UpperLeftCorner,Counterclockwise,Relative;\n";
+  ss << "ScheduleTypeLimits,Fraction,0,1,Continuous;\n";
+  for (size_t i = 0; i < nZones; ++i) {
+    const double x = 10.0 * static_cast<double>(i % 100);
+    const double y = 10.0 * static_cast<double>(i / 100);
+    ss << fmt::format("Material,Material {0},MediumRough,0.1,1.0,2000,900;\n", i);
+    ss << fmt::format("Construction,Construction {0},Material {0};\n", i);
+    ss << fmt::format("Schedule:Constant,Schedule {0},Fraction,0.5;\n", i);
+    ss << fmt::format("Curve:Quadratic,Curve {0},1.0,0.1,0.01,0.0,1.0;\n", i);
+    ss << fmt::format("Zone,Zone {0};\n", i);
+    ss << fmt::format("BuildingSurface:Detailed,Floor {0},Floor,Construction {0},Zone {0},,Ground,,NoSun,NoWind,AutoCalculate,4,"
+                      "{1},{4},0,{1},{2},0,{3},{2},0,{3},{4},0;\n",
+                      i, x, y, x + 10.0, y + 10.0);
+  }
+  return IdfFile::load(ss, IddFileType::EnergyPlus).get();
+}
+
+static void BM_RT_TranslateWorkspace(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./EnergyPlusReverseTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Workspace workspace(makeIdfFileWithNZones(state.range(0)));
+
+  for (auto _ : state) {
+    ReverseTranslator reverseTranslator;
+    benchmark::DoNotOptimize(reverseTranslator.translateWorkspace(workspace));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_RT_TranslateWorkspaceInPlace(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./EnergyPlusReverseTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  IdfFile idfFile = makeIdfFileWithNZones(state.range(0));
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    Workspace workspace(idfFile);
+    state.ResumeTiming();
+
+    ReverseTranslator reverseTranslator;
+    reverseTranslator.setParallelTranslation(state.range(1) != 0);
+    benchmark::DoNotOptimize(reverseTranslator.translateWorkspaceInPlace(workspace));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_RT_TranslateWorkspace)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(64, 4096)->Complexity();
+
+BENCHMARK(BM_RT_TranslateWorkspaceInPlace)->Unit(benchmark::kMillisecond)->Ranges({{64, 4096}, {0, 1}})->Complexity();
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include "../ForwardTranslator.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../epjson/epJSONTranslator.hpp"
+
+#include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/FileLogSink.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/idf/Workspace.hpp"
+
+#include <json/json.h>
+
+#include <fstream>
+
+using namespace openstudio;
+using namespace openstudio::model;
+using namespace openstudio::energyplus;
+
+// These measure the latency between the start of the forward translation and the moment the EnergyPlus input file is on disk, ie what
+// the workflow does before it can launch EnergyPlus, for the three possible input paths
+
+static void BM_FT_ExampleModel_SaveIDF(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./SimulationInput_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Model model = exampleModel();
+  const openstudio::path outPath = openstudio::filesystem::temp_directory_path() / toPath("SimulationInput_Benchmark.idf");
+
+  for (auto _ : state) {
+    ForwardTranslator forwardTranslator;
+    Workspace workspace = forwardTranslator.translateModel(model);
+    workspace.save(outPath, true);
+  }
+
+  openstudio::filesystem::remove(outPath);
+}
+
+static void BM_FT_ExampleModel_SaveEpJSON_DOM(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./SimulationInput_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Model model = exampleModel();
+  const openstudio::path outPath = openstudio::filesystem::temp_directory_path() / toPath("SimulationInput_Benchmark_DOM.epJSON");
+
+  for (auto _ : state) {
+    ForwardTranslator forwardTranslator;
+    Workspace workspace = forwardTranslator.translateModel(model);
+    Json::Value jsonVal = openstudio::epJSON::toJSON(workspace);
+    std::ofstream ofs(openstudio::toString(outPath), std::ofstream::trunc);
+    ofs << jsonVal.toStyledString() << '\n';
+  }
+
+  openstudio::filesystem::remove(outPath);
+}
+
+static void BM_FT_ExampleModel_SaveEpJSON_Direct(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./SimulationInput_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Model model = exampleModel();
+  const openstudio::path outPath = openstudio::filesystem::temp_directory_path() / toPath("SimulationInput_Benchmark_Direct.epJSON");
+
+  for (auto _ : state) {
+    ForwardTranslator forwardTranslator;
+    Workspace workspace = forwardTranslator.translateModel(model);
+    std::ofstream ofs(openstudio::toString(outPath), std::ofstream::trunc);
+    benchmark::DoNotOptimize(openstudio::epJSON::toJSON(workspace, ofs));
+  }
+
+  openstudio::filesystem::remove(outPath);
+}
+
+BENCHMARK(BM_FT_ExampleModel_SaveIDF)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FT_ExampleModel_SaveEpJSON_DOM)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FT_ExampleModel_SaveEpJSON_Direct)->Unit(benchmark::kMillisecond);
@@ -9,11 +9,18 @@
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
 #include "../utilities/idf/WorkspaceExtensibleGroup.hpp"
 #include "../utilities/core/ApplicationPathHelpers.hpp"
+#include "../utilities/core/FilesystemHelpers.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
 #include <json/json.h>
 #include <fmt/format.h>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
 #include <vector>
 #include <string_view>
 
@@ -148,56 +155,150 @@ JSONValueType schemaPropertyTypeDecode(const Json::Value& type) {
   return JSONValueType::NumberOrString;
 }
 
-/** Locate the properties for a given field of an object.
- * - group_name can be empty, or it's the name of the extensible group.
- * - field_name is the name of the field
- * - field_property_name is something like 'type', 'anyOf', or 'enum'
- *
- * if group_name is empty:
- *  getSchemaObjectProperties > [field_name] > [field_property_name]
- * else:
- *  getSchemaObjectProperties > [group_name] > items > properties > [field_name] > [field_property_name]
- */
-const Json::Value& getSchemaObjectFieldProperty(const Json::Value& schema, const std::string& type_description, const std::string& group_name,
-                                                const std::string& field_name, const std::string& field_property_name) {
+/** Precompiled lookups into the epJSON schema for one field: its type and the properties used to fix up the enumeration values */
+struct SchemaFieldInfo
+{
+  JSONValueType type = JSONValueType::NumberOrString;
+  // 'enum' property, for ChoiceType fields
+  const Json::Value* enumValues = nullptr;
+  // 'anyOf' property, for RealType fields that also accept 'Autosize' / 'Autocalculate'
+  const Json::Value* anyOf = nullptr;
+};
+
+/** Precompiled lookups into the epJSON schema for one object type, so that translating a field does not walk the schema tree again */
+struct SchemaObjectInfo
+{
+  // Name of the extensible group, if the object has an array one
+  std::string groupName;
+  bool isArrayGroup = false;
+  // Legacy IDD field names
+  const Json::Value* legacyFieldNames = nullptr;
+  // getSchemaObjectProperties > [field_name]
+  std::unordered_map<std::string, SchemaFieldInfo> fields;
+  // getSchemaObjectProperties > [groupName] > items > properties > [field_name]
+  std::unordered_map<std::string, SchemaFieldInfo> groupFields;
+
+  /** group_name can be empty, or it's the name of the extensible group. */
+  const SchemaFieldInfo& field(const std::string& group_name, const std::string& field_name) const {
+    static const SchemaFieldInfo unknownField;
+    const auto& t_fields = group_name.empty() ? fields : groupFields;
+    if (const auto it = t_fields.find(field_name); it != t_fields.end()) {
+      return it->second;
+    }
+    return unknownField;
+  }
+};
+
+SchemaFieldInfo compileSchemaField(const Json::Value& fieldProperties) {
+  SchemaFieldInfo result;
+  if (!fieldProperties.isObject()) {
+    return result;
+  }
+  result.type = schemaPropertyTypeDecode(fieldProperties["type"]);
+  if (const auto& enumValues = fieldProperties["enum"]; !enumValues.isNull()) {
+    result.enumValues = &enumValues;
+  }
+  if (const auto& anyOf = fieldProperties["anyOf"]; anyOf.isArray()) {
+    result.anyOf = &anyOf;
+  }
+  return result;
+}
+
+SchemaObjectInfo compileSchemaObject(const Json::Value& schema, const std::string& type_description) {
+  SchemaObjectInfo result;
+  result.legacyFieldNames = &getSchemaFieldNames(schema, type_description);
 
   const auto& objectProperties = getSchemaObjectProperties(schema, type_description);
+  if (!objectProperties.isObject()) {
+    return result;
+  }
 
-  if (group_name.empty()) {
-    return safeLookupValue(objectProperties, field_name, field_property_name);
-  } else {
-    return safeLookupValue(objectProperties, group_name, "items", "properties", field_name, field_property_name);
+  for (const auto& propertyName : objectProperties.getMemberNames()) {
+    const auto& property = objectProperties[propertyName];
+    result.fields.emplace(propertyName, compileSchemaField(property));
+
+    // The extensible group is the first array property. Group name is irrelevant if it's not an array group
+    const auto& type = safeLookupValue(property, "type");
+    if (!result.isArrayGroup && type.isString() && (type.asString() == "array")) {
+      result.groupName = propertyName;
+      result.isArrayGroup = true;
+      const auto& itemProperties = safeLookupValue(property, "items", "properties");
+      if (itemProperties.isObject()) {
+        for (const auto& itemName : itemProperties.getMemberNames()) {
+          result.groupFields.emplace(itemName, compileSchemaField(itemProperties[itemName]));
+        }
+      }
+    }
   }
+
+  return result;
 }
 
-/** Find the 'type' property of a field and convert that to enum.*/
-JSONValueType getSchemaObjectFieldPropertyType(const Json::Value& schema, const std::string& type_description, const std::string& group_name,
-                                               const std::string& field_name) {
-  JSONValueType type = schemaPropertyTypeDecode(getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "type"));
-  if (type == JSONValueType::NumberOrString) {
-    LOG_FREE(LogLevel::Warn, "epJSONTranslator",
-             "Unknown value passed to schemaPropertyTypeDecode, returning generic 'NumberOrString' Option. "
-               << "Occurred for type_description= " << type_description << ", group_name=" << group_name << ", field_name=" << field_name);
+/** A parsed epJSON schema, shared by all translations in the process. Object types are indexed lazily, the first time they are translated */
+class CompiledSchema
+{
+ public:
+  explicit CompiledSchema(Json::Value root) : m_root(std::move(root)) {}
+
+  const SchemaObjectInfo& objectInfo(const std::string& type_description) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_objects.find(type_description);
+    if (it == m_objects.end()) {
+      it = m_objects.emplace(type_description, compileSchemaObject(m_root, type_description)).first;
+    }
+    // References into an unordered_map stay valid when it grows
+    return it->second;
+  }
+
+ private:
+  const Json::Value m_root;
+  mutable std::mutex m_mutex;
+  mutable std::unordered_map<std::string, SchemaObjectInfo> m_objects;
+};
+
+/** Parses the schema once per process (and per modification of the file) */
+std::shared_ptr<const CompiledSchema> compiledSchema(const openstudio::path& schemaPath) {
+  static std::mutex cacheMutex;
+  static std::map<std::pair<std::string, std::time_t>, std::shared_ptr<const CompiledSchema>> cache;
+
+  if (!openstudio::filesystem::is_regular_file(schemaPath)) {
+    return nullptr;
   }
-  return type;
+  const auto key = std::pair{openstudio::toString(schemaPath), openstudio::filesystem::last_write_time_as_time_t(schemaPath)};
+
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  if (const auto it = cache.find(key); it != cache.end()) {
+    return it->second;
+  }
+
+  Json::Value root = loadJSON(schemaPath);
+  if (root.isNull()) {
+    return nullptr;
+  }
+
+  // Drop a schema parsed from an older version of the file
+  for (auto it = cache.begin(); it != cache.end();) {
+    it = (it->first.first == key.first) ? cache.erase(it) : std::next(it);
+  }
+
+  return cache.emplace(key, std::make_shared<const CompiledSchema>(std::move(root))).first->second;
 }
 
 /** epJSON (unlike IDF) is case sensitive, so this routine find the correct 'enum' choice casing
  * It applies to fieldType = 'ChoiceType' or 'RealType' (since RealType can also be `anyOf` with values like 'Autosize' 'Autocalculate'))
  * eg: if given value='autosize', will convert it to 'Autosize' so that EnergyPlus' InputParser does recognize it */
-std::string fixupEnumerationValue(const Json::Value& schema, const std::string& value, const std::string& type_description,
-                                  const std::string& group_name, const std::string& field_name, const openstudio::IddFieldType fieldType) {
+std::string fixupEnumerationValue(const SchemaFieldInfo& fieldInfo, const std::string& value, const std::string& group_name,
+                                  const std::string& field_name, const openstudio::IddFieldType fieldType) {
 
   if (fieldType == openstudio::IddFieldType::ChoiceType) {
-    const auto& fieldProperty = getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "enum");
     const auto lower = boost::to_lower_copy(value);
 
-    if (fieldProperty.isNull()) {
+    if (fieldInfo.enumValues == nullptr) {
       LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find enum value for " << value << " in " << group_name << "::" << field_name)
       return value;
     }
 
-    for (const auto& enumOption : fieldProperty) {
+    for (const auto& enumOption : *fieldInfo.enumValues) {
       if (enumOption.isString()) {
         const auto& enumStr = enumOption.asString();
         if (boost::to_lower_copy(enumStr) == lower) {
@@ -212,12 +313,10 @@ std::string fixupEnumerationValue(const Json::Value& schema, const std::string&
 
   if (fieldType == openstudio::IddFieldType::RealType) {
 
-    const auto& fieldProperty = getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "anyOf");
-
-    if (fieldProperty.isArray()) {
+    if (fieldInfo.anyOf != nullptr) {
       const auto lower = boost::to_lower_copy(value);
 
-      for (const auto& possibleValues : fieldProperty) {
+      for (const auto& possibleValues : *fieldInfo.anyOf) {
         const auto& enumOptions = possibleValues["enum"];
         if (enumOptions.isArray()) {
           for (const auto& enumOption : enumOptions) {
@@ -247,36 +346,6 @@ std::string fixupEnumerationValue(const Json::Value& schema, const std::string&
   return value;
 }
 
-/* Find name of an extensible group and cache it */
-auto getGroupName(std::map<std::pair<std::string, std::string>, std::pair<std::string, bool>>& group_names,
-                  std::map<std::string, std::string>& /*field_names*/, const Json::Value& schema, const std::string& type_description,
-                  const std::string& group_name) -> const auto& {
-
-  const auto key = std::pair{type_description, group_name};
-
-  if (const auto cached = group_names.find(key); cached != group_names.end()) {
-    return cached->second;
-  }
-
-  const auto cache_result = [&](const auto& name, const bool is_array) -> const auto& {
-    return group_names.emplace(key, std::pair{name, is_array}).first->second;
-  };
-
-  const auto& objectProperties = getSchemaObjectProperties(schema, type_description);
-
-  for (const auto& propertyName : objectProperties.getMemberNames()) {
-    const auto& type = safeLookupValue(objectProperties, propertyName, "type");
-    if (type.isString()) {
-      if (type.asString() == "array") {
-        return cache_result(propertyName, true);
-      }
-    }
-  }
-
-  // group name is irrelevant if it's not an array group
-  return cache_result("", false);
-}
-
 openstudio::path defaultSchemaPath(openstudio::IddFileType filetype) {
   openstudio::path schemaPath;
   if (filetype == openstudio::IddFileType::EnergyPlus) {
@@ -302,14 +371,14 @@ Json::Value loadJSON(const openstudio::path& path) {
   return root;
 }
 
-std::string getFieldName(const bool is_array, const IddObject& iddObject, const Json::Value& schema, const std::string& type_description,
-                         const std::size_t group_number, const std::size_t field_number, std::string_view field_name) {
+std::string getFieldName(const bool is_array, const IddObject& iddObject, const SchemaObjectInfo& objectInfo, const std::size_t group_number,
+                         const std::size_t field_number, std::string_view field_name) {
   if (is_array) {
     return std::string{field_name};
   }
 
   // Legacy IDD field names
-  const auto& fieldNames = getSchemaFieldNames(schema, type_description);
+  const auto& fieldNames = *objectInfo.legacyFieldNames;
 
   // use the index of the field inside of the IddObject to look up what its name should be
   // inside of the epJSON schema
@@ -318,181 +387,280 @@ std::string getFieldName(const bool is_array, const IddObject& iddObject, const
   const auto& lookedUpFieldName =
     fieldNames[static_cast<int>((group_number - 1) * iddObject.extensibleGroup().size() + field_number + iddObject.nonextensibleFields().size())];
 
-  LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to look up field name for input field" << field_name)
+  if (!lookedUpFieldName.isString()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to look up field name for input field" << field_name)
+  }
   OS_ASSERT(lookedUpFieldName.isString());
   return lookedUpFieldName.asString();
 }
 
-Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schemaPath) {
-
+/** Find the schema to translate to, logs and returns nullptr if it cannot be loaded */
+std::shared_ptr<const CompiledSchema> resolveSchema(const openstudio::path& schemaPath, openstudio::IddFileType fileType) {
   openstudio::path schemaToLoad = schemaPath;
   if (schemaToLoad.empty()) {
-    schemaToLoad = defaultSchemaPath(idf.iddFileType());
+    schemaToLoad = defaultSchemaPath(fileType);
     if (schemaToLoad.empty()) {
-      return Json::Value::null;
+      return nullptr;
     }
   }
 
-  std::map<std::string, int> type_counts;
+  auto schema = compiledSchema(schemaToLoad);
+  if (!schema) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Schema is invalid at path=" << schemaToLoad);
+  }
+  return schema;
+}
 
-  Json::Value result;
+std::string versionIdentifier(const openstudio::VersionString& version) {
+  return fmt::format("{}.{}", version.major(), version.minor());
+}
 
-  std::map<std::pair<std::string, std::string>, std::pair<std::string, bool>> group_names;
-  std::map<std::string, std::string> field_names;
+/** The key of the object inside of its type group */
+std::string jsonObjectName(const openstudio::IdfObject& obj, const std::string& type_description, std::map<std::string, int>& type_counts) {
+  const bool is_fluid_properties_name = type_description.find("FluidProperties:Name") != std::string::npos;
 
-  Json::Value schema = loadJSON(schemaToLoad);
-  if (schema.isNull()) {
-    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Schema is invalid at path=" << schemaToLoad);
-    return Json::Value::null;
+  if (const auto name = obj.name(); name && !is_fluid_properties_name) {
+    return *name;
   }
 
-  result["Version"]["Version 1"]["version_identifier"] = fmt::format("{}.{}", idf.version().major(), idf.version().minor());
-
-  for (const auto& obj : idf.objects()) {
-    if (obj.iddObject().type().value() == openstudio::IddObjectType::CommentOnly) {
-      // we aren't translating comments it seems
-      continue;
-    }
+  const auto defaultedName = obj.nameString(true);
+  if (!defaultedName.empty() && !is_fluid_properties_name) {
+    return defaultedName;
+  }
 
-    const auto& type_description = obj.iddObject().type().valueDescription();
+  return fmt::format("{} {}", type_description, ++type_counts[type_description]);
+}
 
-    const auto& name = obj.name();
-    const auto& defaultedName = obj.nameString(true);
+/** Translate all the fields of an object (its name being the key, see jsonObjectName) */
+Json::Value translateObject(const CompiledSchema& schema, const openstudio::IdfObject& obj, const std::string& type_description,
+                            std::map<std::string, std::string>& field_names) {
 
-    auto& json_group = result[type_description];
+  const auto& objectInfo = schema.objectInfo(type_description);
 
-    const bool is_fluid_properties_name = type_description.find("FluidProperties:Name") != std::string::npos;
-    const bool is_lcc_use_price_escalation = type_description.find("LifeCycleCost:UsePriceEscalation") != std::string::npos;
+  const auto& name = obj.name();
 
-    const auto& usable_json_object_name = [&]() {
-      if (name && !is_fluid_properties_name) {
-        return *name;
-      } else {
-        if (!defaultedName.empty() && !is_fluid_properties_name) {
-          return defaultedName;
-        } else {
-          return fmt::format("{} {}", type_description, ++type_counts[type_description]);
-        }
-      }
-    }();
+  Json::Value json_object(Json::objectValue);
 
-    auto& json_object = json_group[usable_json_object_name];
-    json_object = Json::Value(Json::objectValue);
+  const bool is_fluid_properties_name = type_description.find("FluidProperties:Name") != std::string::npos;
+  const bool is_lcc_use_price_escalation = type_description.find("LifeCycleCost:UsePriceEscalation") != std::string::npos;
 
-    if (name) {
-      if (is_fluid_properties_name) {
-        json_object["fluid_name"] = *name;
-      } else if (is_lcc_use_price_escalation) {
-        json_object["lcc_price_escalation_name"] = *name;
-      }
+  if (name) {
+    if (is_fluid_properties_name) {
+      json_object["fluid_name"] = *name;
+    } else if (is_lcc_use_price_escalation) {
+      json_object["lcc_price_escalation_name"] = *name;
     }
+  }
 
-    const auto visitField = [&schema, &type_description](auto&& visitor, const openstudio::IddField& iddField, const std::string& group_name,
-                                                         const auto& fieldName, const auto& field, const auto idx) -> bool {
-      const auto jsonFieldType = getSchemaObjectFieldPropertyType(schema, type_description, group_name, fieldName);
+  const auto visitField = [&objectInfo, &type_description](auto&& visitor, const openstudio::IddField& iddField, const std::string& group_name,
+                                                           const auto& fieldName, const auto& field, const auto idx) -> bool {
+    const auto& fieldInfo = objectInfo.field(group_name, fieldName);
+    const auto jsonFieldType = fieldInfo.type;
+    if (jsonFieldType == JSONValueType::NumberOrString) {
+      LOG_FREE(LogLevel::Warn, "epJSONTranslator",
+               "Unknown value passed to schemaPropertyTypeDecode, returning generic 'NumberOrString' Option. "
+                 << "Occurred for type_description= " << type_description << ", group_name=" << group_name << ", field_name=" << fieldName);
+    }
 
-      switch (jsonFieldType) {
-        case JSONValueType::String: {
-          const auto fieldString = field.getString(idx);
-          if (fieldString && !fieldString->empty()) {
-            visitor(fixupEnumerationValue(schema, *fieldString, type_description, group_name, fieldName, iddField.properties().type));
-            return true;
-          }
+    switch (jsonFieldType) {
+      case JSONValueType::String: {
+        const auto fieldString = field.getString(idx);
+        if (fieldString && !fieldString->empty()) {
+          visitor(fixupEnumerationValue(fieldInfo, *fieldString, group_name, fieldName, iddField.properties().type));
+          return true;
         }
-        case JSONValueType::Integer: {
-          const auto fieldInt = field.getInt(idx);
-          if (fieldInt) {
-            visitor(*fieldInt);
-            return true;
-          }
+      }
+      case JSONValueType::Integer: {
+        const auto fieldInt = field.getInt(idx);
+        if (fieldInt) {
+          visitor(*fieldInt);
+          return true;
         }
-        case JSONValueType::Number:
-        case JSONValueType::NumberOrString: {
-          const auto fieldDouble = field.getDouble(idx);
+      }
+      case JSONValueType::Number:
+      case JSONValueType::NumberOrString: {
+        const auto fieldDouble = field.getDouble(idx);
 
-          if (fieldDouble) {
-            const auto fieldInt = field.getInt(idx);
+        if (fieldDouble) {
+          const auto fieldInt = field.getInt(idx);
 
-            if (fieldInt && static_cast<double>(*fieldInt) == *fieldDouble) {
-              if (iddField.name().find("Number") != std::string::npos) {
-                visitor(*fieldInt);
-                return true;
-              }
+          if (fieldInt && static_cast<double>(*fieldInt) == *fieldDouble) {
+            if (iddField.name().find("Number") != std::string::npos) {
+              visitor(*fieldInt);
+              return true;
             }
-
-            visitor(*fieldDouble);
-            return true;
           }
+
+          visitor(*fieldDouble);
+          return true;
         }
-        case JSONValueType::Array:
-        case JSONValueType::Object:
-          break;
       }
+      case JSONValueType::Array:
+      case JSONValueType::Object:
+        break;
+    }
 
-      {
-        const auto fieldString = field.getString(idx);
-        if (fieldString && !fieldString->empty()) {
-          visitor(fixupEnumerationValue(schema, *fieldString, type_description, group_name, fieldName, iddField.properties().type));
+    {
+      const auto fieldString = field.getString(idx);
+      if (fieldString && !fieldString->empty()) {
+        visitor(fixupEnumerationValue(fieldInfo, *fieldString, group_name, fieldName, iddField.properties().type));
 
-          return true;
-        }
+        return true;
       }
+    }
 
-      return false;
-    };
+    return false;
+  };
 
-    std::size_t cur_group_number = 0;
+  std::size_t cur_group_number = 0;
 
-    for (const auto& g : obj.extensibleGroups()) {
-      ++cur_group_number;
-      // get first field and try to make a group name out of it
-      const auto& [group_name, is_array_group] =
-        openstudio::epJSON::getGroupName(group_names, field_names, schema, type_description, obj.iddObject().extensibleGroup()[0].name());
+  const auto& group_name = objectInfo.groupName;
+  const bool is_array_group = objectInfo.isArrayGroup;
 
-      auto& containing_json = [&json_object, &group_name = group_name, is_array_group = is_array_group ]() -> auto& {
-        if (is_array_group) {
-          auto& array_obj = json_object[group_name];
-          return array_obj.append(Json::Value{Json::objectValue});
-        } else {
-          return json_object;
-        }
+  for (const auto& g : obj.extensibleGroups()) {
+    ++cur_group_number;
+
+    auto& containing_json = [&json_object, &group_name, is_array_group]() -> auto& {
+      if (is_array_group) {
+        auto& array_obj = json_object[group_name];
+        return array_obj.append(Json::Value{Json::objectValue});
+      } else {
+        return json_object;
       }
-      ();
+    }
+    ();
 
-      for (unsigned int idx = 0; idx < g.numFields(); ++idx) {
-        const auto& iddField = obj.iddObject().extensibleGroup()[idx];
+    for (unsigned int idx = 0; idx < g.numFields(); ++idx) {
+      const auto& iddField = obj.iddObject().extensibleGroup()[idx];
 
-        const auto fieldName = getFieldName(is_array_group, obj.iddObject(), schema, type_description, cur_group_number, idx,
-                                            toJSONFieldName(field_names, iddField.name()));
+      const auto fieldName =
+        getFieldName(is_array_group, obj.iddObject(), objectInfo, cur_group_number, idx, toJSONFieldName(field_names, iddField.name()));
 
-        [[maybe_unused]] const auto fieldAdded = visitField([&containing_json, &fieldName](const auto& value) { containing_json[fieldName] = value; },
-                                                            iddField, group_name, fieldName, g, idx);
-      }
+      [[maybe_unused]] const auto fieldAdded = visitField([&containing_json, &fieldName](const auto& value) { containing_json[fieldName] = value; },
+                                                          iddField, group_name, fieldName, g, idx);
     }
+  }
 
-    for (unsigned int idx = 0; idx < obj.numFields(); ++idx) {
-      const auto& iddField = obj.iddObject().getField(idx);
+  for (unsigned int idx = 0; idx < obj.numFields(); ++idx) {
+    const auto& iddField = obj.iddObject().getField(idx);
 
-      const auto& fieldName = toJSONFieldName(field_names, iddField->name());
+    const auto& fieldName = toJSONFieldName(field_names, iddField->name());
 
-      if (iddField->isNameField()) {
-        // skip name, we already got that
-        continue;
-      }
+    if (iddField->isNameField()) {
+      // skip name, we already got that
+      continue;
+    }
 
-      if (obj.iddObject().isExtensibleField(idx)) {
-        // skip extensible field, we already dealt with that
-        continue;
-      }
+    if (obj.iddObject().isExtensibleField(idx)) {
+      // skip extensible field, we already dealt with that
+      continue;
+    }
+
+    visitField([&json_object, &fieldName](const auto& value) { json_object[fieldName] = value; }, iddField.get(), "", fieldName, obj, idx);
+  }
+
+  return json_object;
+}
+
+template <typename ObjectType, typename ToIdfObject>
+Json::Value toJSONImpl(const std::vector<ObjectType>& objects, const openstudio::VersionString& version, const CompiledSchema& schema,
+                       ToIdfObject toIdfObject) {
+  Json::Value result;
+
+  result["Version"]["Version 1"]["version_identifier"] = versionIdentifier(version);
 
-      visitField([&json_object, &fieldName](const auto& value) { json_object[fieldName] = value; }, iddField.get(), "", fieldName, obj, idx);
+  std::map<std::string, int> type_counts;
+  std::map<std::string, std::string> field_names;
+
+  for (const auto& obj : objects) {
+    if (obj.iddObject().type().value() == openstudio::IddObjectType::CommentOnly) {
+      // we aren't translating comments it seems
+      continue;
     }
+
+    const auto& type_description = obj.iddObject().type().valueDescription();
+    const auto usable_json_object_name = jsonObjectName(obj, type_description, type_counts);
+
+    result[type_description][usable_json_object_name] = translateObject(schema, toIdfObject(obj), type_description, field_names);
   }
+
   return result;
 }
 
+template <typename ObjectType, typename ToIdfObject>
+bool toJSONImpl(const std::vector<ObjectType>& objects, const openstudio::VersionString& version, const CompiledSchema& schema, std::ostream& os,
+                ToIdfObject toIdfObject) {
+
+  // First pass only collects the keys: epJSON groups the objects by type, and (like the Json::Value translation) a later object replaces
+  // an earlier one with the same name
+  std::map<std::string, int> type_counts;
+  std::map<std::string, std::map<std::string, size_t>> objectIndices;
+  for (size_t i = 0; i < objects.size(); ++i) {
+    const auto& obj = objects[i];
+    if (obj.iddObject().type().value() == openstudio::IddObjectType::CommentOnly) {
+      continue;
+    }
+    const auto& type_description = obj.iddObject().type().valueDescription();
+    objectIndices[type_description][jsonObjectName(obj, type_description, type_counts)] = i;
+  }
+
+  Json::StreamWriterBuilder builder;
+  builder["indentation"] = "";
+  const std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+
+  std::map<std::string, std::string> field_names;
+
+  // Then each object is translated and written on its own, the whole document is never held in memory
+  os << "{\n  \"Version\": {\n    \"Version 1\": {\"version_identifier\": " << Json::valueToQuotedString(versionIdentifier(version).c_str())
+     << "}\n  }";
+  for (const auto& [type_description, indices] : objectIndices) {
+    os << ",\n  " << Json::valueToQuotedString(type_description.c_str()) << ": {";
+    bool first = true;
+    for (const auto& [name, i] : indices) {
+      os << (first ? "\n    " : ",\n    ") << Json::valueToQuotedString(name.c_str()) << ": ";
+      writer->write(translateObject(schema, toIdfObject(objects[i]), type_description, field_names), &os);
+      first = false;
+    }
+    os << "\n  }";
+  }
+  os << "\n}\n";
+
+  return os.good();
+}
+
+Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schemaPath) {
+  const auto schema = resolveSchema(schemaPath, idf.iddFileType());
+  if (!schema) {
+    return Json::Value::null;
+  }
+  return toJSONImpl(idf.objects(), idf.version(), *schema, [](const openstudio::IdfObject& obj) -> const openstudio::IdfObject& { return obj; });
+}
+
 Json::Value toJSON(const openstudio::Workspace& workspace, const openstudio::path& schemaPath) {
-  return toJSON(workspace.toIdfFile(), schemaPath);
+  const auto schema = resolveSchema(schemaPath, workspace.iddFileType());
+  if (!schema) {
+    return Json::Value::null;
+  }
+  // Same as going through workspace.toIdfFile(), but only one IdfObject (with pointers replaced by names) exists at a time
+  return toJSONImpl(workspace.objects(true), workspace.version(), *schema, [](const openstudio::WorkspaceObject& obj) { return obj.idfObject(); });
+}
+
+bool toJSON(const openstudio::IdfFile& idf, std::ostream& os, const openstudio::path& schemaPath) {
+  const auto schema = resolveSchema(schemaPath, idf.iddFileType());
+  if (!schema) {
+    return false;
+  }
+  return toJSONImpl(idf.objects(), idf.version(), *schema, os,
+                    [](const openstudio::IdfObject& obj) -> const openstudio::IdfObject& { return obj; });
+}
+
+bool toJSON(const openstudio::Workspace& workspace, std::ostream& os, const openstudio::path& schemaPath) {
+  const auto schema = resolveSchema(schemaPath, workspace.iddFileType());
+  if (!schema) {
+    return false;
+  }
+  return toJSONImpl(workspace.objects(true), workspace.version(), *schema, os,
+                    [](const openstudio::WorkspaceObject& obj) { return obj.idfObject(); });
 }
 
 std::string toJSONString(const openstudio::IdfFile& inputFile, const openstudio::path& schemaPath) {
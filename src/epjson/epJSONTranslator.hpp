@@ -29,6 +29,7 @@
 #ifndef EPJSON_TRANSLATOR_HPP
 #define EPJSON_TRANSLATOR_HPP
 
+#include <iosfwd>
 #include <string>
 #include "epJSONAPI.hpp"
 
@@ -56,6 +57,11 @@ EPJSON_API std::string toJSONString(const openstudio::IdfFile& inputFile, const
 EPJSON_API Json::Value toJSON(const openstudio::Workspace& workspace, const openstudio::path& schemaPath = openstudio::path());
 EPJSON_API std::string toJSONString(const openstudio::Workspace& workspace, const openstudio::path& schemaPath = openstudio::path());
 
+/** Writes the epJSON to the stream one object at a time, without building the whole Json::Value tree first.
+ *  The schema is parsed once per process and shared by all translations. Returns false if the schema cannot be loaded or the write failed */
+EPJSON_API bool toJSON(const openstudio::IdfFile& inputFile, std::ostream& os, const openstudio::path& schemaPath = openstudio::path());
+EPJSON_API bool toJSON(const openstudio::Workspace& workspace, std::ostream& os, const openstudio::path& schemaPath = openstudio::path());
+
 }  // namespace openstudio::epJSON
 
 #endif
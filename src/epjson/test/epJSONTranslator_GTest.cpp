@@ -54,6 +54,7 @@
 #include <json/json.h>
 #include <resources.hxx>
 #include <algorithm>
+#include <sstream>
 
 TEST_F(epJSONFixture, TranslateIDFToEPJSON_RefBldgMediumOfficeNew2004_Chicago) {
   compareEPJSONTranslations("RefBldgMediumOfficeNew2004_Chicago.idf");
@@ -197,6 +198,77 @@ TEST_F(epJSONFixture, canTranslateWorkspaceToJSON) {
   EXPECT_TRUE(str1.size() > 100);
 }
 
+Json::Value parseStreamedEPJSON(const std::string& str) {
+  Json::CharReaderBuilder builder;
+  Json::Value root;
+  std::string errs;
+  std::istringstream iss(str);
+  EXPECT_TRUE(Json::parseFromStream(builder, iss, &root, &errs)) << errs;
+  // Like in compareEPJSONTranslations, an integral value may be read back as an int or as a double
+  epJSONFixture::makeDoubles(root);
+  return root;
+}
+
+TEST_F(epJSONFixture, StreamIDFToEPJSON) {
+  for (const std::string idfname : {"1ZoneEvapCooler.idf", "5ZoneWaterLoopHeatPump.idf", "RefBldgMediumOfficeNew2004_Chicago.idf"}) {
+    auto idf = openstudio::IdfFile::load(epJSONFixture::completeIDFPath(idfname));
+    ASSERT_TRUE(idf) << idfname;
+
+    std::ostringstream oss;
+    ASSERT_TRUE(openstudio::epJSON::toJSON(*idf, oss)) << idfname;
+
+    auto expected = openstudio::epJSON::toJSON(*idf);
+    epJSONFixture::makeDoubles(expected);
+    EXPECT_TRUE(expected == parseStreamedEPJSON(oss.str())) << "Streamed epJSON differs for " << idfname;
+  }
+}
+
+TEST_F(epJSONFixture, StreamWorkspaceToEPJSON) {
+  auto m = openstudio::model::exampleModel();
+  openstudio::energyplus::ForwardTranslator ft;
+  openstudio::Workspace w = ft.translateModel(m);
+
+  std::ostringstream oss;
+  ASSERT_TRUE(openstudio::epJSON::toJSON(w, oss));
+
+  auto expected = openstudio::epJSON::toJSON(w);
+  epJSONFixture::makeDoubles(expected);
+  EXPECT_TRUE(expected == parseStreamedEPJSON(oss.str()));
+}
+
+TEST_F(epJSONFixture, StreamEPJSON_SameSchemaRepeatedly) {
+  // The schema is parsed once per process and shared, repeated translations with it must not be affected by what it already indexed
+  const auto schemaPath = openstudio::epJSON::defaultSchemaPath(openstudio::IddFileType::EnergyPlus);
+
+  auto idf = openstudio::IdfFile::load(epJSONFixture::completeIDFPath("1ZoneEvapCooler.idf"));
+  ASSERT_TRUE(idf);
+  auto other = openstudio::IdfFile::load(epJSONFixture::completeIDFPath("5ZoneWaterLoopHeatPump.idf"));
+  ASSERT_TRUE(other);
+
+  std::ostringstream first;
+  ASSERT_TRUE(openstudio::epJSON::toJSON(*idf, first, schemaPath));
+
+  for (int i = 0; i < 3; ++i) {
+    std::ostringstream oss;
+    ASSERT_TRUE(openstudio::epJSON::toJSON(*idf, oss, schemaPath)) << "Failed at iteration " << i + 1;
+    EXPECT_EQ(first.str(), oss.str()) << "Failed at iteration " << i + 1;
+
+    std::ostringstream otherOss;
+    ASSERT_TRUE(openstudio::epJSON::toJSON(*other, otherOss, schemaPath)) << "Failed at iteration " << i + 1;
+    auto expected = openstudio::epJSON::toJSON(*other, schemaPath);
+    epJSONFixture::makeDoubles(expected);
+    EXPECT_TRUE(expected == parseStreamedEPJSON(otherOss.str())) << "Failed at iteration " << i + 1;
+  }
+
+  // The default schema path resolves to the same schema
+  std::ostringstream withDefault;
+  ASSERT_TRUE(openstudio::epJSON::toJSON(*idf, withDefault));
+  EXPECT_EQ(first.str(), withDefault.str());
+
+  std::ostringstream missing;
+  EXPECT_FALSE(openstudio::epJSON::toJSON(*idf, missing, openstudio::toPath("does_not_exist.schema.epJSON")));
+}
+
 TEST_F(epJSONFixture, CustomCases) {
 
   // Test for #4264, part 1
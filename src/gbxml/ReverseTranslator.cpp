@@ -69,6 +69,8 @@
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/xml/XMLValidator.hpp"
 
+#include "XMLElementStream.hpp"
+
 #include <utilities/idd/IddEnums.hxx>
 #include <resources.hxx>
 
@@ -77,6 +79,7 @@
 #include <pugixml.hpp>
 #include <algorithm>
 #include <locale>
+#include <set>
 
 namespace openstudio {
 namespace gbxml {
@@ -115,12 +118,19 @@ namespace gbxml {
 
       openstudio::filesystem::ifstream file(path, std::ios_base::binary);
       if (file.is_open()) {
-        pugi::xml_document doc;
-        auto load_result = doc.load(file);
-        if (load_result) {
-          result = this->convert(doc.document_element());
+        // The streaming reader only handles ASCII-compatible encodings, UTF-16 files go through the DOM
+        const int firstByte = file.peek();
+        if ((firstByte == 0xFF) || (firstByte == 0xFE)) {
+          pugi::xml_document doc;
+          auto load_result = doc.load(file);
+          if (load_result) {
+            result = this->convert(doc.document_element());
+          }
+          file.close();
+        } else {
+          file.close();
+          result = translateGBXMLStream(path);
         }
-        file.close();
       }
       // JWD: Would be nice to add some error handling here
     }
@@ -128,6 +138,133 @@ namespace gbxml {
     return result;
   }
 
+  boost::optional<model::Model> ReverseTranslator::translateGBXMLStream(const openstudio::path& path) {
+    // Elements that are referenced by id from the geometry, they need to be translated first but they are usually after the Campus in the file
+    static const std::set<std::string> referenceElementNames{"Material", "Layer",        "Construction", "WindowType",
+                                                             "Schedule", "WeekSchedule", "DaySchedule",  "Zone"};
+
+    // First pass: gather the reference tables in a (small) document, and count the surfaces for the progress bar
+    pugi::xml_document referenceDoc;
+    int numSurfaces = 0;
+    {
+      openstudio::filesystem::ifstream file(path, std::ios_base::binary);
+      detail::XMLElementStream stream(file);
+      if (!stream.nextChild()) {
+        LOG(Error, "Could not find the root element in '" << toString(path) << "'");
+        return boost::none;
+      }
+
+      // Keep the root element and its attributes (units...)
+      std::string referenceText = stream.startTag();
+      const std::string rootName = stream.name();
+      const bool isEmptyRoot = stream.isEmptyElement();
+      stream.enterElement();
+
+      bool foundCampus = false;
+      while (stream.nextChild()) {
+        if (referenceElementNames.count(stream.name()) != 0) {
+          referenceText += stream.readElement();
+        } else if (!foundCampus && (stream.name() == "Campus")) {
+          foundCampus = true;
+          stream.enterElement();
+          while (stream.nextChild()) {
+            if (stream.name() == "Surface") {
+              ++numSurfaces;
+            }
+            stream.skipElement();
+          }
+        } else {
+          stream.skipElement();
+        }
+      }
+
+      if (stream.error()) {
+        LOG(Error, "Unexpected end of document in '" << toString(path) << "'");
+        return boost::none;
+      }
+
+      if (!isEmptyRoot) {
+        referenceText += "</" + rootName + ">";
+      }
+
+      if (!referenceDoc.load_buffer(referenceText.data(), referenceText.size())) {
+        LOG(Error, "Could not parse the reference elements of '" << toString(path) << "'");
+        return boost::none;
+      }
+    }
+
+    openstudio::model::Model model;
+    model.setFastNaming(true);
+
+    translateUnits(referenceDoc.document_element());
+
+    translateReferences(referenceDoc.document_element(), model);
+
+    // Everything in there is now in m_idToObjectMap
+    referenceDoc.reset();
+
+    // Second pass: translate the Campus, one Building / Surface at a time
+    openstudio::filesystem::ifstream file(path, std::ios_base::binary);
+    detail::XMLElementStream stream(file);
+    stream.nextChild();
+    stream.enterElement();
+    while (stream.nextChild()) {
+      if (stream.name() != "Campus") {
+        stream.skipElement();
+        continue;
+      }
+
+      auto facility = model.getUniqueModelObject<openstudio::model::Facility>();
+
+      stream.enterElement();
+      bool foundBuilding = false;
+      while (stream.nextChild()) {
+        const bool isBuilding = (stream.name() == "Building");
+        const bool isSurface = (stream.name() == "Surface");
+        if (!isBuilding && !isSurface) {
+          stream.skipElement();
+          continue;
+        }
+
+        // The document is parsed in place, so the text has to outlive it
+        std::string elementText = stream.readElement();
+        pugi::xml_document elementDoc;
+        if (!elementDoc.load_buffer_inplace(elementText.data(), elementText.size())) {
+          LOG(Error, "Could not parse " << stream.name() << " element in '" << toString(path) << "'");
+          continue;
+        }
+
+        if (isBuilding) {
+          OS_ASSERT(!foundBuilding);
+          foundBuilding = true;
+          boost::optional<model::ModelObject> building = translateBuilding(elementDoc.document_element(), model);
+          OS_ASSERT(building);
+
+          if (m_progressBar) {
+            m_progressBar->setWindowTitle(toString("Translating Surfaces"));
+            m_progressBar->setMinimum(0);
+            m_progressBar->setMaximum(numSurfaces);
+            m_progressBar->setValue(0);
+          }
+        } else {
+          if (!foundBuilding) {
+            LOG(Warn, "Surface found before the Building in the Campus, its space may not be found");
+          }
+          translateCampusSurface(elementDoc.document_element(), model);
+        }
+      }
+
+      validateSpaceSurfaces(model);
+
+      // Only one Campus is allowed
+      break;
+    }
+
+    model.setFastNaming(false);
+
+    return model;
+  }
+
   std::vector<LogMessage> ReverseTranslator::warnings() const {
     std::vector<LogMessage> result;
     std::vector<LogMessage> allMessages = m_logSink.logMessages();
@@ -162,6 +299,21 @@ namespace gbxml {
     openstudio::model::Model model;
     model.setFastNaming(true);
 
+    translateUnits(root);
+
+    translateReferences(root, model);
+
+    auto campusElement = root.child("Campus");
+    OS_ASSERT(campusElement.next_sibling("Campus").empty());
+    boost::optional<model::ModelObject> facility = translateCampus(campusElement, model);
+    OS_ASSERT(facility);  // Krishnan, what type of error handling do you want?
+
+    model.setFastNaming(false);
+
+    return model;
+  }
+
+  void ReverseTranslator::translateUnits(const pugi::xml_node& root) {
     // gbXML attributes not mapped directly to IDF, but needed to map
 
     // {F, C, K, R}
@@ -226,7 +378,9 @@ namespace gbxml {
     if (istringEqual(useSIUnitsForResults, "False")) {
       m_useSIUnitsForResults = false;
     }
+  }
 
+  void ReverseTranslator::translateReferences(const pugi::xml_node& root, openstudio::model::Model& model) {
     // do materials before constructions
     auto materialElements = root.children("Material");
     if (m_progressBar) {
@@ -323,15 +477,6 @@ namespace gbxml {
         m_progressBar->setValue(m_progressBar->value() + 1);
       }
     }
-
-    auto campusElement = root.child("Campus");
-    OS_ASSERT(campusElement.next_sibling("Campus").empty());
-    boost::optional<model::ModelObject> facility = translateCampus(campusElement, model);
-    OS_ASSERT(facility);  // Krishnan, what type of error handling do you want?
-
-    model.setFastNaming(false);
-
-    return model;
   }
 
   // A 'quick and dirty' method to find and correct surfaces that have incorrect orientations
@@ -425,21 +570,25 @@ namespace gbxml {
     }
 
     for (auto& surfEl : surfaceElements) {
-      try {
-        boost::optional<model::ModelObject> surface = translateSurface(surfEl, model);
-      } catch (const std::exception&) {
-        LOG(Error, "Could not translate surface " << surfEl);
-      }
-
-      if (m_progressBar) {
-        m_progressBar->setValue(m_progressBar->value() + 1);
-      }
+      translateCampusSurface(surfEl, model);
     }
 
     validateSpaceSurfaces(model);
     return facility;
   }
 
+  void ReverseTranslator::translateCampusSurface(const pugi::xml_node& element, openstudio::model::Model& model) {
+    try {
+      boost::optional<model::ModelObject> surface = translateSurface(element, model);
+    } catch (const std::exception&) {
+      LOG(Error, "Could not translate surface " << element);
+    }
+
+    if (m_progressBar) {
+      m_progressBar->setValue(m_progressBar->value() + 1);
+    }
+  }
+
   boost::optional<model::ModelObject> ReverseTranslator::translateBuilding(const pugi::xml_node& element, openstudio::model::Model& model) {
     openstudio::model::Building building = model.getUniqueModelObject<openstudio::model::Building>();
 
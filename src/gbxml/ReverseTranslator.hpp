@@ -66,6 +66,8 @@ namespace gbxml {
 
     ~ReverseTranslator();
 
+    /** Loads a gbXML file. The file is streamed in two passes: the reference tables (materials, constructions, schedules, zones...) are
+     *  read and translated first, then the Campus geometry is translated one Surface at a time, so the whole document is never held in memory */
     boost::optional<openstudio::model::Model> loadModel(const openstudio::path& path, ProgressBar* progressBar = nullptr);
 
     /** Get warning messages generated by the last translation. */
@@ -87,12 +89,16 @@ namespace gbxml {
     // given id and name from XML (name may be empty) return an OS name
     std::string escapeName(const std::string& id, const std::string& name);
 
-    std::map<std::string, openstudio::model::ModelObject> m_idToObjectMap;
+    std::unordered_map<std::string, openstudio::model::ModelObject> m_idToObjectMap;
 
     // In ReverseTranslator.cpp
     boost::optional<openstudio::model::Model> convert(const pugi::xml_node& root);
     boost::optional<openstudio::model::Model> translateGBXML(const pugi::xml_node& root);
+    boost::optional<openstudio::model::Model> translateGBXMLStream(const openstudio::path& path);
+    void translateUnits(const pugi::xml_node& root);
+    void translateReferences(const pugi::xml_node& root, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateCampus(const pugi::xml_node& element, openstudio::model::Model& model);
+    void translateCampusSurface(const pugi::xml_node& element, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuilding(const pugi::xml_node& element, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuildingStory(const pugi::xml_node& element, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateThermalZone(const pugi::xml_node& element, openstudio::model::Model& model);
@@ -32,6 +32,7 @@
 
 #include "../ReverseTranslator.hpp"
 #include "../ForwardTranslator.hpp"
+#include "../XMLElementStream.hpp"
 
 #include "../../energyplus/ForwardTranslator.hpp"
 
@@ -992,3 +993,52 @@ TEST_F(gbXMLFixture, ReverseTranslator_Absorptance) {
     EXPECT_EQ(0.7, _material2->visibleAbsorptance());  // default
   }
 }
+
+TEST_F(gbXMLFixture, ReverseTranslator_XMLElementStream) {
+  // Small buffer so tokens straddle buffer boundaries
+  std::istringstream is(R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<!-- <Campus> in a comment -->
+<gbXML xmlns="http://www.gbxml.org/schema" lengthUnit="Meters" note="a > b">
+  <Campus id="campus-1">
+    <Location/>
+    <Building id="bldg-1"><Space id="sp-1"/><Space id="sp-2"><Name>Space 2</Name></Space></Building>
+    <Surface id="su-1"><Name><![CDATA[</Surface>]]></Name></Surface>
+    <Surface id="su-2"/>
+  </Campus>
+  <Material id="mat-1"><Name>A &amp; B</Name></Material>
+  <Zone id="zone-1"/>
+</gbXML>)xml");
+
+  openstudio::gbxml::detail::XMLElementStream stream(is, 7);
+  ASSERT_TRUE(stream.nextChild());
+  EXPECT_EQ("gbXML", stream.name());
+  EXPECT_EQ(R"xml(<gbXML xmlns="http://www.gbxml.org/schema" lengthUnit="Meters" note="a > b">)xml", stream.startTag());
+  stream.enterElement();
+
+  ASSERT_TRUE(stream.nextChild());
+  EXPECT_EQ("Campus", stream.name());
+  stream.enterElement();
+  std::vector<std::string> campusChildren;
+  while (stream.nextChild()) {
+    campusChildren.push_back(stream.name());
+    if (stream.name() == "Surface") {
+      EXPECT_TRUE(stream.readElement().find("<Surface id=\"su-") == 0);
+    } else {
+      stream.skipElement();
+    }
+  }
+  EXPECT_EQ(std::vector<std::string>({"Location", "Building", "Surface", "Surface"}), campusChildren);
+
+  ASSERT_TRUE(stream.nextChild());
+  EXPECT_EQ("Material", stream.name());
+  EXPECT_EQ(R"xml(<Material id="mat-1"><Name>A &amp; B</Name></Material>)xml", stream.readElement());
+
+  ASSERT_TRUE(stream.nextChild());
+  EXPECT_EQ("Zone", stream.name());
+  EXPECT_TRUE(stream.isEmptyElement());
+  stream.enterElement();
+  EXPECT_FALSE(stream.nextChild());
+
+  EXPECT_FALSE(stream.nextChild());
+  EXPECT_FALSE(stream.error());
+}
@@ -0,0 +1,266 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2023, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "XMLElementStream.hpp"
+
+#include <cctype>
+
+namespace openstudio {
+namespace gbxml {
+  namespace detail {
+
+    XMLElementStream::XMLElementStream(std::istream& is, size_t bufferSize) : m_is(is), m_buffer(bufferSize) {}
+
+    bool XMLElementStream::get(char& c) {
+      if (!peek(c)) {
+        return false;
+      }
+      ++m_pos;
+      return true;
+    }
+
+    bool XMLElementStream::peek(char& c) {
+      if (m_pos == m_end) {
+        if (!m_is.good()) {
+          return false;
+        }
+        m_is.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_pos = 0;
+        m_end = static_cast<size_t>(m_is.gcount());
+        if (m_end == 0) {
+          return false;
+        }
+      }
+      c = m_buffer[m_pos];
+      return true;
+    }
+
+    void XMLElementStream::append(std::string* capture, char c) {
+      if (capture != nullptr) {
+        capture->push_back(c);
+      }
+    }
+
+    bool XMLElementStream::readUntil(const std::string& terminator, std::string* capture) {
+      // Keep the last terminator.size() characters around, since capture may be null
+      std::string tail;
+      char c = 0;
+      while (get(c)) {
+        append(capture, c);
+        tail.push_back(c);
+        if (tail.size() > terminator.size()) {
+          tail.erase(tail.begin());
+        }
+        if (tail == terminator) {
+          return true;
+        }
+      }
+      m_error = true;
+      return false;
+    }
+
+    XMLElementStream::TokenType XMLElementStream::readToken(std::string* capture) {
+      char c = 0;
+      if (!get(c)) {
+        return TokenType::EndOfStream;
+      }
+      append(capture, c);
+
+      if (c != '<') {
+        // character data, up to the next markup
+        while (peek(c) && c != '<') {
+          ++m_pos;
+          append(capture, c);
+        }
+        return TokenType::Other;
+      }
+
+      if (!get(c)) {
+        m_error = true;
+        return TokenType::EndOfStream;
+      }
+      append(capture, c);
+
+      if (c == '?') {
+        readUntil("?>", capture);
+        return TokenType::Other;
+      }
+
+      if (c == '!') {
+        if (!peek(c)) {
+          m_error = true;
+          return TokenType::EndOfStream;
+        }
+        if (c == '-') {
+          readUntil("-->", capture);
+        } else if (c == '[') {
+          readUntil("]]>", capture);
+        } else {
+          // DOCTYPE and friends: ends at the first '>' outside of the internal subset and quoted literals
+          int bracketDepth = 0;
+          char quote = 0;
+          bool closed = false;
+          while (!closed && get(c)) {
+            append(capture, c);
+            if (quote != 0) {
+              if (c == quote) {
+                quote = 0;
+              }
+            } else if (c == '"' || c == '\'') {
+              quote = c;
+            } else if (c == '[') {
+              ++bracketDepth;
+            } else if (c == ']') {
+              --bracketDepth;
+            } else if (c == '>' && bracketDepth <= 0) {
+              closed = true;
+            }
+          }
+          if (!closed) {
+            m_error = true;
+          }
+        }
+        return TokenType::Other;
+      }
+
+      const bool isEndTag = (c == '/');
+      m_tokenName.clear();
+      if (!isEndTag) {
+        m_tokenName.push_back(c);
+      }
+      bool inName = true;
+      char quote = 0;
+      char previous = c;
+      while (get(c)) {
+        append(capture, c);
+        if (quote != 0) {
+          if (c == quote) {
+            quote = 0;
+          }
+        } else if (c == '"' || c == '\'') {
+          quote = c;
+          inName = false;
+        } else if (c == '>') {
+          if (isEndTag) {
+            return TokenType::EndTag;
+          }
+          return (previous == '/') ? TokenType::EmptyTag : TokenType::StartTag;
+        } else if (inName) {
+          if ((std::isspace(static_cast<unsigned char>(c)) != 0) || c == '/') {
+            inName = false;
+          } else {
+            m_tokenName.push_back(c);
+          }
+        }
+        previous = c;
+      }
+      m_error = true;
+      return TokenType::EndOfStream;
+    }
+
+    bool XMLElementStream::nextChild() {
+      if (m_enteredEmptyElement) {
+        m_enteredEmptyElement = false;
+        return false;
+      }
+      while (true) {
+        m_startTag.clear();
+        TokenType tokenType = readToken(&m_startTag);
+        switch (tokenType) {
+          case TokenType::StartTag:
+          case TokenType::EmptyTag:
+            m_name = m_tokenName;
+            m_isEmptyElement = (tokenType == TokenType::EmptyTag);
+            return true;
+          case TokenType::EndTag:
+          case TokenType::EndOfStream:
+            m_startTag.clear();
+            return false;
+          case TokenType::Other:
+            break;
+        }
+      }
+    }
+
+    const std::string& XMLElementStream::name() const {
+      return m_name;
+    }
+
+    const std::string& XMLElementStream::startTag() const {
+      return m_startTag;
+    }
+
+    bool XMLElementStream::isEmptyElement() const {
+      return m_isEmptyElement;
+    }
+
+    void XMLElementStream::consumeElement(std::string* capture) {
+      if (m_isEmptyElement) {
+        return;
+      }
+      int depth = 1;
+      while (depth > 0) {
+        switch (readToken(capture)) {
+          case TokenType::StartTag:
+            ++depth;
+            break;
+          case TokenType::EndTag:
+            --depth;
+            break;
+          case TokenType::EndOfStream:
+            m_error = true;
+            return;
+          case TokenType::EmptyTag:
+          case TokenType::Other:
+            break;
+        }
+      }
+    }
+
+    std::string XMLElementStream::readElement() {
+      std::string result = m_startTag;
+      consumeElement(&result);
+      return result;
+    }
+
+    void XMLElementStream::skipElement() {
+      consumeElement(nullptr);
+    }
+
+    void XMLElementStream::enterElement() {
+      m_enteredEmptyElement = m_isEmptyElement;
+    }
+
+    bool XMLElementStream::error() const {
+      return m_error;
+    }
+
+  }  // namespace detail
+}  // namespace gbxml
+}  // namespace openstudio
@@ -0,0 +1,111 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2023, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef GBXML_XMLELEMENTSTREAM_HPP
+#define GBXML_XMLELEMENTSTREAM_HPP
+
+#include "gbXMLAPI.hpp"
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace gbxml {
+  namespace detail {
+
+    /** XMLElementStream is a forward-only reader that splits an XML document into the raw text of its elements without building a DOM,
+     *  so each element can be parsed on its own and released before the next one is read. It only understands what is needed to find
+     *  element boundaries: start/end tags (with quoted attribute values), comments, CDATA sections, processing instructions and DOCTYPE.
+     *  The input is expected to be UTF-8 (or any ASCII-compatible encoding). */
+    class GBXML_API XMLElementStream
+    {
+     public:
+      explicit XMLElementStream(std::istream& is, size_t bufferSize = 1 << 16);
+
+      /** Advances to the start tag of the next child of the current element (of the document at first, ie the root element).
+       *  Returns false once the end tag of the current element, or the end of the document, is reached. */
+      bool nextChild();
+
+      /** Name of the element found by the last successful call to nextChild */
+      const std::string& name() const;
+
+      /** Raw start tag of the element found by the last successful call to nextChild, attributes included */
+      const std::string& startTag() const;
+
+      /** Whether the element found by the last successful call to nextChild is self closing */
+      bool isEmptyElement() const;
+
+      /** Consumes the rest of the element found by nextChild and returns its complete raw text, from start tag to end tag */
+      std::string readElement();
+
+      /** Consumes the rest of the element found by nextChild */
+      void skipElement();
+
+      /** Descends into the element found by nextChild, subsequent calls to nextChild iterate over its children */
+      void enterElement();
+
+      /** True if the document ended while an element was still open or a markup construct was not terminated */
+      bool error() const;
+
+     private:
+      enum class TokenType
+      {
+        EndOfStream,
+        StartTag,
+        EndTag,
+        EmptyTag,
+        Other,
+      };
+
+      bool get(char& c);
+      bool peek(char& c);
+      void append(std::string* capture, char c);
+      bool readUntil(const std::string& terminator, std::string* capture);
+      TokenType readToken(std::string* capture);
+      void consumeElement(std::string* capture);
+
+      std::istream& m_is;
+      std::vector<char> m_buffer;
+      size_t m_pos = 0;
+      size_t m_end = 0;
+
+      std::string m_name;
+      std::string m_startTag;
+      std::string m_tokenName;
+      bool m_isEmptyElement = false;
+      bool m_enteredEmptyElement = false;
+      bool m_error = false;
+    };
+
+  }  // namespace detail
+}  // namespace gbxml
+}  // namespace openstudio
+
+#endif  // GBXML_XMLELEMENTSTREAM_HPP
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include "../ForwardTranslator.hpp"
+#include "../ReverseTranslator.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
+#include "../../model/Surface.hpp"
+#include "../../model/Surface_Impl.hpp"
+#include "../../model/SubSurface.hpp"
+#include "../../model/ThermalZone.hpp"
+#include "../../model/ThermalZone_Impl.hpp"
+
+#include "../../utilities/core/Assert.hpp"
+#include "../../utilities/core/Compare.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/FileLogSink.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+
+#include <fmt/format.h>
+
+#include <cmath>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// A synthetic campus: a grid of nSpaces boxes, one zone each, with windows on the walls
+static openstudio::path makeGbXMLWithNSpaces(size_t nSpaces) {
+  openstudio::path outputPath = toPath(fmt::format("./ReverseTranslator_Benchmark_{}.xml", nSpaces));
+  if (openstudio::filesystem::exists(outputPath)) {
+    return outputPath;
+  }
+
+  Model m;
+  constexpr double width = 10.0;
+  constexpr double floorHeight = 3.0;
+  const auto nPerRow = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(nSpaces))));
+  for (size_t i = 0; i < nSpaces; ++i) {
+    const double x = width * (i % nPerRow);
+    const double y = width * (i / nPerRow);
+    Point3dVector pts{{x, y, 0}, {x, y + width, 0}, {x + width, y + width, 0}, {x + width, y, 0}};
+    auto space_ = Space::fromFloorPrint(pts, floorHeight, m);
+    OS_ASSERT(space_);
+    ThermalZone z(m);
+    space_->setThermalZone(z);
+  }
+  for (auto& surface : m.getConcreteModelObjects<Surface>()) {
+    if (istringEqual(surface.surfaceType(), "Wall")) {
+      surface.setWindowToWallRatio(0.4);
+    }
+  }
+
+  gbxml::ForwardTranslator ft;
+  OS_ASSERT(ft.modelToGbXML(m, outputPath));
+  return outputPath;
+}
+
+static void BM_gbXMLReverseTranslator(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ReverseTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  openstudio::path inputPath = makeGbXMLWithNSpaces(state.range(0));
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    gbxml::ReverseTranslator rt;
+    boost::optional<Model> model = rt.loadModel(inputPath);
+    benchmark::DoNotOptimize(model);
+  }
+
+  state.counters["FileSize"] = benchmark::Counter(static_cast<double>(openstudio::filesystem::file_size(inputPath)), benchmark::Counter::kDefaults,
+                                                  benchmark::Counter::OneK::kIs1024);
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_gbXMLReverseTranslator)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
@@ -75,6 +75,7 @@
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
+#include "../utilities/core/Filesystem.hpp"
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Plane.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
@@ -89,9 +90,13 @@
 #include <tiny_gltf.h>
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <type_traits>
+#include <unordered_map>
 
 namespace openstudio {
 namespace gltf {
@@ -121,35 +126,96 @@ namespace gltf {
     return result;
   }
 
-  // Initializes our two main Buffer Views
+  bool GltfForwardTranslator::quantizeVertexAttributes() const {
+    return m_quantizeVertexAttributes;
+  }
+
+  void GltfForwardTranslator::setQuantizeVertexAttributes(bool quantizeVertexAttributes) {
+    m_quantizeVertexAttributes = quantizeVertexAttributes;
+  }
+
+  // Initializes our main Buffer Views
   // one for the indices & other for Coordinates and Normals
-  void initBufferViews(tinygltf::BufferView& indicesBv, tinygltf::BufferView& coordinatesBv) {
+  // When quantized, positions are 8 bytes (3 unsigned shorts + padding) and normals 4 bytes (3 bytes + padding), so they need a BufferView each
+  void initBufferViews(std::vector<tinygltf::BufferView>& bufferViews, bool quantize) {
+    bufferViews.resize(quantize ? 3 : 2);
+
+    tinygltf::BufferView& indicesBv = bufferViews[0];
     indicesBv.buffer = 0;
     // defining bytestride is not required in this case
     indicesBv.target = TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER;
 
     // The vertices take up 36 bytes (3 vertices * 3 floating points * 4 bytes)
     // at position 8 in the buffer and are of type ARRAY_BUFFER
+    tinygltf::BufferView& coordinatesBv = bufferViews[1];
     coordinatesBv.buffer = 0;
     coordinatesBv.target = TINYGLTF_TARGET_ARRAY_BUFFER;
-    coordinatesBv.byteStride = 12;
+    coordinatesBv.byteStride = quantize ? 8 : 12;
+
+    if (quantize) {
+      tinygltf::BufferView& normalsBv = bufferViews[2];
+      normalsBv.buffer = 0;
+      normalsBv.target = TINYGLTF_TARGET_ARRAY_BUFFER;
+      normalsBv.byteStride = 4;
+    }
   }
 
-  // Finds the vertex Index from all Vertices of a planar Surface
-  // param : point3d
-  // param : allPoints
-  // param : tol
-  // returns :  index of the Vertex
-  size_t getOrCreateVertexIndexT(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001) {
-    size_t n = allPoints.size();
-    for (size_t i = 0; i < n; ++i) {
-      if (openstudio::getDistance(point3d, allPoints[i]) < tol) {
-        return i;
+  // Finds the vertex Index from all Vertices of a planar Surface, welding points that are closer than tol.
+  // Points are hashed on a grid of cells of size tol, so a lookup only checks the 27 neighboring cells instead of every known point
+  class VertexWelder
+  {
+   public:
+    explicit VertexWelder(std::vector<Point3d>& allPoints, double tol = 0.001) : m_allPoints(allPoints), m_tol(tol) {}
+
+    // param : point3d
+    // returns :  index of the Vertex
+    size_t getOrCreateVertexIndex(const Point3d& point3d) {
+      const CellKey cell = cellKey(point3d);
+      // Return the first point that matches, like a linear search would
+      size_t result = std::numeric_limits<size_t>::max();
+      for (long long dx = -1; dx <= 1; ++dx) {
+        for (long long dy = -1; dy <= 1; ++dy) {
+          for (long long dz = -1; dz <= 1; ++dz) {
+            auto it = m_grid.find({cell[0] + dx, cell[1] + dy, cell[2] + dz});
+            if (it == m_grid.end()) {
+              continue;
+            }
+            for (const size_t i : it->second) {
+              if ((i < result) && (openstudio::getDistance(point3d, m_allPoints[i]) < m_tol)) {
+                result = i;
+              }
+            }
+          }
+        }
+      }
+      if (result != std::numeric_limits<size_t>::max()) {
+        return result;
       }
+      m_allPoints.push_back(point3d);
+      result = m_allPoints.size() - 1;
+      m_grid[cell].push_back(result);
+      return result;
     }
-    allPoints.push_back(point3d);
-    return (allPoints.size() - 1);
-  }
+
+   private:
+    using CellKey = std::array<long long, 3>;
+
+    struct CellKeyHash
+    {
+      size_t operator()(const CellKey& key) const {
+        return static_cast<size_t>(key[0] * 73856093LL) ^ static_cast<size_t>(key[1] * 19349663LL) ^ static_cast<size_t>(key[2] * 83492791LL);
+      }
+    };
+
+    CellKey cellKey(const Point3d& point3d) const {
+      return {static_cast<long long>(std::floor(point3d.x() / m_tol)), static_cast<long long>(std::floor(point3d.y() / m_tol)),
+              static_cast<long long>(std::floor(point3d.z() / m_tol))};
+    }
+
+    std::vector<Point3d>& m_allPoints;
+    double m_tol;
+    std::unordered_map<CellKey, std::vector<size_t>, CellKeyHash> m_grid;
+  };
 
   template <typename T>
   std::vector<T> getObjectsAndSort(const model::Model& model) {
@@ -182,13 +248,8 @@ namespace gltf {
     tinygltf::Scene& scene = gltfModel.scenes.emplace_back();
     tinygltf::Buffer& buffer = gltfModel.buffers.emplace_back();
 
-    // Note: Can't emplace_back twice and store refs (before a reserve at least),
-    // because the first ref would be invalidated by the second emplace_back, so just resize and get refs after that
-    gltfModel.bufferViews.resize(2);
-    tinygltf::BufferView& indicesBv = gltfModel.bufferViews.front();
-    tinygltf::BufferView& coordinatesBv = gltfModel.bufferViews.back();
-    std::vector<unsigned char> indicesBuffer;
-    std::vector<unsigned char> coordinatesBuffer;
+    // Holds the indices / coordinates / normals, with identical accessors written only once
+    detail::BufferData bufferData(m_quantizeVertexAttributes);
 
     // Start Region INIT
 
@@ -208,7 +269,13 @@ namespace gltf {
       topNode.matrix = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
     }
 
-    initBufferViews(indicesBv, coordinatesBv);
+    // Note: Can't emplace_back several times and store refs (before a reserve at least),
+    // because the first ref would be invalidated by the second emplace_back, so just resize and get refs after that
+    initBufferViews(gltfModel.bufferViews, m_quantizeVertexAttributes);
+    if (m_quantizeVertexAttributes) {
+      gltfModel.extensionsUsed.emplace_back("KHR_mesh_quantization");
+      gltfModel.extensionsRequired.emplace_back("KHR_mesh_quantization");
+    }
 
     // End Region INIT
 
@@ -257,6 +324,9 @@ namespace gltf {
     // We prepare a vector of Materials
     std::vector<GltfMaterialData> allMaterials = GltfMaterialData::buildMaterials(model);
 
+    nodes.reserve(planarSurfaces.size() + 1);
+    meshes.reserve(planarSurfaces.size());
+
     // TODO: make it deterministic by sorting!
     // std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
 
@@ -279,15 +349,6 @@ namespace gltf {
       Transformation& t = transformStack.emplace_back(Transformation::alignFace(vertices));
       Transformation tInv = t.inverse();
       Point3dVector faceVertices = reverse(tInv * vertices);
-      std::vector<double> matrix = openstudio::toStandardVector(buildingTransformation.vector());
-
-      // Adding a check to avoid warning "NODE_MATRIX_DEFAULT"  <Do not specify default transform matrix>.
-      // This is the identity_matrix<4>
-      if (matrixDefaultTransformation != matrix) {
-        node.matrix = matrix;
-      } else {
-        node.matrix = {};
-      }
       node.mesh = meshes.size();
 
       // EXTRAS
@@ -334,22 +395,34 @@ namespace gltf {
       }
 
       Point3dVector allVertices;
-      Point3dVector triangleVertices;
+      VertexWelder vertexWelder(allVertices);
       std::vector<size_t> faceIndices;
       for (const auto& finalFaceVerts : finalFaceVertices) {
         Point3dVector finalVerts = t * finalFaceVerts;
-        triangleVertices.insert(triangleVertices.end(), finalVerts.begin(), finalVerts.end());
         auto it = finalVerts.rbegin();
         auto itend = finalVerts.rend();
         for (; it != itend; ++it) {
-          faceIndices.push_back(getOrCreateVertexIndexT(*it, allVertices));
+          faceIndices.push_back(vertexWelder.getOrCreateVertexIndex(*it));
         }
       }
 
       Vector3d outwardNormal = planarSurface.outwardNormal();
-      Vector3dVector normalVectors(allVertices.size(), outwardNormal);
 
-      detail::ShapeComponentIds shapeComponentIds(faceIndices, allVertices, normalVectors, indicesBuffer, coordinatesBuffer, accessors);
+      detail::ShapeComponentIds shapeComponentIds(faceIndices, allVertices, outwardNormal, bufferData, accessors);
+
+      // The dequantization is carried by the node, on top of the building transformation
+      if (!shapeComponentIds.dequantizationMatrix.empty()) {
+        buildingTransformation = buildingTransformation * Transformation(createVector(shapeComponentIds.dequantizationMatrix));
+      }
+      std::vector<double> matrix = openstudio::toStandardVector(buildingTransformation.vector());
+
+      // Adding a check to avoid warning "NODE_MATRIX_DEFAULT"  <Do not specify default transform matrix>.
+      // This is the identity_matrix<4>
+      if (matrixDefaultTransformation != matrix) {
+        node.matrix = matrix;
+      } else {
+        node.matrix = {};
+      }
 
       tinygltf::Primitive& thisPrimitive = targetMesh.primitives.emplace_back();
       thisPrimitive.attributes["NORMAL"] = shapeComponentIds.normalsAccessorId;
@@ -368,7 +441,7 @@ namespace gltf {
     }
     // Start Region BUILD SCENE | ELEMENT
 
-    if (coordinatesBuffer.empty()) {
+    if (bufferData.coordinatesBuffer.empty()) {
       return boost::none;
     }
 
@@ -376,21 +449,16 @@ namespace gltf {
     // TODO: why use a single buffer for two buffersView instead of one buffer for each?
     // no *.bin file is involved | everything is integrated in the mail output gltf file only.
     // Having a separate input file for the GLTF is old now everything resides in the main GLTF file only... as a binary buffer data.
-    auto padding = indicesBuffer.size() % 4;
-    for (unsigned int i = 0; i < padding; i++) {
-      indicesBuffer.push_back(0x00);  // padding bytes
+    // All sub buffers are already padded to a multiple of 4 bytes
+    std::vector<unsigned char>& allBuffer = buffer.data;
+    allBuffer.reserve(bufferData.indicesBuffer.size() + bufferData.coordinatesBuffer.size() + bufferData.normalsBuffer.size());
+    const std::array<std::vector<unsigned char>*, 3> subBuffers{&bufferData.indicesBuffer, &bufferData.coordinatesBuffer, &bufferData.normalsBuffer};
+    for (size_t i = 0; i < gltfModel.bufferViews.size(); ++i) {
+      tinygltf::BufferView& bv = gltfModel.bufferViews[i];
+      bv.byteOffset = allBuffer.size();
+      bv.byteLength = subBuffers[i]->size();
+      allBuffer.insert(allBuffer.end(), subBuffers[i]->begin(), subBuffers[i]->end());
     }
-
-    std::vector<unsigned char> allBuffer = indicesBuffer;  //std::move(_indicesBuffer);
-    allBuffer.insert(allBuffer.end(), coordinatesBuffer.begin(), coordinatesBuffer.end());
-
-    buffer.data = allBuffer;
-
-    indicesBv.byteLength = indicesBuffer.size();
-    indicesBv.byteOffset = 0;
-
-    coordinatesBv.byteLength = coordinatesBuffer.size();
-    coordinatesBv.byteOffset = indicesBuffer.size();
     // End Region BUILD SCENE | ELEMENT
 
     // Other tie ups
@@ -413,7 +481,7 @@ namespace gltf {
       return "";
     }
 
-    auto gltfModel = gltfModel_.get();
+    auto& gltfModel = gltfModel_.get();
 
     // Save it to a file
     // glTF Parser/Serialier context
@@ -440,14 +508,14 @@ namespace gltf {
 
   bool GltfForwardTranslator::modelToGLTF(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath) {
 
-    boost::optional<tinygltf::Model> gltfModel_ = toGltfModel(model, [](double percentage) {});
+    boost::optional<tinygltf::Model> gltfModel_ = toGltfModel(model, updatePercentage);
     if (!gltfModel_) {
       LOG(Error, "Failed to prepare GLTF model");
-      return "";
+      return false;
     }
 
     // Save it to a file
-    auto gltfModel = gltfModel_.get();
+    auto& gltfModel = gltfModel_.get();
 
     // glTF Parser/Serialier context
     tinygltf::TinyGLTF ctx;
@@ -464,6 +532,38 @@ namespace gltf {
     return ret;
   }
 
+  bool GltfForwardTranslator::modelToGLB(const model::Model& model, const path& outputPath) {
+    return modelToGLB(
+      model, [](double percentage) {}, outputPath);
+  }
+
+  bool GltfForwardTranslator::modelToGLB(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath) {
+
+    boost::optional<tinygltf::Model> gltfModel_ = toGltfModel(model, updatePercentage);
+    if (!gltfModel_) {
+      LOG(Error, "Failed to prepare GLTF model");
+      return false;
+    }
+
+    openstudio::filesystem::ofstream file(outputPath, std::ios_base::binary);
+    if (!file.is_open()) {
+      LOG(Error, "Cannot open file '" << toString(outputPath) << "' for writing");
+      return false;
+    }
+
+    // The JSON chunk is compact and the buffer goes into the BIN chunk as is (no base64), streamed straight to the file
+    tinygltf::TinyGLTF ctx;
+    ctx.SetStoreOriginalJSONForExtrasAndExtensions(true);
+    bool ret = ctx.WriteGltfSceneToStream(&gltfModel_.get(), file,
+                                          false,  // pretty print
+                                          true);  // write binary
+    file.close();
+
+    updatePercentage(100.0);
+
+    return ret;
+  }
+
   // TODO: either rename, or properly populate the model...
   // To populate a GLTF Model from an existing GLTF file.
   // also exports a gltf file with a .bin file (non embeded version).
@@ -504,7 +604,12 @@ namespace gltf {
     std::string err;
     std::string warning;
     std::string fileName = toString(inputPath);
-    bool ret = loader.LoadASCIIFromFile(&gltf_Model, &err, &warning, fileName);
+    bool ret = false;
+    if (istringEqual(toString(inputPath.extension()), ".glb")) {
+      ret = loader.LoadBinaryFromFile(&gltf_Model, &err, &warning, fileName);
+    } else {
+      ret = loader.LoadASCIIFromFile(&gltf_Model, &err, &warning, fileName);
+    }
     if (!err.empty()) {
       LOG(Error, "Error loading GLTF: " << err);
       //ret = false;
@@ -69,11 +69,21 @@ namespace gltf {
     /** Convert an OpenStudio Model to Gltf format but as a JSON string */
     std::string modelToGLTFString(const model::Model& model);
 
+    /** Convert an OpenStudio Model to binary Gltf (.glb) format. The buffer is stored as is instead of base64-encoded,
+     *  and streamed directly to the output file */
+    bool modelToGLB(const model::Model& model, const path& outputPath);
+    bool modelToGLB(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath);
+
+    /** Whether vertex attributes are quantized using the KHR_mesh_quantization extension: positions are stored as 16-bit integers
+     *  relative to each surface's bounding box and normals as normalized 8-bit integers. Defaults to false */
+    bool quantizeVertexAttributes() const;
+    void setQuantizeVertexAttributes(bool quantizeVertexAttributes);
+
     /** @name QA / QC convenience methods */
     //@{
     /** load minimal gltf for QA/QC */
     bool loadGLTF(const path& inputPath, const path& inputNonEmbededpath);
-    /** load minimal gltf for QA/QC */
+    /** load minimal gltf for QA/QC, a path with a .glb extension is loaded as binary Gltf */
     bool loadGLTF(const path& inputPath);
 
     GltfMetaData getMetaData() const;
@@ -94,6 +104,8 @@ namespace gltf {
 
     StringStreamLogSink m_logSink;
 
+    bool m_quantizeVertexAttributes = false;
+
     GltfMetaData m_gltfMetaData;
     std::vector<GltfUserData> m_userDataCollection;
 
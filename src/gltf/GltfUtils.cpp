@@ -37,6 +37,9 @@
 
 #include <tiny_gltf.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <limits>
 #include <type_traits>
 #include <vector>
@@ -46,18 +49,48 @@ namespace openstudio {
 namespace gltf {
 
   namespace detail {
-    // Get Bytes from a value
-    // typeparam name :"T"
-    // param : value
-    // returns : collection of bytes
+
+    // Pads the buffer with zeros so that its size is a multiple of 4, which satisfies the alignment of every component type
+    // as well as the ACCESSOR_TOTAL_OFFSET_ALIGNMENT / vertex attribute alignment validation rules
+    void padBuffer(std::vector<unsigned char>& buffer) {
+      while (buffer.size() % 4 != 0) {
+        buffer.push_back(0x00);
+      }
+    }
+
+    // Appends the (little endian) bytes of a value to the buffer
     template <typename T, typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
-    std::vector<uint8_t> splitValueToBytes(T const& value) {
-      std::vector<uint8_t> bytes;
-      for (size_t i = 0; i < sizeof(value); ++i) {
-        auto byte = static_cast<uint8_t>(value >> (i * 8));
-        bytes.insert(bytes.begin(), byte);
+    void appendValue(std::vector<unsigned char>& buffer, T value) {
+      const auto* ptr = reinterpret_cast<const unsigned char*>(&value);
+      buffer.insert(buffer.end(), ptr, ptr + sizeof(T));
+    }
+
+    // Appends the block to the buffer and registers the accessor that describes it.
+    // If a cache is passed and an accessor with the exact same content already exists, nothing is written and its index is returned instead
+    // returns : index of the accessor
+    int addAccessor(tinygltf::Accessor accessor, const std::vector<unsigned char>& block, std::vector<unsigned char>& buffer,
+                    std::vector<tinygltf::Accessor>& accessors, AccessorCache* accessorCache) {
+      std::string key;
+      if (accessorCache != nullptr) {
+        key = std::to_string(accessor.bufferView) + ":" + std::to_string(accessor.componentType) + ":" + std::to_string(accessor.type) + ":";
+        key.append(reinterpret_cast<const char*>(block.data()), block.size());
+        auto it = accessorCache->find(key);
+        if (it != accessorCache->end()) {
+          return it->second;
+        }
       }
-      return bytes;
+
+      padBuffer(buffer);
+      accessor.byteOffset = buffer.size();
+      buffer.insert(buffer.end(), block.begin(), block.end());
+      padBuffer(buffer);
+
+      const int thisIndex = static_cast<int>(accessors.size());
+      accessors.emplace_back(std::move(accessor));
+      if (accessorCache != nullptr) {
+        accessorCache->emplace(std::move(key), thisIndex);
+      }
+      return thisIndex;
     }
 
     // Adds & Creates Face Indices buffers and Accessors
@@ -67,84 +100,53 @@ namespace gltf {
     // over the index so the containing node will be aware of which one to refer.
     // A better overview here at https://github.com/KhronosGroup/glTF/blob/main/specification/2.0/figures/gltfOverview-2.0.0b.png
     // returns : index of the Face Indices
-    int addIndices(const std::vector<size_t>& faceIndices, std::vector<unsigned char>& indicesBuffer, std::vector<tinygltf::Accessor>& accessors) {
+    int addIndices(const std::vector<size_t>& faceIndices, std::vector<unsigned char>& indicesBuffer, std::vector<tinygltf::Accessor>& accessors,
+                   AccessorCache* accessorCache) {
       auto [min, max] = std::minmax_element(std::cbegin(faceIndices), std::cend(faceIndices));
 
-      // This but seems to be just figuring out the best way to back the indices in
-      // depenbding on the range of numbers
-      int ct = TINYGLTF_COMPONENT_TYPE_BYTE;
-      auto size = 0;
-
-      if (*max <= static_cast<size_t>(std::pow(2, 8))) {
-        ct = TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE;
-        size = sizeof(std::byte);
-      } else if (*max <= static_cast<size_t>(std::pow(2, 16))) {
-        ct = TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT;
-        size = sizeof(short);
-      } else {
-        ct = TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT;
-        size = sizeof(int);
-      }
-      // the offset position needs to be a multiple of the size
-      // (this is from a warning we received in beta testing)
-      // so we inject some padding when needed
-      auto padding = indicesBuffer.size() % size;
-      for (size_t i = 0; i < padding; ++i) {
-        indicesBuffer.push_back(0x00);
-      }
-
-      // To avoid Accessor offset Validation Issue
-      auto _padding = indicesBuffer.size() % 4;
-      for (size_t i = 0; i < _padding; ++i) {
-        indicesBuffer.push_back(0x00);
-      }
-
       tinygltf::Accessor indAccessor;
       indAccessor.bufferView = 0;
-      indAccessor.componentType = ct;
-      indAccessor.byteOffset = indicesBuffer.size();
       indAccessor.normalized = false;
       indAccessor.type = TINYGLTF_TYPE_SCALAR;
       indAccessor.count = faceIndices.size();
       indAccessor.minValues = {static_cast<double>(*min)};
       indAccessor.maxValues = {static_cast<double>(*max)};
 
-      std::vector<unsigned char> indicesBufferData;
-      for (const auto index : faceIndices) {
-        std::vector<unsigned char> arrayOfByte;
-        if (ct == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) {
-          arrayOfByte.push_back((unsigned char)index);
-          // } else if (ct == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
-          //  arrayOfByte = splitValueToBytes(index);
-        } else {
-          arrayOfByte = splitValueToBytes(index);
+      // Pick the smallest component type that fits the range of indices.
+      // The maximum value of each type is reserved for primitive restart, so it can't be used as an index
+      std::vector<unsigned char> block;
+      if (*max < std::numeric_limits<uint8_t>::max()) {
+        indAccessor.componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE;
+        block.reserve(faceIndices.size());
+        for (const auto index : faceIndices) {
+          appendValue(block, static_cast<uint8_t>(index));
+        }
+      } else if (*max < std::numeric_limits<uint16_t>::max()) {
+        indAccessor.componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT;
+        block.reserve(faceIndices.size() * sizeof(uint16_t));
+        for (const auto index : faceIndices) {
+          appendValue(block, static_cast<uint16_t>(index));
+        }
+      } else {
+        indAccessor.componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT;
+        block.reserve(faceIndices.size() * sizeof(uint32_t));
+        for (const auto index : faceIndices) {
+          appendValue(block, static_cast<uint32_t>(index));
         }
-        indicesBufferData.insert(indicesBufferData.end(), arrayOfByte.begin(), arrayOfByte.end());
-      }
-
-      if (indicesBufferData.size() < 4) {
-        indicesBufferData.push_back(0x00);
       }
-      indicesBuffer.insert(indicesBuffer.end(), indicesBufferData.begin(), indicesBufferData.end());
 
-      const auto thisIndex = accessors.size();
-      accessors.push_back(indAccessor);
-      return thisIndex;
+      return addAccessor(std::move(indAccessor), block, indicesBuffer, accessors, accessorCache);
     }
 
     // Creates Coordinates / Normal Buffers and Accessors.
     // returns : index
-    int createBuffers(std::vector<float>& values, std::vector<unsigned char>& coordinatesBuffer, std::vector<tinygltf::Accessor>& accessors) {
-      // Fixes ACCESSOR_TOTAL_OFFSET_ALIGNMENT
-      // Accessor's total byteOffset XXXX isn't a multiple of componentType length 4.
-      auto _padding = coordinatesBuffer.size() % 4;
-      for (size_t i = 0; i < _padding; ++i) {
-        coordinatesBuffer.push_back((unsigned)0);
-      }
-      int startingBufferPosition = coordinatesBuffer.size();
+    int createBuffers(const std::vector<float>& values, std::vector<unsigned char>& coordinatesBuffer, std::vector<tinygltf::Accessor>& accessors,
+                      AccessorCache* accessorCache) {
       std::vector<float> min(3, std::numeric_limits<float>::max());
       std::vector<float> max(3, std::numeric_limits<float>::lowest());
-      int i = 0;
+      std::vector<unsigned char> block;
+      block.reserve(values.size() * sizeof(float));
+      size_t i = 0;
       for (const auto& value : values) {
         min[i] = std::min(value, min[i]);
         max[i] = std::max(value, max[i]);
@@ -152,47 +154,25 @@ namespace gltf {
         if (i > 2) {
           i = 0;
         }
-        std::vector<unsigned char> v;
-        // TODO: ideally we should revisit this...
-        // cppcheck-suppress invalidPointerCast
-        const auto* ptr = reinterpret_cast<const unsigned char*>(&value);
-        for (size_t j = 0; j < sizeof(float); ++j) {
-          v.push_back(ptr[j]);
-        }
-        coordinatesBuffer.insert(coordinatesBuffer.end(), v.begin(), v.end());
-      }
-      // To Fix : offset 18 is not a multiple of Component Type length 4
-      auto padding = coordinatesBuffer.size() % 4;
-      for (size_t j = 0; j < padding; ++j) {
-        coordinatesBuffer.push_back((unsigned)0);
-      }
-      // convert min and max to double
-      std::vector<double> min_d;
-      std::vector<double> max_d;
-      for (const auto mn : min) {
-        min_d.push_back((double)mn);
-      }
-      for (const auto mx : max) {
-        max_d.push_back((double)mx);
+        appendValue(block, value);
       }
+
       tinygltf::Accessor coordAccessor;
       coordAccessor.bufferView = 1;
-      coordAccessor.byteOffset = startingBufferPosition;
       coordAccessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
       coordAccessor.normalized = false;
       coordAccessor.count = values.size() / 3;
       coordAccessor.type = TINYGLTF_TYPE_VEC3;
-      coordAccessor.minValues = min_d;
-      coordAccessor.maxValues = max_d;
+      coordAccessor.minValues.assign(min.begin(), min.end());
+      coordAccessor.maxValues.assign(max.begin(), max.end());
 
-      auto ret = accessors.size();
-      accessors.push_back(coordAccessor);
-      return ret;
+      return addAccessor(std::move(coordAccessor), block, coordinatesBuffer, accessors, accessorCache);
     }
 
     // Adds Coordinate Buffers for all vertices of the surface
     // returns : index for the Coordinates Buffer
-    int addCoordinates(const Point3dVector& allVertices, std::vector<unsigned char>& coordinatesBuffer, std::vector<tinygltf::Accessor>& accessors) {
+    int addCoordinates(const Point3dVector& allVertices, std::vector<unsigned char>& coordinatesBuffer, std::vector<tinygltf::Accessor>& accessors,
+                       AccessorCache* accessorCache) {
       std::vector<float> values(3 * allVertices.size());
       size_t i = 0;
       for (const auto& point : allVertices) {
@@ -200,12 +180,13 @@ namespace gltf {
         values[i++] = static_cast<float>(point.y());
         values[i++] = static_cast<float>(point.z());
       }
-      return createBuffers(values, coordinatesBuffer, accessors);
+      return createBuffers(values, coordinatesBuffer, accessors, accessorCache);
     }
 
     // Adds Normal Buffers for all normal Vectors
     // returns : index for the Normals Buffer
-    int addNormals(const Vector3dVector& normalVectors, std::vector<unsigned char>& coordinatesBuffer, std::vector<tinygltf::Accessor>& accessors) {
+    int addNormals(const Vector3dVector& normalVectors, std::vector<unsigned char>& coordinatesBuffer, std::vector<tinygltf::Accessor>& accessors,
+                   AccessorCache* accessorCache) {
       std::vector<float> values(3 * normalVectors.size());
       size_t i = 0;
       for (const auto& vec : normalVectors) {
@@ -213,16 +194,121 @@ namespace gltf {
         values[i++] = static_cast<float>(vec.y());
         values[i++] = static_cast<float>(vec.z());
       }
-      return createBuffers(values, coordinatesBuffer, accessors);
+      return createBuffers(values, coordinatesBuffer, accessors, accessorCache);
+    }
+
+    // Adds the vertices quantized to unsigned shorts relative to their bounding box: v = offset + q * scale
+    // Each element is padded to 8 bytes, since vertex attributes must be aligned on 4 bytes
+    // returns : index for the Coordinates Buffer
+    int addQuantizedCoordinates(const Point3dVector& allVertices, const std::array<double, 3>& offset, const std::array<double, 3>& scale,
+                                std::vector<unsigned char>& coordinatesBuffer, std::vector<tinygltf::Accessor>& accessors,
+                                AccessorCache* accessorCache) {
+      constexpr double qMax = std::numeric_limits<uint16_t>::max();
+      std::array<uint16_t, 3> min{std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint16_t>::max()};
+      std::array<uint16_t, 3> max{0, 0, 0};
+      std::vector<unsigned char> block;
+      block.reserve(allVertices.size() * 4 * sizeof(uint16_t));
+      for (const auto& point : allVertices) {
+        const std::array<double, 3> coords{point.x(), point.y(), point.z()};
+        for (size_t i = 0; i < 3; ++i) {
+          const auto q = static_cast<uint16_t>(std::clamp(std::round((coords[i] - offset[i]) / scale[i]), 0.0, qMax));
+          min[i] = std::min(q, min[i]);
+          max[i] = std::max(q, max[i]);
+          appendValue(block, q);
+        }
+        appendValue(block, uint16_t{0});
+      }
+
+      tinygltf::Accessor coordAccessor;
+      coordAccessor.bufferView = 1;
+      coordAccessor.componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT;
+      coordAccessor.normalized = false;
+      coordAccessor.count = allVertices.size();
+      coordAccessor.type = TINYGLTF_TYPE_VEC3;
+      coordAccessor.minValues.assign(min.begin(), min.end());
+      coordAccessor.maxValues.assign(max.begin(), max.end());
+
+      return addAccessor(std::move(coordAccessor), block, coordinatesBuffer, accessors, accessorCache);
+    }
+
+    // Adds count copies of the normal as normalized signed bytes, each element padded to 4 bytes
+    // returns : index for the Normals Buffer
+    int addQuantizedNormals(const Vector3d& normal, size_t count, std::vector<unsigned char>& normalsBuffer,
+                            std::vector<tinygltf::Accessor>& accessors, AccessorCache* accessorCache) {
+      const std::array<double, 3> coords{normal.x(), normal.y(), normal.z()};
+      std::array<int8_t, 4> element{0, 0, 0, 0};
+      for (size_t i = 0; i < 3; ++i) {
+        element[i] = static_cast<int8_t>(std::clamp(std::round(coords[i] * 127.0), -127.0, 127.0));
+      }
+      std::vector<unsigned char> block;
+      block.reserve(count * element.size());
+      for (size_t i = 0; i < count; ++i) {
+        for (const auto c : element) {
+          appendValue(block, c);
+        }
+      }
+
+      tinygltf::Accessor normAccessor;
+      normAccessor.bufferView = 2;
+      normAccessor.componentType = TINYGLTF_COMPONENT_TYPE_BYTE;
+      normAccessor.normalized = true;
+      normAccessor.count = count;
+      normAccessor.type = TINYGLTF_TYPE_VEC3;
+
+      return addAccessor(std::move(normAccessor), block, normalsBuffer, accessors, accessorCache);
     }
 
     ShapeComponentIds::ShapeComponentIds(const std::vector<size_t>& faceIndices, const Point3dVector& allVertices,
                                          const Vector3dVector& normalVectors, std::vector<unsigned char>& indicesBuffer,
                                          std::vector<unsigned char>& coordinatesBuffer, std::vector<tinygltf::Accessor>& accessors) {
 
-      indicesAccessorId = addIndices(faceIndices, indicesBuffer, accessors);
-      verticesAccessorId = addCoordinates(allVertices, coordinatesBuffer, accessors);
-      normalsAccessorId = addNormals(normalVectors, coordinatesBuffer, accessors);
+      indicesAccessorId = addIndices(faceIndices, indicesBuffer, accessors, nullptr);
+      verticesAccessorId = addCoordinates(allVertices, coordinatesBuffer, accessors, nullptr);
+      normalsAccessorId = addNormals(normalVectors, coordinatesBuffer, accessors, nullptr);
+    }
+
+    ShapeComponentIds::ShapeComponentIds(const std::vector<size_t>& faceIndices, const Point3dVector& allVertices, const Vector3d& normal,
+                                         BufferData& bufferData, std::vector<tinygltf::Accessor>& accessors) {
+
+      indicesAccessorId = addIndices(faceIndices, bufferData.indicesBuffer, accessors, &bufferData.accessorCache);
+
+      if (!bufferData.quantize) {
+        verticesAccessorId = addCoordinates(allVertices, bufferData.coordinatesBuffer, accessors, &bufferData.accessorCache);
+        normalsAccessorId = addNormals(Vector3dVector(allVertices.size(), normal), bufferData.coordinatesBuffer, accessors, &bufferData.accessorCache);
+        return;
+      }
+
+      std::array<double, 3> offset{std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+      std::array<double, 3> scale{std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(),
+                                  std::numeric_limits<double>::lowest()};
+      for (const auto& point : allVertices) {
+        const std::array<double, 3> coords{point.x(), point.y(), point.z()};
+        for (size_t i = 0; i < 3; ++i) {
+          offset[i] = std::min(coords[i], offset[i]);
+          scale[i] = std::max(coords[i], scale[i]);
+        }
+      }
+      // Extents below this (in meters) are float noise on a flat face, quantizing them would blow up that noise
+      constexpr double flatExtentTolerance = 1e-6;
+      for (size_t i = 0; i < 3; ++i) {
+        const double extent = scale[i] - offset[i];
+        // A flat extent (eg: z for a floor): any scale works, but it must not make the Node matrix singular. With a unit scale all the
+        // coordinates quantize to the offset, which is off by less than the tolerance
+        if (extent < flatExtentTolerance) {
+          scale[i] = 1.0;
+        } else {
+          scale[i] = extent / std::numeric_limits<uint16_t>::max();
+        }
+      }
+
+      verticesAccessorId = addQuantizedCoordinates(allVertices, offset, scale, bufferData.coordinatesBuffer, accessors, &bufferData.accessorCache);
+
+      // Normals are transformed by the inverse transpose of the Node matrix, so prescale them to get the right normal once dequantized
+      Vector3d scaledNormal(normal.x() * scale[0], normal.y() * scale[1], normal.z() * scale[2]);
+      scaledNormal.normalize();
+      normalsAccessorId = addQuantizedNormals(scaledNormal, allVertices.size(), bufferData.normalsBuffer, accessors, &bufferData.accessorCache);
+
+      dequantizationMatrix = {scale[0], 0.0, 0.0, 0.0, 0.0, scale[1], 0.0, 0.0, 0.0, 0.0, scale[2], 0.0, offset[0], offset[1], offset[2], 1.0};
     }
   }  // namespace detail
 
@@ -34,6 +34,7 @@
 #include "../utilities/core/Path.hpp"
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace tinygltf {
@@ -64,6 +65,28 @@ namespace gltf {
   GLTF_API bool createTriangleGLTFFromPoint3DVector(const path& outputPath);
 
   namespace detail {
+
+    // Maps the raw content of an accessor (buffer view, component type, type and bytes) to the index of the accessor that
+    // already holds it, so identical blocks (eg: the index list of every rectangle) are only written once
+    using AccessorCache = std::unordered_map<std::string, int>;
+
+    // The binary payload shared by all primitives of a GLTF Model
+    struct BufferData
+    {
+      explicit BufferData(bool quantize = false) : quantize(quantize) {}
+
+      // Store positions as unsigned 16-bit integers and normals as normalized 8-bit integers (KHR_mesh_quantization)
+      bool quantize;
+
+      std::vector<unsigned char> indicesBuffer;
+      // float positions and normals, or quantized positions only
+      std::vector<unsigned char> coordinatesBuffer;
+      // quantized normals only, they have a different byteStride than quantized positions so they need their own BufferView
+      std::vector<unsigned char> normalsBuffer;
+
+      AccessorCache accessorCache;
+    };
+
     // For Indices of Indices, Coordinates & Normal buffers against each Components
     struct ShapeComponentIds
     {
@@ -71,17 +94,16 @@ namespace gltf {
                                  const std::vector<Vector3d>& normalVectors, std::vector<unsigned char>& indicesBuffer,
                                  std::vector<unsigned char>& coordinatesBuffer, std::vector<tinygltf::Accessor>& accessors);
 
+      // Deduplicates accessors via bufferData.accessorCache, and quantizes the vertex attributes if bufferData.quantize is set
+      explicit ShapeComponentIds(const std::vector<size_t>& faceIndices, const std::vector<Point3d>& allVertices, const Vector3d& normal,
+                                 BufferData& bufferData, std::vector<tinygltf::Accessor>& accessors);
+
       int indicesAccessorId;
       int verticesAccessorId;
       int normalsAccessorId;
 
-     private:
-      // int addIndices(const std::vector<size_t>& faceIndices, std::vector<unsigned char>& indicesBuffer, std::vector<tinygltf::Accessor>& accessors);
-      // int addCoordinates(const std::vector<Point3d>& allVertices, std::vector<unsigned char>& coordinatesBuffer,
-      //                    std::vector<tinygltf::Accessor>& accessors);
-      // int addNormals(const std::vector<Vector3d>& normalVectors, std::vector<unsigned char>& coordinatesBuffer,
-      //                std::vector<tinygltf::Accessor>& accessors);
-      // int createBuffers(std::vector<float>& values, std::vector<unsigned char>& coordinatesBuffer, std::vector<tinygltf::Accessor>& accessors);
+      // When quantized, the column-major matrix that maps the quantized positions back to model coordinates, to be applied by the Node
+      std::vector<double> dequantizationMatrix;
     };
   }  // namespace detail
 
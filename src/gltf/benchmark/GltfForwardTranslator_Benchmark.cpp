@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include "../GltfForwardTranslator.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
+#include "../../model/Surface.hpp"
+#include "../../model/Surface_Impl.hpp"
+#include "../../model/SubSurface.hpp"
+
+#include "../../utilities/core/Assert.hpp"
+#include "../../utilities/core/Compare.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/FileLogSink.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+
+#include <cmath>
+
+using namespace openstudio;
+using namespace openstudio::model;
+using namespace openstudio::gltf;
+
+// A grid of nSpaces boxes with a window on each wall, 6 surfaces + 4 sub surfaces per space
+static Model makeModelWithNSpaces(size_t nSpaces) {
+  Model m;
+  constexpr double width = 10.0;
+  constexpr double floorHeight = 3.0;
+  const auto nPerRow = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(nSpaces))));
+  for (size_t i = 0; i < nSpaces; ++i) {
+    const double x = width * (i % nPerRow);
+    const double y = width * (i / nPerRow);
+    Point3dVector pts{{x, y, 0}, {x, y + width, 0}, {x + width, y + width, 0}, {x + width, y, 0}};
+    auto space_ = Space::fromFloorPrint(pts, floorHeight, m);
+    OS_ASSERT(space_);
+  }
+  for (auto& surface : m.getConcreteModelObjects<Surface>()) {
+    if (istringEqual(surface.surfaceType(), "Wall")) {
+      surface.setWindowToWallRatio(0.4);
+    }
+  }
+  return m;
+}
+
+enum class ExportType
+{
+  GLTF,
+  GLB,
+  GLBQuantized
+};
+
+static void BM_GltfExport(benchmark::State& state, ExportType exportType) {
+
+  FileLogSink logFile(toPath("./GltfForwardTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Model m = makeModelWithNSpaces(state.range(0));
+  const openstudio::path outputPath = toPath(exportType == ExportType::GLTF ? "./GltfForwardTranslator_Benchmark.gltf" : "./GltfForwardTranslator_Benchmark.glb");
+
+  GltfForwardTranslator ft;
+  ft.setQuantizeVertexAttributes(exportType == ExportType::GLBQuantized);
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    bool result = (exportType == ExportType::GLTF) ? ft.modelToGLTF(m, outputPath) : ft.modelToGLB(m, outputPath);
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.counters["FileSize"] = benchmark::Counter(static_cast<double>(openstudio::filesystem::file_size(outputPath)), benchmark::Counter::kDefaults,
+                                                  benchmark::Counter::OneK::kIs1024);
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK_CAPTURE(BM_GltfExport, modelToGLTF, ExportType::GLTF)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+BENCHMARK_CAPTURE(BM_GltfExport, modelToGLB, ExportType::GLB)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+BENCHMARK_CAPTURE(BM_GltfExport, modelToGLB_Quantized, ExportType::GLBQuantized)
+  ->Unit(benchmark::kMillisecond)
+  ->RangeMultiplier(4)
+  ->Range(16, 4096)
+  ->Complexity();
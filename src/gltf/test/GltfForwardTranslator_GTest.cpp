@@ -67,6 +67,7 @@
 
 #include "../../osversion/VersionTranslator.hpp"
 
+#include "../../utilities/core/Filesystem.hpp"
 #include "../../utilities/core/Json.hpp"
 
 #include <resources.hxx>
@@ -930,3 +931,48 @@ TEST_F(GltfFixture, GltfForwardTranslator_TwoStoryOffice_Trane) {
   /*bool result = ft.modelToGLTF(model.get(), output);
   ASSERT_TRUE(result);*/
 }
+
+TEST_F(GltfFixture, GltfForwardTranslator_ExampleModel_GLB) {
+  GltfForwardTranslator ft;
+  Model model = exampleModel();
+
+  openstudio::path gltfPath = resourcesPath() / toPath("utilities/Geometry/exampleModel_GLB.gltf");
+  ASSERT_TRUE(ft.modelToGLTF(model, gltfPath));
+
+  openstudio::path glbPath = resourcesPath() / toPath("utilities/Geometry/exampleModel.glb");
+  ASSERT_TRUE(ft.modelToGLB(model, glbPath));
+  // No base64 and no pretty printing
+  EXPECT_LT(openstudio::filesystem::file_size(glbPath), openstudio::filesystem::file_size(gltfPath));
+
+  EXPECT_FALSE(ft.quantizeVertexAttributes());
+  ft.setQuantizeVertexAttributes(true);
+  EXPECT_TRUE(ft.quantizeVertexAttributes());
+  openstudio::path quantizedPath = resourcesPath() / toPath("utilities/Geometry/exampleModel_quantized.glb");
+  ASSERT_TRUE(ft.modelToGLB(model, quantizedPath));
+  EXPECT_LT(openstudio::filesystem::file_size(quantizedPath), openstudio::filesystem::file_size(glbPath));
+
+  for (const auto& p : {glbPath, quantizedPath}) {
+    GltfForwardTranslator ft2;
+    ASSERT_TRUE(ft2.loadGLTF(p));
+    EXPECT_EQ(30, ft2.getUserDataCollection().size());
+    boost::optional<GltfUserData> glTFUserData = ft2.getUserDataBySurfaceName("Surface 1");
+    ASSERT_TRUE(glTFUserData);
+    EXPECT_EQ("Floor", glTFUserData->surfaceType());
+    EXPECT_EQ(4, ft2.getMetaData().spaceCount());
+  }
+}
+
+TEST_F(GltfFixture, GltfForwardTranslator_QuantizeNearlyFlat) {
+  // A floor with a bit of float noise on its z coordinates is quantized as a flat one
+  const std::vector<Point3d> vertices{{0.0, 0.0, 3.0}, {10.0, 0.0, 3.0 + 1e-12}, {10.0, 5.0, 3.0}, {0.0, 5.0, 3.0 - 1e-12}};
+  const std::vector<size_t> faceIndices{0, 1, 2, 0, 2, 3};
+  detail::BufferData bufferData(true);
+  std::vector<tinygltf::Accessor> accessors;
+  detail::ShapeComponentIds ids(faceIndices, vertices, Vector3d(0.0, 0.0, -1.0), bufferData, accessors);
+
+  ASSERT_EQ(16u, ids.dequantizationMatrix.size());
+  EXPECT_DOUBLE_EQ(10.0 / 65535, ids.dequantizationMatrix[0]);
+  EXPECT_DOUBLE_EQ(5.0 / 65535, ids.dequantizationMatrix[5]);
+  EXPECT_DOUBLE_EQ(1.0, ids.dequantizationMatrix[10]);
+  EXPECT_NEAR(3.0, ids.dequantizationMatrix[14], 1e-9);
+}
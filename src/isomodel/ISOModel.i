@@ -32,6 +32,10 @@
 
 %ignore openstudio::isomodel::mult;
 
+// Batch API is C++ only for now (no vector wrappers for SimModel / UserModel / ISOResults)
+%ignore openstudio::isomodel::SimModel::simulate(const std::vector<SimModel>&);
+%ignore openstudio::isomodel::UserModel::toSimModels;
+
 %rename("terrainClass=") openstudio::isomodel::UserModel::setTerrainClass(double value);
 %rename("floorArea=") openstudio::isomodel::UserModel::setFloorArea(double value);
 %rename("buildingHeight=") openstudio::isomodel::UserModel::setBuildingHeight(double value);
@@ -29,7 +29,11 @@
 
 #include "SimModel.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <exception>
+#include <thread>
 
 #if _DEBUG || (__GNUC__ && !NDEBUG)
 #  define DEBUG_ISO_MODEL_SIMULATION
@@ -344,8 +348,8 @@ namespace isomodel {
                                          const Vector& clockHourOccupied, const Vector& clockHourUnoccupied, Vector& v_hrs_sun_down_mo,
                                          Vector& frac_Pgh_wk_nt, Vector& frac_Pgh_wke_day, Vector& frac_Pgh_wke_nt, Vector& v_Tdbt_nt) const {
 
-    Matrix m_mhEgh = location->weather()->mhEgh();
-    Matrix m_mhdbt = location->weather()->mhdbt();
+    const Matrix& m_mhEgh = location->weather()->mhEgh();
+    const Matrix& m_mhdbt = location->weather()->mhdbt();
 
     // TODO: unreadVariable
     // Vector v_Tdbt_Day = prod(m_mhdbt, clockHourOccupied);
@@ -2233,6 +2237,42 @@ end
                             v_Qcl_gas_tot, v_Q_dhw_gas, frac_hrs_wk_day);
   }
 
+  std::vector<ISOResults> SimModel::simulate(const std::vector<SimModel>& simModels) {
+    const size_t n = simModels.size();
+    std::vector<ISOResults> results(n);
+
+    // Each SimModel is independent, so hand them out to the workers one at a time
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::atomic<bool> failed{false};
+    auto worker = [&]() {
+      for (size_t i = next++; (i < n) && !failed; i = next++) {
+        try {
+          results[i] = simModels[i].simulate();
+        } catch (...) {
+          if (!failed.exchange(true)) {
+            error = std::current_exception();
+          }
+        }
+      }
+    };
+
+    const size_t nThreads = std::min<size_t>(n, std::max(1U, std::thread::hardware_concurrency()));
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < nThreads; ++t) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    return results;
+  }
+
   ISOResults SimModel::outputGeneration(const Vector& v_Qelec_ht, const Vector& v_Qcl_elec_tot, const Vector& v_Q_illum_tot,
                                         const Vector& v_Q_illum_ext_tot, const Vector& v_Qfan_tot, const Vector& v_Q_pump_tot,
                                         const Vector& v_Q_dhw_elec, const Vector& v_Qgas_ht, const Vector& v_Qcl_gas_tot, const Vector& v_Q_dhw_gas,
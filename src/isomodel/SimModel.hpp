@@ -45,6 +45,8 @@
 #include "Structure.hpp"
 #include "Ventilation.hpp"
 
+#include <vector>
+
 namespace openstudio {
 
 class EndUses;
@@ -113,6 +115,13 @@ namespace isomodel {
      *  returns ISOResults which is a vector of EndUses, one EndUses per month of the year
      */
     ISOResults simulate() const;
+
+    /*
+     *  Runs the ISO Model calculations for many SimModels at once, spreading them over the available cores.
+     *  SimModels are only read, so they may share their WeatherData (see UserModel::toSimModels).
+     *  returns one ISOResults per SimModel, identical to what simulate() returns for it
+     */
+    static std::vector<ISOResults> simulate(const std::vector<SimModel>& simModels);
     REGISTER_LOGGER("openstudio.isomodel.SimModel");
 
    private:
@@ -326,3 +326,37 @@ TEST_F(ISOModelFixture, SimModel) {
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[10].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[11].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
 }
+
+TEST_F(ISOModelFixture, SimModel_BatchSimulate) {
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+
+  std::vector<UserModel> userModels;
+  for (int i = 0; i < 10; ++i) {
+    userModels.push_back(userModel);
+    userModels.back().setFloorArea(userModel.floorArea() * (1.0 + 0.1 * i));
+    userModels.back().setCoolingSystemCOP(userModel.coolingSystemCOP() + 0.2 * i);
+  }
+
+  std::vector<SimModel> simModels = UserModel::toSimModels(userModels);
+  ASSERT_EQ(userModels.size(), simModels.size());
+
+  std::vector<ISOResults> batchResults = SimModel::simulate(simModels);
+  ASSERT_EQ(simModels.size(), batchResults.size());
+
+  std::vector<EndUseFuelType> fuelTypes = EndUses::fuelTypes();
+  std::vector<EndUseCategoryType> categories = EndUses::categories();
+  for (size_t i = 0; i < userModels.size(); ++i) {
+    ISOResults results = userModels[i].toSimModel().simulate();
+    ASSERT_EQ(results.monthlyResults.size(), batchResults[i].monthlyResults.size());
+    for (size_t m = 0; m < results.monthlyResults.size(); ++m) {
+      for (const auto& fuelType : fuelTypes) {
+        for (const auto& category : categories) {
+          EXPECT_EQ(results.monthlyResults[m].getEndUse(fuelType, category), batchResults[i].monthlyResults[m].getEndUse(fuelType, category));
+        }
+      }
+    }
+  }
+  EXPECT_NE(batchResults.front().totalEnergyUse(), batchResults.back().totalEnergyUse());
+}
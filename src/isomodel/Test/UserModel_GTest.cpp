@@ -32,6 +32,10 @@
 
 #include "../UserModel.hpp"
 #include "../SimModel.hpp"
+#include "../WeatherData.hpp"
+
+#include "../../utilities/core/Checksum.hpp"
+#include "../../utilities/core/Filesystem.hpp"
 
 #include <resources.hxx>
 
@@ -1087,3 +1091,55 @@ TEST_F(ISOModelFixture, UserModel) {
     EXPECT_DOUBLE_EQ(mwindExp[v], mwind[r]);
   }
 }
+
+TEST_F(ISOModelFixture, WeatherData_fromEpw) {
+  openstudio::path epwPath = resourcesPath() / openstudio::toPath("isomodel/weather.epw");
+
+  WeatherData::clearCache();
+  std::shared_ptr<const WeatherData> weather = WeatherData::fromEpw(epwPath);
+  ASSERT_TRUE(weather);
+  EXPECT_EQ(weather, WeatherData::fromEpw(epwPath));
+
+  // Round trip to disk is exact
+  openstudio::path cacheDir = openstudio::filesystem::temp_directory_path() / openstudio::toPath("ISOModel_WeatherDataCache");
+  openstudio::filesystem::remove_all(cacheDir);
+  openstudio::filesystem::create_directories(cacheDir);
+  openstudio::path savedPath = cacheDir / openstudio::toPath("weather.isoweather");
+  ASSERT_TRUE(weather->save(savedPath));
+  std::shared_ptr<WeatherData> loaded = WeatherData::load(savedPath);
+  ASSERT_TRUE(loaded);
+  ASSERT_EQ(weather->msolar().size1(), loaded->msolar().size1());
+  ASSERT_EQ(weather->msolar().size2(), loaded->msolar().size2());
+  for (size_t i = 0; i < weather->mhdbt().size1(); ++i) {
+    for (size_t j = 0; j < weather->mhdbt().size2(); ++j) {
+      EXPECT_EQ(weather->mhdbt()(i, j), loaded->mhdbt()(i, j));
+      EXPECT_EQ(weather->mhEgh()(i, j), loaded->mhEgh()(i, j));
+    }
+    for (size_t j = 0; j < weather->msolar().size2(); ++j) {
+      EXPECT_EQ(weather->msolar()(i, j), loaded->msolar()(i, j));
+    }
+    EXPECT_EQ(weather->mEgh()[i], loaded->mEgh()[i]);
+    EXPECT_EQ(weather->mdbt()[i], loaded->mdbt()[i]);
+    EXPECT_EQ(weather->mwind()[i], loaded->mwind()[i]);
+  }
+  EXPECT_FALSE(WeatherData::load(epwPath));
+
+  // With a cache directory, the tables are written there keyed by the EPW checksum
+  WeatherData::clearCache();
+  WeatherData::setCacheDirectory(cacheDir);
+  std::shared_ptr<const WeatherData> cached = WeatherData::fromEpw(epwPath);
+  ASSERT_TRUE(cached);
+  EXPECT_NE(weather, cached);
+  EXPECT_TRUE(openstudio::filesystem::exists(cacheDir / openstudio::toPath(openstudio::checksum(epwPath) + ".isoweather")));
+  EXPECT_EQ(weather->mdbt()[6], cached->mdbt()[6]);
+
+  // And read back from there by the next process
+  WeatherData::clearCache();
+  std::shared_ptr<const WeatherData> reloaded = WeatherData::fromEpw(epwPath);
+  ASSERT_TRUE(reloaded);
+  EXPECT_EQ(weather->msolar()(6, 3), reloaded->msolar()(6, 3));
+
+  WeatherData::setCacheDirectory(openstudio::path());
+  WeatherData::clearCache();
+  openstudio::filesystem::remove_all(cacheDir);
+}
@@ -29,6 +29,8 @@
 
 #include "UserModel.hpp"
 
+#include <map>
+
 using namespace std;
 namespace openstudio {
 namespace isomodel {
@@ -600,6 +602,27 @@ namespace isomodel {
     }
   }
 
+  std::vector<SimModel> UserModel::toSimModels(std::vector<UserModel>& userModels) {
+    // loadWeather resolves a relative weather path against the directory of the ISO file, so key on both
+    std::map<std::pair<openstudio::path, openstudio::path>, std::shared_ptr<WeatherData>> weatherCache;
+
+    std::vector<SimModel> result;
+    result.reserve(userModels.size());
+    for (auto& userModel : userModels) {
+      if (!userModel._weather) {
+        auto key = std::make_pair(userModel._weatherFilePath, userModel._dataFile.parent_path());
+        auto it = weatherCache.find(key);
+        if (it == weatherCache.end()) {
+          userModel._valid = true;
+          it = weatherCache.emplace(key, userModel.loadWeather()).first;
+        }
+        userModel._weather = it->second;
+      }
+      result.push_back(userModel.toSimModel());
+    }
+    return result;
+  }
+
   std::shared_ptr<WeatherData> UserModel::loadWeather() {
     openstudio::path weatherFilename;
     //see if weather file path is absolute path
@@ -614,26 +637,8 @@ namespace isomodel {
         return {};
       }
     }
-    EpwData edata(weatherFilename);
-
-    Matrix _msolar(12, 8, 0);
-    Matrix _mhdbt(12, 24, 0);
-    Matrix _mhEgh(12, 24, 0);
-    Vector _mEgh(12);
-    Vector _mdbt(12);
-    Vector _mwind(12);
-
-    edata.toISOData(_msolar, _mhdbt, _mhEgh, _mEgh, _mdbt, _mwind);
-
-    std::shared_ptr<WeatherData> wdata(new WeatherData);
-    wdata->setMdbt(_mdbt);
-    wdata->setMEgh(_mEgh);
-    wdata->setMhdbt(_mhdbt);
-    wdata->setMhEgh(_mhEgh);
-    wdata->setMsolar(_msolar);
-    wdata->setMwind(_mwind);
-
-    return wdata;
+    // The derived tables are cached per EPW content, copy them so that this UserModel may modify its own
+    return std::make_shared<WeatherData>(*WeatherData::fromEpw(weatherFilename));
   }
 
   void UserModel::load(const openstudio::path& t_buildingFile) {
@@ -71,6 +71,13 @@ namespace isomodel {
      */
     SimModel toSimModel();
 
+    /**
+     * Generates the SimModels for a batch of UserModels, eg: for SimModel::simulate(simModels).
+     * Each weather file is loaded only once, and the resulting WeatherData is shared
+     * by all the UserModels (and SimModels) that point to it
+     */
+    static std::vector<SimModel> toSimModels(std::vector<UserModel>& userModels);
+
     /**
      * Indicates whether or not the user model loaded in correctly
      * If either the ISO file or the Weather File cannot be found
@@ -28,11 +28,238 @@
 ***********************************************************************************************************************/
 
 #include "WeatherData.hpp"
+#include "EpwData.hpp"
+
+#include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/core/UUID.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
 
 namespace openstudio {
 namespace isomodel {
 
-  // nothing to see here
+  namespace {
+
+    constexpr const char* fileHeader = "OpenStudio ISO WeatherData v1";
+
+    struct WeatherDataCache
+    {
+      std::mutex mutex;
+      openstudio::path directory;
+      std::map<std::string, std::shared_ptr<const WeatherData>> tables;
+    };
+
+    WeatherDataCache& weatherDataCache() {
+      static WeatherDataCache cache;
+      return cache;
+    }
+
+    void writeMatrix(std::ostream& os, const char* name, const Matrix& m) {
+      os << name << ',' << m.size1() << ',' << m.size2() << '\n';
+      for (size_t i = 0; i < m.size1(); ++i) {
+        for (size_t j = 0; j < m.size2(); ++j) {
+          os << (j == 0 ? "" : ",") << m(i, j);
+        }
+        os << '\n';
+      }
+    }
+
+    void writeVector(std::ostream& os, const char* name, const Vector& v) {
+      os << name << ',' << v.size() << '\n';
+      for (size_t i = 0; i < v.size(); ++i) {
+        os << (i == 0 ? "" : ",") << v[i];
+      }
+      os << '\n';
+    }
+
+    // Reads the "name,rows,cols" header then the comma separated values
+    bool readMatrix(std::istream& is, const char* name, Matrix& m) {
+      std::string line;
+      if (!std::getline(is, line)) {
+        return false;
+      }
+      std::stringstream header(line);
+      std::string t_name;
+      size_t rows = 0;
+      size_t cols = 0;
+      char sep = 0;
+      if (!std::getline(header, t_name, ',') || (t_name != name) || !(header >> rows >> sep >> cols)) {
+        return false;
+      }
+      m = Matrix(rows, cols, 0);
+      for (size_t i = 0; i < rows; ++i) {
+        if (!std::getline(is, line)) {
+          return false;
+        }
+        std::stringstream row(line);
+        for (size_t j = 0; j < cols; ++j) {
+          if (!(row >> m(i, j))) {
+            return false;
+          }
+          row >> sep;
+        }
+      }
+      return true;
+    }
+
+    bool readVector(std::istream& is, const char* name, Vector& v) {
+      std::string line;
+      if (!std::getline(is, line)) {
+        return false;
+      }
+      std::stringstream header(line);
+      std::string t_name;
+      size_t size = 0;
+      if (!std::getline(header, t_name, ',') || (t_name != name) || !(header >> size)) {
+        return false;
+      }
+      v = Vector(size);
+      if (!std::getline(is, line)) {
+        return false;
+      }
+      std::stringstream row(line);
+      char sep = 0;
+      for (size_t i = 0; i < size; ++i) {
+        if (!(row >> v[i])) {
+          return false;
+        }
+        row >> sep;
+      }
+      return true;
+    }
+
+    std::shared_ptr<WeatherData> computeFromEpw(const openstudio::path& epwPath) {
+      EpwData edata(epwPath);
+
+      Matrix _msolar(12, 8, 0);
+      Matrix _mhdbt(12, 24, 0);
+      Matrix _mhEgh(12, 24, 0);
+      Vector _mEgh(12);
+      Vector _mdbt(12);
+      Vector _mwind(12);
+
+      edata.toISOData(_msolar, _mhdbt, _mhEgh, _mEgh, _mdbt, _mwind);
+
+      auto wdata = std::make_shared<WeatherData>();
+      wdata->setMdbt(_mdbt);
+      wdata->setMEgh(_mEgh);
+      wdata->setMhdbt(_mhdbt);
+      wdata->setMhEgh(_mhEgh);
+      wdata->setMsolar(_msolar);
+      wdata->setMwind(_mwind);
+      return wdata;
+    }
+
+  }  // namespace
+
+  std::shared_ptr<const WeatherData> WeatherData::fromEpw(const openstudio::path& epwPath) {
+    const std::string key = openstudio::checksum(epwPath);
+
+    auto& cache = weatherDataCache();
+    openstudio::path directory;
+    {
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      auto it = cache.tables.find(key);
+      if (it != cache.tables.end()) {
+        return it->second;
+      }
+      directory = cache.directory;
+    }
+
+    // Computed outside of the lock, worst case two threads compute the same tables and one of them is dropped
+    std::shared_ptr<WeatherData> wdata;
+    openstudio::path cachedPath;
+    if (!directory.empty()) {
+      cachedPath = directory / openstudio::toPath(key + ".isoweather");
+      if (openstudio::filesystem::exists(cachedPath)) {
+        wdata = load(cachedPath);
+        if (!wdata) {
+          LOG(Warn, "Ignoring unreadable ISO weather cache file '" << openstudio::toString(cachedPath) << "'");
+        }
+      }
+    }
+
+    if (!wdata) {
+      wdata = computeFromEpw(epwPath);
+      if (!cachedPath.empty()) {
+        // Write to a unique file then rename, so that concurrent workers never read a partial file
+        openstudio::path tmpPath = directory / openstudio::toPath(key + "." + openstudio::removeBraces(openstudio::createUUID()) + ".tmp");
+        try {
+          openstudio::filesystem::create_directories(directory);
+          if (wdata->save(tmpPath)) {
+            boost::filesystem::rename(tmpPath, cachedPath);
+          }
+        } catch (const std::exception& e) {
+          LOG(Warn, "Could not write ISO weather cache file '" << openstudio::toString(cachedPath) << "': " << e.what());
+        }
+        if (openstudio::filesystem::exists(tmpPath)) {
+          openstudio::filesystem::remove(tmpPath);
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    return cache.tables.emplace(key, std::move(wdata)).first->second;
+  }
+
+  void WeatherData::setCacheDirectory(const openstudio::path& cacheDirectory) {
+    auto& cache = weatherDataCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.directory = cacheDirectory;
+  }
+
+  openstudio::path WeatherData::cacheDirectory() {
+    auto& cache = weatherDataCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    return cache.directory;
+  }
+
+  void WeatherData::clearCache() {
+    auto& cache = weatherDataCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.tables.clear();
+  }
+
+  bool WeatherData::save(const openstudio::path& path) const {
+    std::ofstream ofile(openstudio::toSystemFilename(path));
+    if (!ofile.is_open()) {
+      return false;
+    }
+    // Enough digits for the values to round trip exactly
+    ofile << std::setprecision(std::numeric_limits<double>::max_digits10);
+    ofile << fileHeader << '\n';
+    writeMatrix(ofile, "msolar", _msolar);
+    writeMatrix(ofile, "mhdbt", _mhdbt);
+    writeMatrix(ofile, "mhEgh", _mhEgh);
+    writeVector(ofile, "mEgh", _mEgh);
+    writeVector(ofile, "mdbt", _mdbt);
+    writeVector(ofile, "mwind", _mwind);
+    return ofile.good();
+  }
+
+  std::shared_ptr<WeatherData> WeatherData::load(const openstudio::path& path) {
+    std::ifstream ifile(openstudio::toSystemFilename(path));
+    if (!ifile.is_open()) {
+      return {};
+    }
+    std::string line;
+    if (!std::getline(ifile, line) || (line != fileHeader)) {
+      return {};
+    }
+    auto wdata = std::make_shared<WeatherData>();
+    if (!readMatrix(ifile, "msolar", wdata->_msolar) || !readMatrix(ifile, "mhdbt", wdata->_mhdbt) || !readMatrix(ifile, "mhEgh", wdata->_mhEgh)
+        || !readVector(ifile, "mEgh", wdata->_mEgh) || !readVector(ifile, "mdbt", wdata->_mdbt) || !readVector(ifile, "mwind", wdata->_mwind)) {
+      return {};
+    }
+    return wdata;
+  }
 
-}
+}  // namespace isomodel
 }  // namespace openstudio
@@ -31,15 +31,48 @@
 #define ISOMODEL_WEATHERDATA_HPP
 
 #include "ISOModelAPI.hpp"
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Path.hpp"
 #include "../utilities/data/Vector.hpp"
 #include "../utilities/data/Matrix.hpp"
 
+#include <memory>
+
 namespace openstudio {
 namespace isomodel {
 
   class ISOMODEL_API WeatherData
   {
    public:
+    /**
+   * Returns the monthly/hourly tables derived from an EPW file.
+   * Tables are computed once per process for a given EPW content (keyed by its checksum) and shared.
+   * If a cache directory is set, they are also read from / written to it so that several processes can share them
+   */
+    static std::shared_ptr<const WeatherData> fromEpw(const openstudio::path& epwPath);
+
+    /**
+   * Directory where fromEpw stores the tables it computes, as <checksum>.isoweather files.
+   * Empty (the default) to keep them in memory only
+   */
+    static void setCacheDirectory(const openstudio::path& cacheDirectory);
+    static openstudio::path cacheDirectory();
+
+    /**
+   * Drops the tables held in memory by fromEpw
+   */
+    static void clearCache();
+
+    /**
+   * Saves the tables to a text file, with full double precision
+   */
+    bool save(const openstudio::path& path) const;
+
+    /**
+   * Loads tables saved by save(), returns an empty pointer if the file cannot be read
+   */
+    static std::shared_ptr<WeatherData> load(const openstudio::path& path);
+
     /**
    * mean monthly Global Horizontal Radiation (W/m2)
    */
@@ -98,6 +131,8 @@ namespace isomodel {
     }
 
    private:
+    REGISTER_LOGGER("openstudio.isomodel.WeatherData");
+
     Matrix _msolar;
     Matrix _mhdbt;
     Matrix _mhEgh;
@@ -658,14 +658,32 @@ namespace model {
       return result;
     }
 
-    double Building_Impl::floorArea() const {
-      double result = 0;
+    void Building_Impl::updateCachedSpaceAreas() const {
+      boost::optional<std::size_t> changeCount = modelChangeCount();
+      if (changeCount && (m_cachedSpaceAreasChangeCount == changeCount)) {
+        return;
+      }
+
+      double floorArea(0.0);
+      double exteriorSurfaceArea(0.0);
+      double exteriorWallArea(0.0);
       for (const Space& space : spaces()) {
+        const int multiplier = space.multiplier();
         if (space.partofTotalFloorArea()) {
-          result += space.multiplier() * space.floorArea();
+          floorArea += multiplier * space.floorArea();
         }
+        exteriorSurfaceArea += multiplier * space.exteriorArea();
+        exteriorWallArea += multiplier * space.exteriorWallArea();
       }
-      return result;
+      m_cachedFloorArea = floorArea;
+      m_cachedExteriorSurfaceArea = exteriorSurfaceArea;
+      m_cachedExteriorWallArea = exteriorWallArea;
+      m_cachedSpaceAreasChangeCount = changeCount;
+    }
+
+    double Building_Impl::floorArea() const {
+      updateCachedSpaceAreas();
+      return m_cachedFloorArea;
     }
 
     boost::optional<double> Building_Impl::conditionedFloorArea() const {
@@ -695,25 +713,13 @@ namespace model {
     }
 
     double Building_Impl::exteriorSurfaceArea() const {
-      double result(0.0);
-      for (const Surface& surface : model().getConcreteModelObjects<Surface>()) {
-        OptionalSpace space = surface.space();
-        std::string outsideBoundaryCondition = surface.outsideBoundaryCondition();
-        if (space && openstudio::istringEqual(outsideBoundaryCondition, "Outdoors")) {
-          result += surface.grossArea() * space->multiplier();
-        }
-      }
-      return result;
+      updateCachedSpaceAreas();
+      return m_cachedExteriorSurfaceArea;
     }
 
     double Building_Impl::exteriorWallArea() const {
-      double result(0.0);
-      for (const Surface& exteriorWall : exteriorWalls()) {
-        if (OptionalSpace space = exteriorWall.space()) {
-          result += exteriorWall.grossArea() * space->multiplier();
-        }
-      }
-      return result;
+      updateCachedSpaceAreas();
+      return m_cachedExteriorWallArea;
     }
 
     double Building_Impl::airVolume() const {
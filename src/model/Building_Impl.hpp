@@ -239,6 +239,14 @@ namespace model {
      private:
       REGISTER_LOGGER("openstudio.model.Building");
 
+      // Sums the multiplied areas of the spaces, unless the model has not changed since the last time
+      void updateCachedSpaceAreas() const;
+
+      mutable boost::optional<std::size_t> m_cachedSpaceAreasChangeCount;
+      mutable double m_cachedFloorArea = 0.0;
+      mutable double m_cachedExteriorSurfaceArea = 0.0;
+      mutable double m_cachedExteriorWallArea = 0.0;
+
       boost::optional<ModelObject> spaceTypeAsModelObject() const;
       boost::optional<ModelObject> defaultConstructionSetAsModelObject() const;
       boost::optional<ModelObject> defaultScheduleSetAsModelObject() const;
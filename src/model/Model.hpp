@@ -37,6 +37,7 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 #include "../utilities/core/Assert.hpp"
 
+#include <memory>
 #include <vector>
 
 namespace openstudio {
@@ -488,6 +489,23 @@ namespace model {
     template <typename T>
     std::vector<T> getModelObjects(bool sorted = false) const {
       std::vector<T> result;
+      if (!sorted) {
+        // Union of the per-type buckets that derive from T, with no cast attempted on the objects themselves
+        for (const IddObjectType& type : this->iddObjectTypes()) {
+          const auto& impls = this->getObjectImplsByType(type);
+          if (impls.empty()
+              || !detail::ModelObjectTypeIndex<T>::contains(
+                type, [&impls]() { return std::dynamic_pointer_cast<typename T::ImplType>(impls.front()) != nullptr; })) {
+            continue;
+          }
+          result.reserve(result.size() + impls.size());
+          for (const auto& impl : impls) {
+            result.push_back(T(std::static_pointer_cast<typename T::ImplType>(impl)));
+          }
+        }
+        return result;
+      }
+
       std::vector<WorkspaceObject> objects = this->objects(sorted);
       result.reserve(objects.size());
       for (const auto& wo : objects) {
@@ -505,10 +523,11 @@ namespace model {
     template <typename T>
     std::vector<T> getConcreteModelObjects() const {
       std::vector<T> result;
-      std::vector<WorkspaceObject> objects = this->getObjectsByType(T::iddObjectType());
-      result.reserve(objects.size());
-      for (const auto& wo : objects) {
-        std::shared_ptr<typename T::ImplType> p = wo.getImpl<typename T::ImplType>();
+      // Read straight from the type's bucket, without building an intermediate vector of WorkspaceObjects
+      const auto& impls = this->getObjectImplsByType(T::iddObjectType());
+      result.reserve(impls.size());
+      for (const auto& impl : impls) {
+        std::shared_ptr<typename T::ImplType> p = std::dynamic_pointer_cast<typename T::ImplType>(impl);
         if (p) {
           // emplace_back(std::move(p)) did not work, calling a protected constructor...
           // the std::allocator for vector can forward to free functions...
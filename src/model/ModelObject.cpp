@@ -91,6 +91,13 @@ namespace model {
       return workspace().cast<Model>();
     }
 
+    boost::optional<std::size_t> ModelObject_Impl::modelChangeCount() const {
+      if (const auto* workspaceImpl = this->workspaceImpl()) {
+        return workspaceImpl->changeCount();
+      }
+      return boost::none;
+    }
+
     std::vector<LifeCycleCost> ModelObject_Impl::lifeCycleCosts() const {
       return getObject<ModelObject>().getModelObjectSources<LifeCycleCost>();
     }
@@ -41,8 +41,11 @@
 #include <boost/optional.hpp>
 #include <boost/lexical_cast.hpp>
 
-#include <vector>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 namespace openstudio {
 
@@ -72,6 +75,37 @@ namespace model {
   namespace detail {
     class Model_Impl;
     class ModelObject_Impl;
+
+    /** Index from a (possibly abstract) ModelObject class T to the IddObjectTypes whose objects are T's.
+     *  Every object of a given IddObjectType is created by the same constructor in Model_Impl::ModelObjectCreator, so
+     *  one cast on the first object seen answers for the whole type, and the answer is kept for the life of the program. */
+    template <typename T>
+    class ModelObjectTypeIndex
+    {
+     public:
+      /** Returns true if objects of type are T's. isOfType() casts any one object of type, and is only called the
+       *  first time type is seen. */
+      template <typename IsOfType>
+      static bool contains(IddObjectType type, IsOfType isOfType) {
+        std::lock_guard<std::mutex> lock(mutex());
+        auto [it, inserted] = index().try_emplace(type.value(), false);
+        if (inserted) {
+          it->second = isOfType();
+        }
+        return it->second;
+      }
+
+     private:
+      static std::mutex& mutex() {
+        static std::mutex m;
+        return m;
+      }
+
+      static std::unordered_map<int, bool>& index() {
+        static std::unordered_map<int, bool> i;
+        return i;
+      }
+    };
   }  // namespace detail
 
   // Defined later in this file
@@ -134,12 +168,16 @@ namespace model {
     template <typename T>
     std::vector<T> getModelObjectSources() const {
       std::vector<T> result;
-      std::vector<WorkspaceObject> wos = sources();
-      result.reserve(wos.size());
-      for (const WorkspaceObject& wo : wos) {
-        boost::optional<T> oSource = wo.optionalCast<T>();
-        if (oSource) {
-          result.emplace_back(*oSource);
+      // Sources are stored by IddObjectType, only fetch the types that derive from T
+      for (const IddObjectType& type : sourceIddObjectTypes()) {
+        auto isOfType = [this, &type]() { return getSources(type).front().optionalCast<T>().has_value(); };
+        if (!detail::ModelObjectTypeIndex<T>::contains(type, isOfType)) {
+          continue;
+        }
+        std::vector<WorkspaceObject> wos = getSources(type);
+        result.reserve(result.size() + wos.size());
+        for (const WorkspaceObject& wo : wos) {
+          result.emplace_back(wo.cast<T>());
         }
       }
       return result;
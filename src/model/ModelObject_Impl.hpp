@@ -230,6 +230,10 @@ namespace model {
         * This method is slower as it executes a lot more queries (an average of 10, versus 1 for getAutosizedValue) */
       boost::optional<double> getAutosizedValueFromInitializationSummary(const std::string& valueName, const std::string& units) const;
 
+      /** Returns the changeCount of the Model containing this object, or none if it has been removed. Objects that cache
+       *  an expensive derived quantity save it alongside, and recompute the quantity once it no longer matches. */
+      boost::optional<std::size_t> modelChangeCount() const;
+
      private:
       REGISTER_LOGGER("openstudio.model.ModelObject");
 
@@ -827,26 +827,48 @@ namespace model {
       return result;
     }
 
-    double Space_Impl::exteriorArea() const {
-      double result = 0;
-      for (const Surface& surface : this->surfaces()) {
-        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors")) {
-          result += surface.grossArea();
-        }
+    void Space_Impl::updateCachedSurfaceAreas() const {
+      // Any change to the model (vertices, constructions, surfaces added, removed or moved to another space...) bumps the change count
+      boost::optional<std::size_t> changeCount = modelChangeCount();
+      if (changeCount && (m_cachedSurfaceAreasChangeCount == changeCount)) {
+        return;
       }
-      return result;
-    }
 
-    double Space_Impl::exteriorWallArea() const {
-      double result = 0;
+      double floorArea = 0.0;
+      double exteriorArea = 0.0;
+      double exteriorWallArea = 0.0;
       for (const Surface& surface : this->surfaces()) {
-        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors")) {
-          if (istringEqual(surface.surfaceType(), "Wall")) {
-            result += surface.grossArea();
+        const std::string surfaceType = surface.surfaceType();
+        const bool isFloor = istringEqual(surfaceType, "Floor") && !surface.isAirWall();
+        const bool isOutdoors = istringEqual(surface.outsideBoundaryCondition(), "Outdoors");
+        if (!isFloor && !isOutdoors) {
+          continue;
+        }
+        const double grossArea = surface.grossArea();
+        if (isFloor) {
+          floorArea += grossArea;
+        }
+        if (isOutdoors) {
+          exteriorArea += grossArea;
+          if (istringEqual(surfaceType, "Wall")) {
+            exteriorWallArea += grossArea;
           }
         }
       }
-      return result;
+      m_cachedFloorArea = floorArea;
+      m_cachedExteriorArea = exteriorArea;
+      m_cachedExteriorWallArea = exteriorWallArea;
+      m_cachedSurfaceAreasChangeCount = changeCount;
+    }
+
+    double Space_Impl::exteriorArea() const {
+      updateCachedSurfaceAreas();
+      return m_cachedExteriorArea;
+    }
+
+    double Space_Impl::exteriorWallArea() const {
+      updateCachedSurfaceAreas();
+      return m_cachedExteriorWallArea;
     }
 
     Polyhedron Space_Impl::polyhedron() const {
@@ -857,16 +879,29 @@ namespace model {
       return {surface3ds};
     }
 
-    bool Space_Impl::isEnclosedVolume() const {
+    void Space_Impl::updateCachedPolyhedron() const {
+      boost::optional<std::size_t> changeCount = modelChangeCount();
+      if (changeCount && (m_cachedPolyhedronChangeCount == changeCount)) {
+        return;
+      }
+
       auto volumePoly = this->polyhedron();
       auto [isVolEnclosed, edgesNot2] = volumePoly.isEnclosedVolume();
-      if (!isVolEnclosed) {
-        LOG(Warn, briefDescription() << " is not enclosed, there are " << edgesNot2.size() << " edges that aren't used exactly twice");
-        for (const Surface3dEdge& edge : edgesNot2) {
-          LOG(Debug, edge);
-        }
+      for (const Surface3dEdge& edge : edgesNot2) {
+        LOG(Debug, edge);
+      }
+      m_cachedIsEnclosedVolume = isVolEnclosed;
+      m_cachedNumEdgesNot2 = edgesNot2.size();
+      m_cachedPolyhedronVolume = isVolEnclosed ? volumePoly.calcPolyhedronVolume() : 0.0;
+      m_cachedPolyhedronChangeCount = changeCount;
+    }
+
+    bool Space_Impl::isEnclosedVolume() const {
+      updateCachedPolyhedron();
+      if (!m_cachedIsEnclosedVolume) {
+        LOG(Warn, briefDescription() << " is not enclosed, there are " << m_cachedNumEdgesNot2 << " edges that aren't used exactly twice");
       }
-      return isVolEnclosed;
+      return m_cachedIsEnclosedVolume;
     }
 
     double Space_Impl::ceilingHeight() const {
@@ -924,14 +959,12 @@ namespace model {
         return value.get();
       }
 
-      auto volumePoly = this->polyhedron();
-
-      auto [isVolEnclosed, edgesNot2] = volumePoly.isEnclosedVolume();
-      if (isVolEnclosed) {
-        return volumePoly.calcPolyhedronVolume();
+      updateCachedPolyhedron();
+      if (m_cachedIsEnclosedVolume) {
+        return m_cachedPolyhedronVolume;
       }
 
-      LOG(Warn, briefDescription() << " is not enclosed, there are " << edgesNot2.size()
+      LOG(Warn, briefDescription() << " is not enclosed, there are " << m_cachedNumEdgesNot2
                                    << " edges that aren't used exactly twice. Volume calculation will be potentially inaccurate");
 
       double result = 0;
@@ -960,16 +993,8 @@ namespace model {
         return value.get();
       }
 
-      double result = 0;
-      for (const Surface& surface : this->surfaces()) {
-        if (istringEqual(surface.surfaceType(), "Floor")) {
-          if (surface.isAirWall()) {
-            continue;
-          }
-          result += surface.grossArea();
-        }
-      }
-      return result;
+      updateCachedSurfaceAreas();
+      return m_cachedFloorArea;
     }
 
     bool Space_Impl::isFloorAreaDefaulted() const {
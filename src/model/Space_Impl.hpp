@@ -515,6 +515,22 @@ namespace model {
      private:
       REGISTER_LOGGER("openstudio.model.Space");
 
+      // Sums the floor, exterior and exterior wall areas of the surfaces, unless the model has not changed since the last time
+      void updateCachedSurfaceAreas() const;
+
+      mutable boost::optional<std::size_t> m_cachedSurfaceAreasChangeCount;
+      mutable double m_cachedFloorArea = 0.0;
+      mutable double m_cachedExteriorArea = 0.0;
+      mutable double m_cachedExteriorWallArea = 0.0;
+
+      // Runs the polyhedron enclosure test and computes its volume, unless the model has not changed since the last time
+      void updateCachedPolyhedron() const;
+
+      mutable boost::optional<std::size_t> m_cachedPolyhedronChangeCount;
+      mutable bool m_cachedIsEnclosedVolume = false;
+      mutable std::size_t m_cachedNumEdgesNot2 = 0;
+      mutable double m_cachedPolyhedronVolume = 0.0;
+
       boost::optional<ModelObject> spaceTypeAsModelObject() const;
       boost::optional<ModelObject> defaultConstructionSetAsModelObject() const;
       boost::optional<ModelObject> defaultScheduleSetAsModelObject() const;
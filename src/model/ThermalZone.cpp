@@ -816,28 +816,39 @@ namespace model {
       return getObject<ModelObject>().getModelObjectSources<Space>(Space::iddObjectType());
     }
 
-    double ThermalZone_Impl::floorArea() const {
-      double result(0.0);
+    void ThermalZone_Impl::updateCachedSpaceAreas() const {
+      boost::optional<std::size_t> changeCount = modelChangeCount();
+      if (changeCount && (m_cachedSpaceAreasChangeCount == changeCount)) {
+        return;
+      }
+
+      double floorArea(0.0);
+      double exteriorSurfaceArea(0.0);
+      double exteriorWallArea(0.0);
       for (const Space& space : spaces()) {
-        result += space.floorArea();
+        floorArea += space.floorArea();
+        exteriorSurfaceArea += space.exteriorArea();
+        exteriorWallArea += space.exteriorWallArea();
       }
-      return result;
+      m_cachedFloorArea = floorArea;
+      m_cachedExteriorSurfaceArea = exteriorSurfaceArea;
+      m_cachedExteriorWallArea = exteriorWallArea;
+      m_cachedSpaceAreasChangeCount = changeCount;
+    }
+
+    double ThermalZone_Impl::floorArea() const {
+      updateCachedSpaceAreas();
+      return m_cachedFloorArea;
     }
 
     double ThermalZone_Impl::exteriorSurfaceArea() const {
-      double result(0.0);
-      for (const Space& space : spaces()) {
-        result += space.exteriorArea();
-      }
-      return result;
+      updateCachedSpaceAreas();
+      return m_cachedExteriorSurfaceArea;
     }
 
     double ThermalZone_Impl::exteriorWallArea() const {
-      double result(0.0);
-      for (const Space& space : spaces()) {
-        result += space.exteriorWallArea();
-      }
-      return result;
+      updateCachedSpaceAreas();
+      return m_cachedExteriorWallArea;
     }
 
     double ThermalZone_Impl::airVolume() const {
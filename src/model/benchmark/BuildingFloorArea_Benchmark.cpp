@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+
+#include "../Building.hpp"
+#include "../Building_Impl.hpp"
+#include "../ThermalZone.hpp"
+#include "../ThermalZone_Impl.hpp"
+#include "../Space.hpp"
+#include "../Space_Impl.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/core/Assert.hpp"
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// A stack of nSpaces 10x10x3 spaces, four per zone
+model::Model makeModelWithNStackedSpaces(size_t nSpaces) {
+
+  Model m;
+
+  constexpr size_t nSpacesPerZone = 4;
+  boost::optional<ThermalZone> z;
+
+  constexpr double floorHeight = 3.0;
+
+  double zOrigin = 0.0;
+  for (size_t i = 0; i < nSpaces; ++i) {
+
+    Point3dVector pts{{0, 0, zOrigin}, {0, 10, zOrigin}, {10, 10, zOrigin}, {10, 0, zOrigin}};
+    auto space_ = Space::fromFloorPrint(pts, floorHeight, m);
+    OS_ASSERT(space_);
+
+    if (i % nSpacesPerZone == 0) {
+      z = ThermalZone(m);
+    }
+    space_->setThermalZone(*z);
+    zOrigin += floorHeight;
+  }
+
+  OS_ASSERT(m.getConcreteModelObjects<Space>().size() == nSpaces);
+  return m;
+}
+
+// What a reporting measure does: query the same aggregates over and over on an unchanged model
+static void BM_BuildingFloorArea_Repeated(benchmark::State& state) {
+
+  Model m = makeModelWithNStackedSpaces(state.range(0));
+  Building building = m.getUniqueModelObject<Building>();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(building.floorArea());
+    benchmark::DoNotOptimize(building.exteriorWallArea());
+    benchmark::DoNotOptimize(building.lightingPowerPerFloorArea());
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_BuildingFloorArea_Repeated)->Unit(benchmark::kMicrosecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+
+// Same, for every thermal zone
+static void BM_ThermalZoneFloorArea_Repeated(benchmark::State& state) {
+
+  Model m = makeModelWithNStackedSpaces(state.range(0));
+  std::vector<ThermalZone> zones = m.getConcreteModelObjects<ThermalZone>();
+
+  for (auto _ : state) {
+    for (const auto& z : zones) {
+      benchmark::DoNotOptimize(z.floorArea());
+      benchmark::DoNotOptimize(z.airVolume());
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_ThermalZoneFloorArea_Repeated)->Unit(benchmark::kMicrosecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+
+// Worst case for the caches: the model changes between every query, so everything is recomputed each time
+static void BM_BuildingFloorArea_ModelChanging(benchmark::State& state) {
+
+  Model m = makeModelWithNStackedSpaces(state.range(0));
+  Building building = m.getUniqueModelObject<Building>();
+  ThermalZone z = m.getConcreteModelObjects<ThermalZone>().front();
+
+  int multiplier = 1;
+  for (auto _ : state) {
+    multiplier = (multiplier % 3) + 1;
+    z.setMultiplier(multiplier);
+    benchmark::DoNotOptimize(building.floorArea());
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_BuildingFloorArea_ModelChanging)->Unit(benchmark::kMicrosecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
@@ -11,6 +11,8 @@
 #include "../Schedule.hpp"
 #include "../ScheduleConstant.hpp"
 #include "../SetpointManagerScheduled.hpp"
+#include "../Space.hpp"
+#include "../ThermalZone.hpp"
 
 #include "../../utilities/idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
@@ -90,6 +92,25 @@ static void BM_SetUpPlantLoop(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+// Clone a model of N spaces, each in its own thermal zone
+static void BM_ModelClone(benchmark::State& state) {
+
+  Model m;
+  for (auto i = 0; i < state.range(0); ++i) {
+    Space space(m);
+    ThermalZone zone(m);
+    space.setThermalZone(zone);
+  }
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    Model clone = m.clone().cast<Model>();
+    benchmark::DoNotOptimize(clone);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -105,3 +126,5 @@ BENCHMARK(BM_AddObjects)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Ran
 // 128 takes 14secs,  512 takes about 300 seconds, 1024 takes 20 minutes. By interpolation, 4096 would take 636 minutes, 8192 = 2567 minutes = 42 h
 // 'y[ms] = 1.156580334046908*x**2 + -72.31709114930806*x + 1397.3555792110117'
 BENCHMARK(BM_SetUpPlantLoop)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(1, 128)->Complexity();
+
+BENCHMARK(BM_ModelClone)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 16384)->Complexity();
@@ -4,6 +4,14 @@
 
 #include "../Surface.hpp"
 #include "../Surface_Impl.hpp"
+#include "../PlanarSurface.hpp"
+#include "../PlanarSurface_Impl.hpp"
+#include "../ScheduleConstant.hpp"
+#include "../ScheduleConstant_Impl.hpp"
+#include "../Construction.hpp"
+#include "../Construction_Impl.hpp"
+#include "../AdditionalProperties.hpp"
+#include "../AdditionalProperties_Impl.hpp"
 #include "../ModelObject.hpp"
 #include "../ModelObject_Impl.hpp"
 
@@ -140,3 +148,90 @@ BENCHMARK(ProposedEmplace)
   ->RangeMultiplier(2)
   ->Range(4, 1024)
   ->Complexity();
+
+// Surfaces diluted among as many unrelated objects, as in a real model where PlanarSurfaces are a fraction of the objects
+model::Model makeModelWithNSurfacesAndNSchedules(size_t nSurfaces) {
+  Model m = makeModelWithNSurfaces(nSurfaces);
+  for (size_t i = 0; i < nSurfaces; ++i) {
+    ScheduleConstant schedule(m);
+  }
+  return m;
+}
+
+// What getModelObjects<T> used to do for an abstract T: try a dynamic cast on every object in the model
+static void AbstractType_CastAllObjects(benchmark::State& state) {
+
+  Model m = makeModelWithNSurfacesAndNSchedules(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<PlanarSurface> result;
+    std::vector<WorkspaceObject> objects = m.objects();
+    result.reserve(objects.size());
+    for (const auto& wo : objects) {
+      if (auto p = wo.optionalCast<PlanarSurface>()) {
+        result.push_back(std::move(*p));
+      }
+    }
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Union of the IddObjectType buckets that derive from PlanarSurface
+static void AbstractType_TypeIndex(benchmark::State& state) {
+
+  Model m = makeModelWithNSurfacesAndNSchedules(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<PlanarSurface> result = m.getModelObjects<PlanarSurface>();
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(AbstractType_CastAllObjects)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+BENCHMARK(AbstractType_TypeIndex)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+// One construction used by every surface, as alwaysOnDiscreteSchedule or a common construction is in a real model
+model::Model makeModelWithNSurfacesSharingAConstruction(size_t nSurfaces) {
+  Model m = makeModelWithNSurfaces(nSurfaces);
+  Construction construction(m);
+  for (auto& surface : m.getConcreteModelObjects<Surface>()) {
+    surface.setConstruction(construction);
+  }
+  return m;
+}
+
+static void HeavilyReferenced_Sources(benchmark::State& state) {
+
+  Model m = makeModelWithNSurfacesSharingAConstruction(state.range(0));
+  Construction construction = m.getConcreteModelObjects<Construction>().front();
+
+  for (auto _ : state) {
+    std::vector<WorkspaceObject> result = construction.sources();
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// The lookup ModelObject::additionalProperties does, which finds nothing among thousands of surfaces
+static void HeavilyReferenced_AdditionalPropertiesSources(benchmark::State& state) {
+
+  Model m = makeModelWithNSurfacesSharingAConstruction(state.range(0));
+  Construction construction = m.getConcreteModelObjects<Construction>().front();
+
+  for (auto _ : state) {
+    std::vector<AdditionalProperties> result = construction.getModelObjectSources<AdditionalProperties>();
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(HeavilyReferenced_Sources)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+BENCHMARK(HeavilyReferenced_AdditionalPropertiesSources)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
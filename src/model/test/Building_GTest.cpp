@@ -786,3 +786,52 @@ TEST_F(ModelFixture, Building_clone_SurfaceMatching) {
   auto nMatchedClone = std::count_if(surfaceClones.cbegin(), surfaceClones.cend(), [](const auto& s) { return s.adjacentSurface(); });
   EXPECT_EQ(nMatched, nMatchedClone);
 }
+
+TEST_F(ModelFixture, Building_CachedSpaceAreas) {
+  Model m;
+  Building building = m.getUniqueModelObject<Building>();
+  ThermalZone z(m);
+
+  Point3dVector floorPrint{{0, 0, 0}, {0, 10, 0}, {10, 10, 0}, {10, 0, 0}};
+  boost::optional<Space> space1 = Space::fromFloorPrint(floorPrint, 3.0, m);
+  ASSERT_TRUE(space1);
+  EXPECT_TRUE(space1->setThermalZone(z));
+
+  EXPECT_DOUBLE_EQ(100.0, building.floorArea());
+  EXPECT_DOUBLE_EQ(120.0, building.exteriorWallArea());
+  EXPECT_DOUBLE_EQ(100.0, z.floorArea());
+  EXPECT_DOUBLE_EQ(120.0, z.exteriorWallArea());
+  // Cached
+  EXPECT_DOUBLE_EQ(100.0, building.floorArea());
+  EXPECT_DOUBLE_EQ(100.0, z.floorArea());
+
+  // Changing the multiplier is seen by the building, not by the zone
+  EXPECT_TRUE(z.setMultiplier(2));
+  EXPECT_DOUBLE_EQ(200.0, building.floorArea());
+  EXPECT_DOUBLE_EQ(240.0, building.exteriorWallArea());
+  EXPECT_DOUBLE_EQ(100.0, z.floorArea());
+
+  // Adding a space, then moving it to the zone
+  boost::optional<Space> space2 = Space::fromFloorPrint(floorPrint, 3.0, m);
+  ASSERT_TRUE(space2);
+  EXPECT_DOUBLE_EQ(300.0, building.floorArea());
+  EXPECT_DOUBLE_EQ(100.0, z.floorArea());
+  EXPECT_TRUE(space2->setThermalZone(z));
+  EXPECT_DOUBLE_EQ(400.0, building.floorArea());
+  EXPECT_DOUBLE_EQ(200.0, z.floorArea());
+
+  // Excluding it from the total floor area
+  EXPECT_TRUE(space2->setPartofTotalFloorArea(false));
+  EXPECT_DOUBLE_EQ(200.0, building.floorArea());
+  EXPECT_DOUBLE_EQ(200.0, z.floorArea());
+
+  // Removing a floor surface
+  for (auto& surface : space1->surfaces()) {
+    if (surface.surfaceType() == "Floor") {
+      surface.remove();
+    }
+  }
+  EXPECT_DOUBLE_EQ(0.0, space1->floorArea());
+  EXPECT_DOUBLE_EQ(0.0, building.floorArea());
+  EXPECT_DOUBLE_EQ(100.0, z.floorArea());
+}
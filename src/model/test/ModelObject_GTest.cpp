@@ -44,6 +44,12 @@
 #include "../StandardsInformationConstruction_Impl.hpp"
 #include "../StandardOpaqueMaterial.hpp"
 #include "../StandardOpaqueMaterial_Impl.hpp"
+#include "../SubSurface.hpp"
+#include "../SubSurface_Impl.hpp"
+#include "../PlanarSurface.hpp"
+#include "../PlanarSurface_Impl.hpp"
+#include "../AdditionalProperties.hpp"
+#include "../AdditionalProperties_Impl.hpp"
 
 #include "../../utilities/core/Containers.hpp"
 
@@ -152,6 +158,36 @@ TEST_F(ModelFixture, ModelObject_SetString) {
   EXPECT_EQ("Space 2", space2.getString(nameIndex).get());
 }
 
+TEST_F(ModelFixture, ModelObject_getModelObjectSources_ByType) {
+  Model m;
+  Construction construction(m);
+  std::vector<Point3d> vertices{{0, 0, 1}, {0, 0, 0}, {1, 0, 0}, {1, 0, 1}};
+  Surface surface(vertices, m);
+  SubSurface subSurface(vertices, m);
+  EXPECT_TRUE(surface.setConstruction(construction));
+  EXPECT_TRUE(subSurface.setConstruction(construction));
+
+  EXPECT_EQ(2u, construction.sources().size());
+  EXPECT_EQ(2u, construction.sourceIddObjectTypes().size());
+
+  // Abstract T spans several source types, concrete T only its own
+  EXPECT_EQ(2u, construction.getModelObjectSources<PlanarSurface>().size());
+  EXPECT_EQ(2u, construction.getModelObjectSources<ModelObject>().size());
+  std::vector<Surface> surfaces = construction.getModelObjectSources<Surface>();
+  ASSERT_EQ(1u, surfaces.size());
+  EXPECT_EQ(surface, surfaces[0]);
+  std::vector<SubSurface> subSurfaces = construction.getModelObjectSources<SubSurface>();
+  ASSERT_EQ(1u, subSurfaces.size());
+  EXPECT_EQ(subSurface, subSurfaces[0]);
+  EXPECT_TRUE(construction.getModelObjectSources<AdditionalProperties>().empty());
+
+  // The surface's type drops out once it no longer points to the construction
+  surface.resetConstruction();
+  EXPECT_TRUE(construction.getModelObjectSources<Surface>().empty());
+  EXPECT_EQ(1u, construction.getModelObjectSources<PlanarSurface>().size());
+  EXPECT_EQ(1u, construction.sourceIddObjectTypes().size());
+}
+
 TEST_F(ModelFixture, ModelObject_SpecialMembers) {
 
   static_assert(!std::is_trivial<ModelObject>{});
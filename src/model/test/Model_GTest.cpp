@@ -43,6 +43,14 @@
 #include "../OutputVariable.hpp"
 #include "../OutputVariable_Impl.hpp"
 #include "../ParentObject_Impl.hpp"
+#include "../PlanarSurface.hpp"
+#include "../PlanarSurface_Impl.hpp"
+#include "../SpaceLoad.hpp"
+#include "../SpaceLoad_Impl.hpp"
+#include "../HVACComponent.hpp"
+#include "../HVACComponent_Impl.hpp"
+#include "../ResourceObject.hpp"
+#include "../ResourceObject_Impl.hpp"
 #include "../RunPeriod.hpp"
 #include "../RunPeriod_Impl.hpp"
 
@@ -166,6 +174,8 @@
 
 #include <boost/algorithm/string/case_conv.hpp>
 
+#include <set>
+
 using namespace openstudio::model;
 using namespace openstudio;
 /*
@@ -1184,3 +1194,48 @@ TEST_F(ModelFixture, UniqueModelObjectCachedGetters) {
   EXPECT_TRUE(m.getOptionalUniqueModelObject<ExternalInterface>());
   EXPECT_EQ(++i, m.getModelObjects<ModelObject>().size());
 }
+
+template <typename T>
+std::set<Handle> handlesOf(const std::vector<T>& objects) {
+  std::set<Handle> result;
+  for (const auto& object : objects) {
+    result.insert(object.handle());
+  }
+  return result;
+}
+
+// The per-type buckets must give the same objects as trying a cast on every object, sorted or not
+template <typename T>
+void checkAbstractModelObjects(const Model& model) {
+  std::set<Handle> expected;
+  for (const auto& object : model.objects()) {
+    if (object.optionalCast<T>()) {
+      expected.insert(object.handle());
+    }
+  }
+  std::vector<T> unsorted = model.getModelObjects<T>();
+  EXPECT_EQ(expected.size(), unsorted.size());
+  EXPECT_EQ(expected, handlesOf(unsorted));
+  EXPECT_EQ(expected, handlesOf(model.getModelObjects<T>(true)));
+}
+
+TEST_F(ModelFixture, Model_getModelObjects_AbstractTypes) {
+  Model model = exampleModel();
+
+  checkAbstractModelObjects<PlanarSurface>(model);
+  checkAbstractModelObjects<SpaceLoad>(model);
+  checkAbstractModelObjects<HVACComponent>(model);
+  checkAbstractModelObjects<ParentObject>(model);
+  checkAbstractModelObjects<ResourceObject>(model);
+  checkAbstractModelObjects<ModelObject>(model);
+
+  // The version object is excluded, as it is from objects()
+  EXPECT_EQ(model.objects().size(), model.getModelObjects<ModelObject>().size());
+
+  // Buckets emptied by a removal are skipped
+  for (auto& surface : model.getConcreteModelObjects<Surface>()) {
+    surface.remove();
+  }
+  EXPECT_TRUE(model.getConcreteModelObjects<Surface>().empty());
+  checkAbstractModelObjects<PlanarSurface>(model);
+}
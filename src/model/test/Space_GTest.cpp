@@ -3226,4 +3226,58 @@ TEST_F(ModelFixture, Space_Polyhedron_Volume) {
   EXPECT_EQ(volume, s.volume());
 }
 
+TEST_F(ModelFixture, Space_Polyhedron_Volume_Cached) {
+
+  Model m;
+  Space s(m);
+
+  // 10x10x3 box
+  auto makeSurface = [&m, &s](std::vector<Point3d> vertices) {
+    Surface surface(vertices, m);
+    surface.setSpace(s);
+    return surface;
+  };
+  Surface south = makeSurface({{+0.0, +0.0, +3.0}, {+0.0, +0.0, +0.0}, {+10.0, +0.0, +0.0}, {+10.0, +0.0, +3.0}});
+  Surface north = makeSurface({{+10.0, +10.0, +3.0}, {+10.0, +10.0, +0.0}, {+0.0, +10.0, +0.0}, {+0.0, +10.0, +3.0}});
+  Surface east = makeSurface({{+10.0, +0.0, +3.0}, {+10.0, +0.0, +0.0}, {+10.0, +10.0, +0.0}, {+10.0, +10.0, +3.0}});
+  Surface west = makeSurface({{+0.0, +10.0, +3.0}, {+0.0, +10.0, +0.0}, {+0.0, +0.0, +0.0}, {+0.0, +0.0, +3.0}});
+  Surface floor = makeSurface({{+0.0, +0.0, +0.0}, {+0.0, +10.0, +0.0}, {+10.0, +10.0, +0.0}, {+10.0, +0.0, +0.0}});
+  Surface roof = makeSurface({{+10.0, +0.0, +3.0}, {+10.0, +10.0, +3.0}, {+0.0, +10.0, +3.0}, {+0.0, +0.0, +3.0}});
+
+  EXPECT_TRUE(s.isEnclosedVolume());
+  EXPECT_DOUBLE_EQ(300.0, s.volume());
+  // Cached
+  EXPECT_DOUBLE_EQ(300.0, s.volume());
+
+  // Changing vertices invalidates the cache
+  std::vector<Point3d> raisedRoof = roof.vertices();
+  for (auto& pt : raisedRoof) {
+    pt = Point3d(pt.x(), pt.y(), 6.0);
+  }
+  for (auto surface : {south, north, east, west}) {
+    std::vector<Point3d> vertices = surface.vertices();
+    for (auto& pt : vertices) {
+      if (pt.z() > 0.0) {
+        pt = Point3d(pt.x(), pt.y(), 6.0);
+      }
+    }
+    EXPECT_TRUE(surface.setVertices(vertices));
+  }
+  EXPECT_TRUE(roof.setVertices(raisedRoof));
+  EXPECT_TRUE(s.isEnclosedVolume());
+  EXPECT_DOUBLE_EQ(600.0, s.volume());
+
+  // So does moving a surface out of the space
+  Space other(m);
+  EXPECT_TRUE(roof.setSpace(other));
+  EXPECT_FALSE(s.isEnclosedVolume());
+  EXPECT_TRUE(roof.setSpace(s));
+  EXPECT_TRUE(s.isEnclosedVolume());
+  EXPECT_DOUBLE_EQ(600.0, s.volume());
+
+  // And removing one
+  roof.remove();
+  EXPECT_FALSE(s.isEnclosedVolume());
+}
+
 //#  endif // SURFACESHATTERING
@@ -30,23 +30,87 @@
 #include "AnnualIlluminanceMap.hpp"
 #include "HeaderInfo.hpp"
 
-#include <iostream>
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/core/FilesystemHelpers.hpp"
+#include "../utilities/core/StringHelpers.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
-#include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
-
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
-
 using namespace std;
-using namespace boost;
 using namespace openstudio;
 
 namespace openstudio {
 namespace radiance {
 
+  namespace {
+
+    // conversion from footcandles to lux
+    constexpr double footcandlesToLux(10.76);
+
+    constexpr char binaryMagic[8] = {'O', 'S', 'A', 'N', 'I', 'L', 'L', '1'};
+
+    // Returns the next line of the buffer (without the end of line) and advances pos past it
+    std::string_view nextLine(std::string_view buffer, size_t& pos) {
+      size_t end = buffer.find('\n', pos);
+      if (end == std::string_view::npos) {
+        end = buffer.size();
+      }
+      std::string_view line = buffer.substr(pos, end - pos);
+      pos = std::min(end + 1, buffer.size());
+      if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+      }
+      return line;
+    }
+
+    // Parses the next whitespace separated number of the line, returns false if there is none
+    template <typename T>
+    bool nextNumber(const char*& first, const char* last, T& value) {
+      while ((first != last) && ((*first == ' ') || (*first == '\t'))) {
+        ++first;
+      }
+      if constexpr (std::is_floating_point_v<T>) {
+        // std::from_chars for doubles is missing from some of the standard libraries we support
+        double parsed = 0.0;
+        const char* ptr = openstudio::string_conversions::parseDouble(first, last, parsed);
+        if (ptr == nullptr) {
+          return false;
+        }
+        value = static_cast<T>(parsed);
+        first = ptr;
+      } else {
+        if ((first != last) && (*first == '+')) {
+          // from_chars does not accept a leading plus sign
+          ++first;
+        }
+        auto [ptr, ec] = std::from_chars(first, last, value);
+        if (ec != std::errc()) {
+          return false;
+        }
+        first = ptr;
+      }
+      return true;
+    }
+
+    template <typename T>
+    void writeValue(std::ofstream& ofs, const T& value) {
+      ofs.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool readValue(std::ifstream& ifs, T& value) {
+      return static_cast<bool>(ifs.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+  }  // namespace
+
   /// default constructor
   AnnualIlluminanceMap::AnnualIlluminanceMap() = default;
 
@@ -55,6 +119,14 @@ namespace radiance {
     init(path);
   }
 
+  AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::IlluminanceMapSeries& maps)
+    : m_dateTimes(maps.dateTimes), m_xVector(maps.x), m_yVector(maps.y), m_illuminance(maps.illuminance.begin(), maps.illuminance.end()) {
+    const size_t mapSize = maps.x.size() * maps.y.size();
+    for (size_t t = 0; t < maps.dateTimes.size(); ++t) {
+      m_dateTimeIndex[maps.dateTimes[t]] = t * mapSize;
+    }
+  }
+
   void AnnualIlluminanceMap::init(const openstudio::path& path) {
     // file must exist
     if (!exists(path)) {
@@ -62,116 +134,224 @@ namespace radiance {
       return;
     }
 
-    // open file
-    openstudio::filesystem::ifstream file(path);
-
-    // keep track of line number
-    unsigned lineNum = 0;
-
-    // keep track of matrix size
-    unsigned M = 0;
-    unsigned N = 0;
-
-    // temp string to read file
-    string line;
+    // read the whole file at once, the numbers are then parsed in place
+    const std::string buffer = openstudio::filesystem::read_as_string(path);
+    size_t pos = 0;
 
     // lines 1 and 2 are the header lines
-    string line1;
-    string line2;
+    const std::string line1(nextLine(buffer, pos));
+    const std::string line2(nextLine(buffer, pos));
 
-    // this will contain matches to regular expressions
-    smatch matches;
+    // create the header info
+    HeaderInfo headerInfo(line1, line2);
 
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
+    // we can now initialize x and y vectors
+    m_xVector = headerInfo.xVector();
+    m_yVector = headerInfo.yVector();
 
-    // conversion from footcandles to lux
-    const double footcandlesToLux(10.76);
+    const unsigned M = m_xVector.size();
+    const unsigned N = m_yVector.size();
+    const size_t mapSize = size_t(M) * N;
 
     // read the rest of the file line by line
-    while (getline(file, line)) {
+    unsigned lineNum = 2;
+    while (pos < buffer.size()) {
+      const std::string_view line = nextLine(buffer, pos);
       ++lineNum;
+      if (line.find_first_not_of(" \t") == std::string_view::npos) {
+        continue;
+      }
 
-      if (lineNum == 1) {
+      // each line contains the month, day, time (in hours),
+      // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
+      // followed by M*N illuminance points
+      const char* first = line.data();
+      const char* last = line.data() + line.size();
+
+      unsigned month = 0;
+      unsigned day = 0;
+      double hours = 0.0;
+      double ignored = 0.0;
+      // ignore solar angles and global horizontal for now
+      if (!nextNumber(first, last, month) || !nextNumber(first, last, day) || !nextNumber(first, last, hours) || !nextNumber(first, last, ignored)
+          || !nextNumber(first, last, ignored) || !nextNumber(first, last, ignored)) {
+        LOG(Fatal, "Unable to read the date and solar data on line " << lineNum << ".");
+        return;
+      }
 
-        // save line 1
-        line1 = line;
+      // read in the values, already in [y][x] order
+      const size_t offset = m_illuminance.size();
+      m_illuminance.resize(offset + mapSize);
+      size_t numValues = 0;
+      double value = 0.0;
+      while (nextNumber(first, last, value)) {
+        if (numValues < mapSize) {
+          m_illuminance[offset + numValues] = static_cast<float>(footcandlesToLux * value);
+        }
+        ++numValues;
+      }
 
-      } else if (lineNum == 2) {
+      if (numValues != mapSize) {
+        LOG(Fatal, "Incorrect number of illuminance values read " << numValues << ", expecting " << mapSize << ".");
+        m_illuminance.resize(offset);
+        return;
+      }
 
-        // save line 2
-        line2 = line;
+      // make the date time
+      DateTime dateTime(Date(monthOfYear(month), day), Time(hours / 24.0));
 
-        // create the header info
-        HeaderInfo headerInfo(line1, line2);
+      auto [it, inserted] = m_dateTimeIndex.emplace(dateTime, offset);
+      if (!inserted) {
+        // a later map for the same date and time replaces the earlier one
+        std::copy(m_illuminance.begin() + offset, m_illuminance.end(), m_illuminance.begin() + it->second);
+        m_illuminance.resize(offset);
+      }
+      m_dateTimes.push_back(dateTime);
+    }
+  }
 
-        // we can now initialize x and y vectors
-        m_xVector = headerInfo.xVector();
-        m_yVector = headerInfo.yVector();
+  boost::optional<AnnualIlluminanceMap> AnnualIlluminanceMap::loadBinary(const openstudio::path& path) {
+    std::ifstream ifs(toString(path), std::ios_base::binary);
+    if (!ifs) {
+      LOG(Error, "Unable to open '" << toString(path) << "'");
+      return boost::none;
+    }
 
-        M = m_xVector.size();
-        N = m_yVector.size();
+    char magic[sizeof(binaryMagic)];
+    std::uint32_t M = 0;
+    std::uint32_t N = 0;
+    std::uint64_t nTimes = 0;
+    std::uint64_t nMaps = 0;
+    if (!ifs.read(magic, sizeof(magic)) || (std::memcmp(magic, binaryMagic, sizeof(magic)) != 0) || !readValue(ifs, M) || !readValue(ifs, N)
+        || !readValue(ifs, nTimes) || !readValue(ifs, nMaps)) {
+      LOG(Error, "'" << toString(path) << "' is not a binary AnnualIlluminanceMap");
+      return boost::none;
+    }
 
+    // the header counts must match the size of the file before anything is allocated from them, the checks are written so that
+    // nothing can overflow
+    const std::uint64_t headerSize = sizeof(binaryMagic) + 2 * sizeof(std::uint32_t) + 2 * sizeof(std::uint64_t);
+    const std::uint64_t dateTimeSize = 2 * sizeof(std::uint32_t) + sizeof(double) + sizeof(std::uint64_t);
+    const std::uint64_t axesSize = sizeof(double) * (std::uint64_t(M) + N);
+    const std::uint64_t mapSize = std::uint64_t(M) * N;
+    const std::uint64_t fileSize = openstudio::filesystem::file_size(path);
+    std::uint64_t remaining = (fileSize > headerSize) ? (fileSize - headerSize) : 0;
+    bool sizesOk = (axesSize <= remaining);
+    if (sizesOk) {
+      remaining -= axesSize;
+      sizesOk = (nTimes <= remaining / dateTimeSize);
+    }
+    if (sizesOk) {
+      remaining -= nTimes * dateTimeSize;
+      if (mapSize == 0) {
+        sizesOk = (nMaps == 0) && (remaining == 0);
       } else {
+        sizesOk = (nMaps <= remaining / sizeof(float) / mapSize) && (nMaps * mapSize * sizeof(float) == remaining);
+      }
+    }
+    if (!sizesOk) {
+      LOG(Error, "'" << toString(path) << "' is truncated or corrupt");
+      return boost::none;
+    }
 
-        // each line contains the month, day, time (in hours),
-        // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
-        // followed by M*N illuminance points
-
-        // break the line up by spaces
-        vector<string> lineVector;
-        tokenizer<char_separator<char>, std::string::const_iterator, std::string> tk(line, char_separator<char>(" "));
-        for (tokenizer<char_separator<char>, std::string::const_iterator, std::string>::iterator it(tk.begin()); it != tk.end(); ++it) {
-          lineVector.push_back(*it);
-        }
+    AnnualIlluminanceMap result;
+    result.m_xVector = openstudio::Vector(M);
+    result.m_yVector = openstudio::Vector(N);
+    bool ok = true;
+    for (unsigned i = 0; ok && (i < M); ++i) {
+      ok = readValue(ifs, result.m_xVector[i]);
+    }
+    for (unsigned j = 0; ok && (j < N); ++j) {
+      ok = readValue(ifs, result.m_yVector[j]);
+    }
 
-        // total number minus 6 standard header items
-        unsigned numValues = lineVector.size() - 6;
+    result.m_dateTimes.reserve(nTimes);
+    for (std::uint64_t t = 0; ok && (t < nTimes); ++t) {
+      std::uint32_t month = 0;
+      std::uint32_t day = 0;
+      double fracDays = 0.0;
+      std::uint64_t offset = 0;
+      ok = readValue(ifs, month) && readValue(ifs, day) && readValue(ifs, fracDays) && readValue(ifs, offset);
+      if (ok) {
+        DateTime dateTime(Date(monthOfYear(month), day), Time(fracDays));
+        result.m_dateTimes.push_back(dateTime);
+        result.m_dateTimeIndex[dateTime] = offset;
+      }
+    }
 
-        if (numValues != M * N) {
-          LOG(Fatal, "Incorrect number of illuminance values read " << numValues << ", expecting " << M * N << ".");
-          return;
-        } else {
+    if (ok) {
+      result.m_illuminance.resize(nMaps * mapSize);
+      ok = static_cast<bool>(ifs.read(reinterpret_cast<char*>(result.m_illuminance.data()),
+                                      static_cast<std::streamsize>(result.m_illuminance.size() * sizeof(float))));
+    }
+    if (ok) {
+      ok = std::all_of(result.m_dateTimeIndex.begin(), result.m_dateTimeIndex.end(),
+                       [&result, M, N](const auto& p) { return p.second + size_t(M) * N <= result.m_illuminance.size(); });
+    }
+    if (!ok) {
+      LOG(Error, "'" << toString(path) << "' is truncated or corrupt");
+      return boost::none;
+    }
 
-          MonthOfYear thisMonth = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          auto day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
+    return result;
+  }
 
-          // ignore solar angles and global horizontal for now
+  bool AnnualIlluminanceMap::saveBinary(const openstudio::path& path) const {
+    std::ofstream ofs(toString(path), std::ios_base::binary | std::ios_base::trunc);
+    if (!ofs) {
+      LOG(Error, "Unable to write '" << toString(path) << "'");
+      return false;
+    }
 
-          // make the date time
-          DateTime dateTime(Date(thisMonth, day), Time(fracDays));
+    const auto M = static_cast<std::uint32_t>(m_xVector.size());
+    const auto N = static_cast<std::uint32_t>(m_yVector.size());
+    const std::uint64_t mapSize = std::uint64_t(M) * N;
+
+    ofs.write(binaryMagic, sizeof(binaryMagic));
+    writeValue(ofs, M);
+    writeValue(ofs, N);
+    writeValue(ofs, static_cast<std::uint64_t>(m_dateTimes.size()));
+    writeValue(ofs, static_cast<std::uint64_t>(mapSize == 0 ? 0 : m_illuminance.size() / mapSize));
+    for (unsigned i = 0; i < M; ++i) {
+      writeValue(ofs, m_xVector[i]);
+    }
+    for (unsigned j = 0; j < N; ++j) {
+      writeValue(ofs, m_yVector[j]);
+    }
+    for (const DateTime& dateTime : m_dateTimes) {
+      writeValue(ofs, static_cast<std::uint32_t>(month(dateTime.date().monthOfYear())));
+      writeValue(ofs, static_cast<std::uint32_t>(dateTime.date().dayOfMonth()));
+      writeValue(ofs, dateTime.time().totalDays());
+      writeValue(ofs, static_cast<std::uint64_t>(m_dateTimeIndex.at(dateTime)));
+    }
+    ofs.write(reinterpret_cast<const char*>(m_illuminance.data()), static_cast<std::streamsize>(m_illuminance.size() * sizeof(float)));
 
-          // matrix we are going to read in
-          Matrix illuminanceMap(M, N);
+    return static_cast<bool>(ofs);
+  }
 
-          // read in the values
-          unsigned index = 6;
-          for (unsigned j = 0; j < N; ++j) {
-            for (unsigned i = 0; i < M; ++i) {
-              illuminanceMap(i, j) = footcandlesToLux * lexical_cast<double>(lineVector[index]);
-              ++index;
-            }
-          }
+  /// get the illuminance map in lux corresponding to date and time
+  openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const {
+    const View view = illuminanceMapView(dateTime);
+    if (view.empty()) {
+      return m_nullIlluminanceMap;
+    }
 
-          m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
-        }
+    Matrix result(view.size1(), view.size2());
+    for (unsigned j = 0; j < view.size2(); ++j) {
+      for (unsigned i = 0; i < view.size1(); ++i) {
+        result(i, j) = view(i, j);
       }
     }
-
-    // close file
-    file.close();
+    return result;
   }
 
-  /// get the illuminance map in lux corresponding to date and time
-  openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const {
-    auto it = m_dateTimeIlluminanceMap.find(dateTime);
-    if (it != m_dateTimeIlluminanceMap.end()) {
-      return it->second;
+  AnnualIlluminanceMap::View AnnualIlluminanceMap::illuminanceMapView(const openstudio::DateTime& dateTime) const {
+    auto it = m_dateTimeIndex.find(dateTime);
+    if (it != m_dateTimeIndex.end()) {
+      return {m_illuminance.data() + it->second, static_cast<unsigned>(m_xVector.size()), static_cast<unsigned>(m_yVector.size())};
     }
 
-    return m_nullIlluminanceMap;
+    return {};
   }
 
 }  // namespace radiance
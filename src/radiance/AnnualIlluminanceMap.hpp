@@ -37,6 +37,12 @@
 #include "../utilities/time/DateTime.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
+#include "../utilities/sql/IlluminanceMapSeries.hpp"
+
+#include <boost/optional.hpp>
+
+#include <map>
+#include <vector>
 
 namespace openstudio {
 namespace radiance {
@@ -47,20 +53,63 @@ namespace radiance {
   */
   class RADIANCE_API AnnualIlluminanceMap
   {
-   private:
-    // map of DateTime to Matrix (illuminance map)
-    using DateTimeIlluminanceMap = std::map<openstudio::DateTime, openstudio::Matrix>;
-
    public:
+    /** Read-only view over the illuminance map (in lux) of a single date and time, indexed like the Matrix returned by illuminanceMap:
+    *   (i, j) is the illuminance at x(i), y(j). The view points into the AnnualIlluminanceMap and is only valid as long as it is. */
+    class RADIANCE_API View
+    {
+     public:
+      View() = default;
+      View(const float* data, unsigned size1, unsigned size2) : m_data(data), m_size1(size1), m_size2(size2) {}
+
+      /// number of x points
+      unsigned size1() const {
+        return m_size1;
+      }
+
+      /// number of y points
+      unsigned size2() const {
+        return m_size2;
+      }
+
+      /// true if there is no data for this date and time
+      bool empty() const {
+        return m_data == nullptr;
+      }
+
+      /// values are stored row by row of y, ie data()[j * size1() + i] is the illuminance at x(i), y(j)
+      const float* data() const {
+        return m_data;
+      }
+
+      float operator()(unsigned i, unsigned j) const {
+        return m_data[j * m_size1 + i];
+      }
+
+     private:
+      const float* m_data = nullptr;
+      unsigned m_size1 = 0;
+      unsigned m_size2 = 0;
+    };
+
     /// default constructor
     AnnualIlluminanceMap();
 
     /// constructor with path
     AnnualIlluminanceMap(const openstudio::path& path);
 
+    /// constructor from the illuminance maps of an EnergyPlus SqlFile (see SqlFile::illuminanceMaps), which share the same layout
+    explicit AnnualIlluminanceMap(const openstudio::IlluminanceMapSeries& maps);
+
     /// virtual destructor
     virtual ~AnnualIlluminanceMap() = default;
 
+    /// load an illuminance map previously written with saveBinary
+    static boost::optional<AnnualIlluminanceMap> loadBinary(const openstudio::path& path);
+
+    /// write the parsed illuminance map in a compact binary form, which loadBinary reads back without any parsing
+    bool saveBinary(const openstudio::path& path) const;
+
     /// get the dates and times for which illuminance maps are available
     openstudio::DateTimeVector dateTimes() const {
       return m_dateTimes;
@@ -80,6 +129,9 @@ namespace radiance {
     /// get the illuminance map in lux corresponding to date and time
     openstudio::Matrix illuminanceMap(const openstudio::DateTime& dateTime) const;
 
+    /// get a view of the illuminance map in lux corresponding to date and time, without copying it. Empty if there is no data
+    View illuminanceMapView(const openstudio::DateTime& dateTime) const;
+
    private:
     REGISTER_LOGGER("radiance.AnnualIlluminanceMap");
 
@@ -89,7 +141,10 @@ namespace radiance {
     openstudio::Vector m_xVector;
     openstudio::Vector m_yVector;
     openstudio::Matrix m_nullIlluminanceMap;  // used when there is no data
-    DateTimeIlluminanceMap m_dateTimeIlluminanceMap;
+    // index of each date and time's map in m_illuminance
+    std::map<openstudio::DateTime, size_t> m_dateTimeIndex;
+    // all illuminance maps (lux) in one contiguous [time][y][x] buffer
+    std::vector<float> m_illuminance;
   };
 
 }  // namespace radiance
@@ -21,6 +21,10 @@
 %template(AnnualIlluminanceMapVector) std::vector< std::shared_ptr<openstudio::radiance::AnnualIlluminanceMap> >;
 
 %ignore openstudio::radiance::AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::Path&);
+%ignore openstudio::radiance::AnnualIlluminanceMap::View;
+%ignore openstudio::radiance::AnnualIlluminanceMap::illuminanceMapView;
+%ignore openstudio::radiance::AnnualIlluminanceMap::loadBinary;
+%ignore openstudio::radiance::AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::IlluminanceMapSeries&);
 
 %include <radiance/AnnualIlluminanceMap.hpp>
 
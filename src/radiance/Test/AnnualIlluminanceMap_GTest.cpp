@@ -31,8 +31,16 @@
 
 #include "../AnnualIlluminanceMap.hpp"
 
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/FilesystemHelpers.hpp"
+
 #include <resources.hxx>
 
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio::radiance;
@@ -73,3 +81,61 @@ AnnualIlluminanceMap RadAnnualIlluminanceMapFixture::outFile;
 ///////////////////////////////////////////////////////////////////////////////
 
 TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap) {}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_Binary) {
+  openstudio::DateTimeVector dateTimes = outFile.dateTimes();
+  ASSERT_FALSE(dateTimes.empty());
+
+  openstudio::path binaryPath = openstudio::filesystem::temp_directory_path() / toPath("annual_day.illbin");
+  ASSERT_TRUE(outFile.saveBinary(binaryPath));
+
+  boost::optional<AnnualIlluminanceMap> loaded = AnnualIlluminanceMap::loadBinary(binaryPath);
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(outFile.xVector().size(), loaded->xVector().size());
+  EXPECT_EQ(outFile.yVector().size(), loaded->yVector().size());
+  ASSERT_EQ(dateTimes.size(), loaded->dateTimes().size());
+
+  for (const openstudio::DateTime& dateTime : dateTimes) {
+    AnnualIlluminanceMap::View expected = outFile.illuminanceMapView(dateTime);
+    AnnualIlluminanceMap::View actual = loaded->illuminanceMapView(dateTime);
+    ASSERT_FALSE(expected.empty());
+    ASSERT_FALSE(actual.empty());
+    ASSERT_EQ(expected.size1(), actual.size1());
+    ASSERT_EQ(expected.size2(), actual.size2());
+    for (unsigned j = 0; j < expected.size2(); ++j) {
+      for (unsigned i = 0; i < expected.size1(); ++i) {
+        EXPECT_EQ(expected(i, j), actual(i, j));
+      }
+    }
+
+    // The Matrix accessor returns the same values
+    openstudio::Matrix matrix = outFile.illuminanceMap(dateTime);
+    ASSERT_EQ(expected.size1(), matrix.size1());
+    ASSERT_EQ(expected.size2(), matrix.size2());
+    EXPECT_DOUBLE_EQ(expected(0, 0), matrix(0, 0));
+  }
+
+  // Header counts that do not match the size of the file are rejected before anything is allocated
+  {
+    std::fstream fs(openstudio::toString(binaryPath), std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    ASSERT_TRUE(fs);
+    const std::uint32_t hugeCount = std::numeric_limits<std::uint32_t>::max();
+    fs.seekp(8);  // after the magic, M then N
+    fs.write(reinterpret_cast<const char*>(&hugeCount), sizeof(hugeCount));
+    fs.write(reinterpret_cast<const char*>(&hugeCount), sizeof(hugeCount));
+  }
+  EXPECT_FALSE(AnnualIlluminanceMap::loadBinary(binaryPath));
+
+  // So are truncated files
+  ASSERT_TRUE(outFile.saveBinary(binaryPath));
+  {
+    std::string content = openstudio::filesystem::read_as_string(binaryPath);
+    ASSERT_FALSE(content.empty());
+    content.pop_back();
+    std::ofstream ofs(openstudio::toString(binaryPath), std::ios_base::binary | std::ios_base::trunc);
+    ofs.write(content.data(), static_cast<std::streamsize>(content.size()));
+  }
+  EXPECT_FALSE(AnnualIlluminanceMap::loadBinary(binaryPath));
+
+  openstudio::filesystem::remove(binaryPath);
+}
@@ -37,6 +37,7 @@
 #include "../core/StringHelpers.hpp"
 #include "../core/FileReference.hpp"
 #include "../core/Assert.hpp"
+#include "../core/Checksum.hpp"
 
 #include <OpenStudio.hxx>
 
@@ -46,11 +47,18 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/classification.hpp>
 
+#include <json/json.h>
+
+#include <fmt/format.h>
+
 #include <src/utilities/embedded_files.hxx>
 
 #include <array>
 #include <algorithm>
 #include <cctype>  // std::isalpha, std::isdigit
+#include <cstdlib>
+#include <ctime>
+#include <map>
 #include <string_view>
 #include <vector>
 
@@ -106,6 +114,159 @@ static constexpr std::array<std::string_view, approvedSubFolderToUsageMap.size()
   return result;
 }();
 
+/// Per-user directory in which checkForUpdatesFiles keeps the checksums of the measure files: $XDG_CACHE_HOME if set, else %LOCALAPPDATA% on
+/// Windows and ~/.cache elsewhere. Nothing is ever written to the measure directories themselves, which may be read-only or under version control
+static openstudio::path checksumCacheDirectory() {
+  openstudio::path result;
+  if (const char* xdgCacheHome = std::getenv("XDG_CACHE_HOME"); (xdgCacheHome != nullptr) && (*xdgCacheHome != '\0')) {
+    result = toPath(xdgCacheHome);
+  }
+#if defined(_WIN32)
+  if (result.empty()) {
+    if (const char* localAppData = std::getenv("LOCALAPPDATA"); (localAppData != nullptr) && (*localAppData != '\0')) {
+      result = toPath(localAppData);
+    }
+  }
+#endif
+  if (result.empty()) {
+    result = openstudio::filesystem::home_path() / toPath(".cache");
+  }
+  return result / toPath("openstudio") / toPath("measure-checksums");
+}
+
+/** Persistent record of the size, modification time and checksum of the files of a measure directory, so that checkForUpdatesFiles
+ *  only checksums the files that changed since the last call. It lives in the per-user checksumCacheDirectory, in a file named after a hash
+ *  of the measure directory. Failing to read or write the cache is not an error, everything is simply checksummed again. */
+class MeasureChecksumCache
+{
+ public:
+  explicit MeasureChecksumCache(const openstudio::path& measureDir) : m_measureDir(measureDir) {
+    boost::system::error_code ec;
+    const openstudio::path canonicalDir = openstudio::filesystem::weakly_canonical(measureDir, ec);
+    m_measureKey = (ec ? measureDir : canonicalDir).generic_string();
+    m_cachePath = checksumCacheDirectory() / toPath(fmt::format("{:016x}.json", std::hash<std::string>{}(m_measureKey)));
+    try {
+      openstudio::filesystem::ifstream ifs(m_cachePath);
+      Json::Value root;
+      Json::CharReaderBuilder rbuilder;
+      std::string formattedErrors;
+      // the measure directory is recorded too, in case of a hash collision
+      if (ifs && Json::parseFromStream(rbuilder, ifs, &root, &formattedErrors) && root.isObject() && (root["version"].asInt() == 2)
+          && (root["measure_dir"].asString() == m_measureKey)) {
+        const Json::Value& files = root["files"];
+        for (const auto& relativePath : files.getMemberNames()) {
+          const Json::Value& entry = files[relativePath];
+          m_entries.emplace(relativePath,
+                            Entry{entry["size"].asUInt64(), static_cast<std::time_t>(entry["mtime"].asInt64()), entry["checksum"].asString()});
+        }
+      }
+    } catch (...) {
+      m_entries.clear();
+    }
+  }
+
+  /// Returns the checksum of the file, reusing the cached one if neither the size nor the modification time of the file changed
+  std::string checksum(const openstudio::path& absoluteFilePath) {
+    boost::optional<Entry> stats = stat(absoluteFilePath);
+    if (!stats) {
+      return openstudio::checksum(absoluteFilePath);
+    }
+
+    const std::string key = keyFor(absoluteFilePath);
+    auto it = m_entries.find(key);
+    if ((it != m_entries.end()) && (it->second.size == stats->size) && (it->second.mtime == stats->mtime)) {
+      return it->second.checksum;
+    }
+
+    stats->checksum = openstudio::checksum(absoluteFilePath);
+    std::string result = stats->checksum;
+    store(key, std::move(*stats));
+    return result;
+  }
+
+  /// Records a checksum that was just computed
+  void insert(const openstudio::path& absoluteFilePath, const std::string& checksum) {
+    if (boost::optional<Entry> stats = stat(absoluteFilePath)) {
+      stats->checksum = checksum;
+      store(keyFor(absoluteFilePath), std::move(*stats));
+    }
+  }
+
+  void save() const {
+    if (!m_changed) {
+      return;
+    }
+    try {
+      Json::Value root;
+      root["version"] = 2;
+      root["measure_dir"] = m_measureKey;
+      Json::Value& files = root["files"];
+      files = Json::Value(Json::objectValue);
+      for (const auto& [relativePath, entry] : m_entries) {
+        Json::Value& value = files[relativePath];
+        value["size"] = static_cast<Json::UInt64>(entry.size);
+        value["mtime"] = static_cast<Json::Int64>(entry.mtime);
+        value["checksum"] = entry.checksum;
+      }
+      Json::StreamWriterBuilder wbuilder;
+      wbuilder["indentation"] = "";
+      boost::system::error_code ec;
+      openstudio::filesystem::create_directories(m_cachePath.parent_path(), ec);
+      openstudio::filesystem::ofstream ofs(m_cachePath, std::ios_base::trunc);
+      if (ofs) {
+        ofs << Json::writeString(wbuilder, root);
+      }
+      if (!ofs) {
+        LOG_FREE(Debug, "utilities.bcl.BCLMeasure", "Unable to write the checksum cache '" << toString(m_cachePath) << "'");
+      }
+    } catch (const std::exception& e) {
+      LOG_FREE(Debug, "utilities.bcl.BCLMeasure", "Unable to write the checksum cache '" << toString(m_cachePath) << "': " << e.what());
+    }
+  }
+
+ private:
+  struct Entry
+  {
+    std::uintmax_t size;
+    std::time_t mtime;
+    std::string checksum;
+  };
+
+  std::string keyFor(const openstudio::path& absoluteFilePath) const {
+    return absoluteFilePath.lexically_relative(m_measureDir).generic_string();
+  }
+
+  static boost::optional<Entry> stat(const openstudio::path& absoluteFilePath) {
+    boost::system::error_code ec;
+    const std::uintmax_t size = openstudio::filesystem::file_size(absoluteFilePath, ec);
+    if (ec) {
+      return boost::none;
+    }
+    const std::time_t mtime = openstudio::filesystem::last_write_time(absoluteFilePath, ec);
+    if (ec) {
+      return boost::none;
+    }
+    return Entry{size, mtime, std::string()};
+  }
+
+  void store(const std::string& key, Entry entry) {
+    // Modification times only have a one second resolution: a file written in the last couple of seconds could still be modified
+    // without its time changing, so it is not trusted until later (the same rule git uses for its index)
+    if (entry.mtime < std::time(nullptr) - 2) {
+      m_entries[key] = std::move(entry);
+    } else {
+      m_entries.erase(key);
+    }
+    m_changed = true;
+  }
+
+  openstudio::path m_measureDir;
+  std::string m_measureKey;
+  openstudio::path m_cachePath;
+  std::map<std::string, Entry> m_entries;
+  bool m_changed = false;
+};
+
 bool BCLMeasure::isIgnoredFileName(const std::string& fileName) {
   return (fileName.empty() || (boost::starts_with(fileName, ".") && (fileName != ".gitkeep")));
 }
@@ -987,6 +1148,8 @@ bool BCLMeasure::missingRequiredFields() const {
 bool BCLMeasure::checkForUpdatesFiles() {
   bool result = false;
 
+  MeasureChecksumCache checksumCache(m_directory);
+
   std::vector<BCLFileReference> filesToRemove;
   std::vector<BCLFileReference> filesToAdd;
 
@@ -1012,17 +1175,24 @@ bool BCLMeasure::checkForUpdatesFiles() {
       filesToRemove.push_back(file);
 
       // otherwise, compute new checksum, and if not the same: mark it for addition
-    } else if (file.checkForUpdate()) {
-      LOG(Info, filePath << " has been updated");
-      result = true;
-      filesToAdd.push_back(file);
+    } else {
+      const std::string newChecksum = checksumCache.checksum(filePath);
+      if (file.checksum() != newChecksum) {
+        file.setChecksum(newChecksum);
+        LOG(Info, filePath << " has been updated");
+        result = true;
+        filesToAdd.push_back(file);
+      }
     }
   }
 
-  auto addWithUsageTypeIfNotExisting = [this, &filesToAdd](const openstudio::path& relativeFilePath, const std::string& usageType) -> bool {
+  auto addWithUsageTypeIfNotExisting = [this, &filesToAdd, &checksumCache](const openstudio::path& relativeFilePath,
+                                                                          const std::string& usageType) -> bool {
     if (!m_bclXML.hasFile(m_directory / relativeFilePath)) {
       BCLFileReference fileref(m_directory, relativeFilePath, true);
       fileref.setUsageType(usageType);
+      // record it, so that it does not get checksummed again next time
+      checksumCache.insert(fileref.path(), fileref.checksum());
       filesToAdd.push_back(fileref);
       return true;
     } else {
@@ -1058,6 +1228,8 @@ bool BCLMeasure::checkForUpdatesFiles() {
     }
   }
 
+  checksumCache.save();
+
   for (const BCLFileReference& file : filesToRemove) {
     m_bclXML.removeFile(file.path());
   }
@@ -37,9 +37,27 @@
 #include "utilities/core/Filesystem.hpp"
 
 #include <algorithm>
+#include <cstdlib>
+#include <ctime>
 #include <sstream>
 #include <pugixml.hpp>
 
+#if defined(_WIN32)
+// A wrapper to implement setenv on Windows like on Unix, using _putenv internally
+static int setenv(const char* name, const char* value, int overwrite) {
+  if (!overwrite) {
+    size_t envsize = 0;
+    int errcode = getenv_s(&envsize, NULL, 0, name);
+    if (errcode || envsize) return errcode;
+  }
+  return _putenv_s(name, value);
+}
+
+static void unsetenv(const char* name) {
+  _putenv_s(name, "");
+}
+#endif
+
 using namespace openstudio;
 namespace fs = openstudio::filesystem;
 
@@ -258,6 +276,88 @@ TEST_F(BCLFixture, BCLMeasure_NewReportingMeasure) {
   ASSERT_FALSE(exists(dir));
 }
 
+TEST_F(BCLFixture, BCLMeasure_ChecksumCache) {
+
+  openstudio::path dir = resourcesPath() / toPath("/utilities/BCL/Measures/ChecksumCacheMeasure/");
+
+  // In case cleanup didn't happen in the previous run
+  if (openstudio::filesystem::exists(dir)) {
+    ASSERT_TRUE(removeDirectory(dir));
+  }
+
+  // The cache is kept in the per-user cache directory, pointed to a scratch one for the test
+  const openstudio::path cacheHome = openstudio::filesystem::temp_directory_path() / toPath("BCLMeasure_ChecksumCache");
+  openstudio::filesystem::remove_all(cacheHome);
+  const char* previousCacheHome = std::getenv("XDG_CACHE_HOME");
+  const std::string previousCacheHomeValue = (previousCacheHome != nullptr) ? previousCacheHome : "";
+  setenv("XDG_CACHE_HOME", toString(cacheHome).c_str(), 1);
+  const openstudio::path cacheDir = cacheHome / toPath("openstudio/measure-checksums");
+  auto cacheFiles = [&cacheDir]() {
+    std::vector<openstudio::path> result;
+    if (openstudio::filesystem::is_directory(cacheDir)) {
+      for (openstudio::filesystem::directory_iterator it(cacheDir), end; it != end; ++it) {
+        result.push_back(it->path());
+      }
+    }
+    return result;
+  };
+
+  boost::optional<BCLMeasure> measure = BCLMeasure("Checksum Cache Measure", BCLMeasure::makeClassName("Checksum Cache Measure"), dir,
+                                                   "Envelope.Fenestration", MeasureType::ModelMeasure, "Description", "Modeler Description");
+  ASSERT_TRUE(measure);
+
+  // Files that were just written are not cached, their modification time is not reliable yet
+  const openstudio::path measurePath = dir / toPath("measure.rb");
+  const std::time_t before = std::time(nullptr) - 100;
+  for (const BCLFileReference& file : measure->files()) {
+    openstudio::filesystem::last_write_time(file.path(), before);
+  }
+  EXPECT_FALSE(measure->checkForUpdatesFiles());
+  ASSERT_EQ(1u, cacheFiles().size());
+  EXPECT_FALSE(measure->checkForUpdatesFiles());
+
+  // Nothing is written to the measure directory itself
+  for (openstudio::filesystem::directory_iterator it(dir), end; it != end; ++it) {
+    EXPECT_FALSE(BCLMeasure::isIgnoredFileName(toString(it->path().filename()))) << toString(it->path());
+  }
+
+  // Change the content of measure.rb, a new modification time means a new checksum
+  std::string content;
+  {
+    openstudio::filesystem::ifstream ifs(measurePath, std::ios_base::binary);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    content = ss.str();
+  }
+  ASSERT_FALSE(content.empty());
+  content.back() = (content.back() == '\n') ? ' ' : '\n';
+  {
+    openstudio::filesystem::ofstream ofs(measurePath, std::ios_base::binary | std::ios_base::trunc);
+    ofs << content;
+  }
+  openstudio::filesystem::last_write_time(measurePath, before + 10);
+  EXPECT_TRUE(measure->checkForUpdatesFiles());
+  EXPECT_FALSE(measure->checkForUpdatesFiles());
+
+  // A corrupt cache is ignored
+  {
+    openstudio::filesystem::ofstream ofs(cacheFiles().front(), std::ios_base::trunc);
+    ofs << "{ not json";
+  }
+  EXPECT_FALSE(measure->checkForUpdatesFiles());
+
+  // Cleanup
+  if (previousCacheHome != nullptr) {
+    setenv("XDG_CACHE_HOME", previousCacheHomeValue.c_str(), 1);
+  } else {
+    unsetenv("XDG_CACHE_HOME");
+  }
+  openstudio::filesystem::remove_all(cacheHome);
+  measure.reset();
+  ASSERT_TRUE(removeDirectory(dir));
+  ASSERT_FALSE(exists(dir));
+}
+
 TEST_F(BCLFixture, BCLMeasure_CTor) {
 
   openstudio::path dir = openstudio::filesystem::system_complete(getApplicationBuildDirectory() / toPath("Testing/TestMeasure/"));
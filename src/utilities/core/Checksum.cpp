@@ -28,60 +28,135 @@
 ***********************************************************************************************************************/
 
 #include "Checksum.hpp"
-
-#include <sstream>
+#include "Filesystem.hpp"
 
 #include <boost/crc.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <fmt/format.h>
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
 namespace openstudio {
 
 namespace detail {
 
-  bool checksumIgnore(char c) {
-    // ignore all whitespace
-    //bool result = (c == ' ' || c == '\t' || c == '\n' ||  c == '\v' || c == '\f' || c == '\r');
+  // CRC-32 with the same parameters as boost::crc_32_type (reflected polynomial 0x04C11DB7, initial value and final xor 0xFFFFFFFF),
+  // computed with the slice-by-8 tables: eight bytes per step instead of one
+  struct Crc32Tables
+  {
+    constexpr Crc32Tables() : table() {
+      for (std::uint32_t i = 0; i < 256; ++i) {
+        std::uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+          crc = (crc >> 1) ^ ((crc & 1U) != 0 ? 0xEDB88320U : 0U);
+        }
+        table[0][i] = crc;
+      }
+      for (std::size_t slice = 1; slice < 8; ++slice) {
+        for (std::size_t i = 0; i < 256; ++i) {
+          table[slice][i] = (table[slice - 1][i] >> 8) ^ table[0][table[slice - 1][i] & 0xFFU];
+        }
+      }
+    }
+
+    std::array<std::array<std::uint32_t, 256>, 8> table;
+  };
 
-    // ignore just line feed
-    bool result = (c == '\r');
+  static constexpr Crc32Tables crc32Tables{};
 
-    return result;
+  inline std::uint32_t load32(const unsigned char* p) {
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) | (static_cast<std::uint32_t>(p[2]) << 16)
+           | (static_cast<std::uint32_t>(p[3]) << 24);
   }
+
+  /// Running checksum of a byte stream from which all '\r' are dropped
+  class ChecksumCrc32
+  {
+   public:
+    void process(const char* data, std::size_t size) {
+      // memchr is vectorized by the C library, so the carriage returns are skipped a run at a time
+      while (size != 0) {
+        const auto* cr = static_cast<const char*>(std::memchr(data, '\r', size));
+        if (cr == nullptr) {
+          processBytes(reinterpret_cast<const unsigned char*>(data), size);
+          return;
+        }
+        const auto run = static_cast<std::size_t>(cr - data);
+        processBytes(reinterpret_cast<const unsigned char*>(data), run);
+        data = cr + 1;
+        size -= run + 1;
+      }
+    }
+
+    std::string hexDigest() const {
+      return fmt::format("{:0>8X}", m_crc ^ 0xFFFFFFFFU);
+    }
+
+   private:
+    void processBytes(const unsigned char* p, std::size_t size) {
+      const auto& t = crc32Tables.table;
+      std::uint32_t crc = m_crc;
+      for (; size >= 8; size -= 8, p += 8) {
+        const std::uint32_t one = load32(p) ^ crc;
+        const std::uint32_t two = load32(p + 4);
+        crc = t[7][one & 0xFFU] ^ t[6][(one >> 8) & 0xFFU] ^ t[5][(one >> 16) & 0xFFU] ^ t[4][one >> 24] ^ t[3][two & 0xFFU]
+              ^ t[2][(two >> 8) & 0xFFU] ^ t[1][(two >> 16) & 0xFFU] ^ t[0][two >> 24];
+      }
+      for (; size != 0; --size, ++p) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFFU];
+      }
+      m_crc = crc;
+    }
+
+    std::uint32_t m_crc = 0xFFFFFFFFU;
+  };
+
+  // Files at least this large are memory mapped rather than read
+  constexpr std::uintmax_t checksumMapThreshold = 1 << 20;
+
 }  // namespace detail
 
 /// return 8 character hex checksum of string
 std::string checksum(std::string s) {
-  s.erase(std::remove_if(s.begin(), s.end(), openstudio::detail::checksumIgnore), s.end());
-  boost::crc_32_type crc;
-  crc.process_bytes(s.data(), s.length());
-  return fmt::format("{:0>8X}", crc.checksum());
+  detail::ChecksumCrc32 crc;
+  crc.process(s.data(), s.size());
+  return crc.hexDigest();
 }
 
 /// return 8 character hex checksum of istream
 std::string checksum(std::istream& is) {
-  boost::crc_32_type crc;
+  detail::ChecksumCrc32 crc;
+  std::vector<char> buffer(1 << 18);
   do {
-    const std::streamsize n = 1024;
-    char buffer[n];
-    is.read(buffer, n);
-    std::streamsize readSize = is.gcount();
-    //crc.process_bytes(buffer, readSize);
-
-    auto stringSize = static_cast<size_t>(readSize);
-    std::string str(buffer, stringSize);
-    str.erase(std::remove_if(str.begin(), str.end(), openstudio::detail::checksumIgnore), str.end());
-    stringSize = str.size();
-
-    crc.process_bytes(str.c_str(), stringSize);
+    is.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    crc.process(buffer.data(), static_cast<std::size_t>(is.gcount()));
   } while (is);
 
-  return fmt::format("{:0>8X}", crc.checksum());
+  return crc.hexDigest();
 }
 
 /// return 8 character hex checksum of file contents
 std::string checksum(const path& p) {
   std::string result = "00000000";
   try {
+    boost::system::error_code ec;
+    if (openstudio::filesystem::is_regular_file(p, ec)) {
+      const std::uintmax_t size = openstudio::filesystem::file_size(p, ec);
+      if (!ec && size >= detail::checksumMapThreshold) {
+        try {
+          boost::iostreams::mapped_file_source file(p);
+          detail::ChecksumCrc32 crc;
+          crc.process(file.data(), file.size());
+          return crc.hexDigest();
+        } catch (...) {
+          // could not map the file, read it instead
+        }
+      }
+    }
+
     openstudio::filesystem::ifstream ifs(p, std::ios_base::binary);
     if (ifs) {
       result = checksum(ifs);
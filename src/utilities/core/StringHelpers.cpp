@@ -33,7 +33,13 @@
 
 #include <boost/algorithm/string/replace.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <clocale>
 #include <cmath>
+#include <cstdlib>
 #include <iomanip>
 
 namespace openstudio {
@@ -471,6 +477,44 @@ namespace string_conversions {
     return number_formatter(value, format, precision);
   }
 
+  const char* parseDouble(const char* first, const char* last, double& value) {
+    // std::strtod needs a null terminated string, so copy the characters that can be part of a number (numbers are short)
+    const char* tokenEnd = first;
+    while ((tokenEnd != last)
+           && ((std::isalnum(static_cast<unsigned char>(*tokenEnd)) != 0) || (*tokenEnd == '+') || (*tokenEnd == '-') || (*tokenEnd == '.'))) {
+      ++tokenEnd;
+    }
+    const auto size = static_cast<std::size_t>(tokenEnd - first);
+    if (size == 0) {
+      return nullptr;
+    }
+
+    std::array<char, 64> smallBuffer;
+    std::string largeBuffer;
+    char* buffer = smallBuffer.data();
+    if (size >= smallBuffer.size()) {
+      largeBuffer.resize(size + 1);
+      buffer = largeBuffer.data();
+    }
+    std::copy(first, tokenEnd, buffer);
+    buffer[size] = '\0';
+
+    // std::strtod reads the decimal separator of the C locale (LC_NUMERIC), which is '.' unless the host application changed it
+    const char decimalPoint = *std::localeconv()->decimal_point;
+    if (decimalPoint != '.') {
+      std::replace(buffer, buffer + size, '.', decimalPoint);
+    }
+
+    char* end = nullptr;
+    errno = 0;
+    const double result = std::strtod(buffer, &end);
+    if ((end == buffer) || ((errno == ERANGE) && (std::abs(result) == HUGE_VAL))) {
+      return nullptr;
+    }
+    value = result;
+    return first + (end - buffer);
+  }
+
 }  // namespace string_conversions
 
 }  // namespace openstudio
@@ -154,6 +154,11 @@ namespace string_conversions {
   UTILITIES_API std::string number(std::uint64_t, int base = 10);
   UTILITIES_API std::string number(double, FloatFormat format = FloatFormat::general, int precision = 6);
 
+  /** Parses the floating point number that starts at first, without reading past last, like std::from_chars (which is not available for
+     *  doubles on all of the standard libraries we support). '.' is always the decimal separator, whatever the C locale. Unlike
+     *  std::from_chars a leading '+' is accepted. Returns one past the end of the number, or nullptr if there is none or it overflows */
+  UTILITIES_API const char* parseDouble(const char* first, const char* last, double& value);
+
   template <typename DesiredType, typename InputType>
   boost::optional<DesiredType> to_no_throw(const InputType& inp) {
     std::stringstream ss;
@@ -31,10 +31,20 @@
 #include "String.hpp"
 #include "StaticInitializer.hpp"
 
-#include <sstream>
-
-#include <boost/uuid/uuid_io.hpp>
-#include <boost/uuid/uuid_generators.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <thread>
+
+#ifndef _WIN32
+#  include <pthread.h>
+#endif
+
+#include <boost/uuid/nil_generator.hpp>
+#include <boost/uuid/string_generator.hpp>
 #include <boost/thread/tss.hpp>
 
 namespace openstudio {
@@ -56,18 +66,111 @@ namespace detail {
 
 }  // namespace detail
 
+namespace {
+
+  // Incremented in the child process of every fork(), which inherits the engine states of its parent
+  std::atomic<unsigned> forkGeneration{0};
+
+#ifndef _WIN32
+  void onForkChild() {
+    forkGeneration.fetch_add(1, std::memory_order_relaxed);
+  }
+#endif
+
+  // xoshiro256** seeded once per thread, and again in the child of a fork() so that parent and child do not
+  // generate the same sequence. Version 4 UUIDs need 122 bits that will not repeat, not bits that cannot be
+  // predicted, so this replaces boost::uuids::random_generator, which asks the OS for entropy on every call.
+  class UUIDRandomEngine
+  {
+   public:
+    UUIDRandomEngine() {
+#ifndef _WIN32
+      static const int atForkRegistered = pthread_atfork(nullptr, nullptr, &onForkChild);
+      (void)atForkRegistered;
+#endif
+      seed();
+    }
+
+    std::uint64_t operator()() {
+      if (m_forkGeneration != forkGeneration.load(std::memory_order_relaxed)) {
+        seed();
+      }
+      const std::uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+      const std::uint64_t t = m_state[1] << 17;
+      m_state[2] ^= m_state[0];
+      m_state[3] ^= m_state[1];
+      m_state[1] ^= m_state[2];
+      m_state[0] ^= m_state[3];
+      m_state[2] ^= t;
+      m_state[3] = rotl(m_state[3], 45);
+      return result;
+    }
+
+   private:
+    void seed() {
+      m_forkGeneration = forkGeneration.load(std::memory_order_relaxed);
+      std::random_device device;
+      std::uint64_t mix = (static_cast<std::uint64_t>(device()) << 32) ^ device();
+      // random_device may be deterministic on some platforms, so also mix in the time and thread
+      mix ^= static_cast<std::uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+      mix ^= static_cast<std::uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) << 1;
+      for (std::uint64_t& word : m_state) {
+        word = splitMix64(mix) ^ ((static_cast<std::uint64_t>(device()) << 32) ^ device());
+      }
+      if ((m_state[0] | m_state[1] | m_state[2] | m_state[3]) == 0) {
+        m_state[0] = 1;
+      }
+    }
+
+    static std::uint64_t rotl(std::uint64_t x, int k) {
+      return (x << k) | (x >> (64 - k));
+    }
+
+    static std::uint64_t splitMix64(std::uint64_t& x) {
+      std::uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      return z ^ (z >> 31);
+    }
+
+    std::array<std::uint64_t, 4> m_state;
+    unsigned m_forkGeneration = 0;
+  };
+
+  // Writes the 36 lowercase characters of uuid's canonical form, the same as boost::uuids::operator<<.
+  void writeUUID(const boost::uuids::uuid& uuid, char* out) {
+    static constexpr char hexDigits[] = "0123456789abcdef";
+    unsigned i = 0;
+    for (const std::uint8_t byte : uuid) {
+      if (i == 4 || i == 6 || i == 8 || i == 10) {
+        *out++ = '-';
+      }
+      *out++ = hexDigits[byte >> 4];
+      *out++ = hexDigits[byte & 0x0F];
+      ++i;
+    }
+  }
+
+}  // namespace
+
 UUID::UUID() : boost::uuids::uuid(boost::uuids::nil_uuid()) {}
 
 UUID::UUID(const boost::uuids::uuid& t_other) : boost::uuids::uuid(t_other) {}
 
 UUID UUID::random_generate() {
-  static boost::thread_specific_ptr<boost::uuids::random_generator> gen;
+  thread_local UUIDRandomEngine engine;
 
-  if (gen.get() == nullptr) {
-    gen.reset(new boost::uuids::random_generator);
-  }
+  const std::uint64_t first = engine();
+  const std::uint64_t second = engine();
+  boost::uuids::uuid result;
+  std::memcpy(result.begin(), &first, sizeof(first));
+  std::memcpy(result.begin() + sizeof(first), &second, sizeof(second));
+
+  // version 4, RFC 4122 variant
+  result.begin()[6] = static_cast<std::uint8_t>((result.begin()[6] & 0x0F) | 0x40);
+  result.begin()[8] = static_cast<std::uint8_t>((result.begin()[8] & 0x3F) | 0x80);
 
-  return UUID((*gen)());
+  return UUID(result);
 }
 
 UUID UUID::string_generate(const std::string& t_str) {
@@ -115,26 +218,28 @@ bool operator>(const UUID& lhs, const UUID& rhs) {
 }
 
 std::string toString(const UUID& uuid) {
-  std::stringstream ss;
-  ss << '{';
-  boost::uuids::operator<<(ss, uuid);
-  ss << '}';
-  return ss.str();
+  std::string result(38, '{');
+  writeUUID(uuid, &result[1]);
+  result.back() = '}';
+  return result;
 }
 
 std::string createUniqueName(const std::string& prefix) {
-  std::stringstream ss;
-  if (!prefix.empty()) {
-    ss << prefix << " ";
+  if (prefix.empty()) {
+    return toString(createUUID());
   }
-  ss << toString(createUUID());
-  return ss.str();
+  std::string result;
+  result.reserve(prefix.size() + 39);
+  result += prefix;
+  result += ' ';
+  result += toString(createUUID());
+  return result;
 }
 
 std::string removeBraces(const UUID& uuid) {
-  std::stringstream ss;
-  boost::uuids::operator<<(ss, uuid);
-  return ss.str();
+  std::string result(36, '-');
+  writeUUID(uuid, &result[0]);
+  return result;
 }
 
 std::ostream& operator<<(std::ostream& os, const UUID& uuid) {
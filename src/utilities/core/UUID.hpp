@@ -35,6 +35,8 @@
 
 #include <boost/optional.hpp>
 #include <boost/uuid/uuid.hpp>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 #include <ostream>
 #include <string>
@@ -112,6 +114,19 @@ using OptionalUUID = boost::optional<UUID>;
 /// vector of UUID
 using UUIDVector = std::vector<UUID>;
 
+/// hash for unordered containers keyed on UUID, cheaper than boost::hash which hashes the 16 bytes one at a time
+struct UUIDHash
+{
+  std::size_t operator()(const boost::uuids::uuid& uuid) const noexcept {
+    std::uint64_t first;
+    std::uint64_t second;
+    std::memcpy(&first, uuid.begin(), sizeof(first));
+    std::memcpy(&second, uuid.begin() + sizeof(first), sizeof(second));
+    // multiplying by an odd constant keeps UUIDs that only differ in their second half apart
+    return static_cast<std::size_t>(first ^ (second * 0x9E3779B97F4A7C15ULL));
+  }
+};
+
 }  // namespace openstudio
 
 #endif  // UTILITIES_CORE_UUID_HPP
@@ -1,5 +1,9 @@
 #include <benchmark/benchmark.h>
 
+#include "../Checksum.hpp"
+#include "../Filesystem.hpp"
+
+#include <fstream>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -146,6 +150,69 @@ static void BM_CheckSumNewDirect(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+static void BM_CheckSumLibrary(benchmark::State& state) {
+
+  auto testStr = makeTestStr(state.range(0));
+  assert(openstudio::checksum(testStr) == openstudio_old::checksum(testStr));
+
+  for (auto _ : state) {
+    auto s = openstudio::checksum(testStr);
+    benchmark::DoNotOptimize(s);
+  }
+
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_CheckSumStreamOld(benchmark::State& state) {
+
+  auto testStr = makeTestStr(state.range(0));
+
+  for (auto _ : state) {
+    std::stringstream ss(testStr);
+    auto s = openstudio_old::checksum(ss);
+    benchmark::DoNotOptimize(s);
+  }
+
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_CheckSumStreamLibrary(benchmark::State& state) {
+
+  auto testStr = makeTestStr(state.range(0));
+
+  for (auto _ : state) {
+    std::stringstream ss(testStr);
+    auto s = openstudio::checksum(ss);
+    benchmark::DoNotOptimize(s);
+  }
+
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// Files: the small ones are read, the large ones memory mapped
+static void BM_CheckSumPath(benchmark::State& state) {
+
+  const openstudio::path p = openstudio::filesystem::temp_directory_path() / openstudio::toPath("Checksum_Benchmark.txt");
+  {
+    std::ofstream ofs(openstudio::toString(p), std::ios_base::binary | std::ios_base::trunc);
+    ofs << makeTestStr(state.range(0));
+  }
+
+  for (auto _ : state) {
+    auto s = openstudio::checksum(p);
+    benchmark::DoNotOptimize(s);
+  }
+
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  openstudio::filesystem::remove(p);
+}
+
 BENCHMARK(BM_CheckSumOld)->RangeMultiplier(4)->Range(8, 8 << 16)->Complexity();
 BENCHMARK(BM_CheckSumNew)->RangeMultiplier(4)->Range(8, 8 << 16)->Complexity();
 BENCHMARK(BM_CheckSumNewDirect)->RangeMultiplier(4)->Range(8, 8 << 16)->Complexity();
+BENCHMARK(BM_CheckSumLibrary)->RangeMultiplier(4)->Range(8, 8 << 16)->Complexity();
+
+BENCHMARK(BM_CheckSumStreamOld)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(BM_CheckSumStreamLibrary)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(BM_CheckSumPath)->RangeMultiplier(16)->Range(1 << 10, 1 << 28)->Unit(benchmark::kMillisecond);
@@ -32,9 +32,17 @@
 #include "../Checksum.hpp"
 #include "../UUID.hpp"
 #include "../Containers.hpp"
+#include "../Filesystem.hpp"
 
 #include <resources.hxx>
 
+#include <boost/crc.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
 TEST(Checksum, Strings) {
   EXPECT_EQ("00000000", openstudio::checksum(std::string("")));
 
@@ -97,6 +105,32 @@ TEST(Checksum, Paths) {
   EXPECT_EQ("00000000", openstudio::checksum(p));
 }
 
+TEST(Checksum, LargeInputs) {
+  // larger than the stream buffer and the memory mapping threshold, with '\r' in all positions relative to the 8 byte blocks
+  std::string s(3 * (1 << 20) + 13, 'a');
+  for (size_t i = 0; i < s.size(); ++i) {
+    s[i] = (i % 13 == 0) ? '\r' : static_cast<char>('a' + (i * 7) % 26);
+  }
+  std::string stripped = s;
+  stripped.erase(std::remove(stripped.begin(), stripped.end(), '\r'), stripped.end());
+
+  boost::crc_32_type crc;
+  crc.process_bytes(stripped.data(), stripped.size());
+  const std::string expected = fmt::format("{:0>8X}", crc.checksum());
+  EXPECT_EQ(expected, openstudio::checksum(s));
+
+  std::stringstream ss(s);
+  EXPECT_EQ(expected, openstudio::checksum(ss));
+
+  openstudio::path p = openstudio::filesystem::temp_directory_path() / openstudio::toPath("Checksum_LargeInputs.txt");
+  {
+    std::ofstream ofs(openstudio::toString(p), std::ios_base::binary | std::ios_base::trunc);
+    ofs << s;
+  }
+  EXPECT_EQ(expected, openstudio::checksum(p));
+  openstudio::filesystem::remove(p);
+}
+
 TEST(Checksum, UUIDs) {
   openstudio::StringVector checksums;
   for (unsigned i = 0, n = 1000; i < n; ++i) {
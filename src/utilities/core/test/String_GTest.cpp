@@ -434,3 +434,33 @@ TEST(String, replace) {
   std::string replaced = openstudio::replace(input, before, after);
   EXPECT_EQ("def CreateBaselineBuildingCopy blablabla CreateBaselineBuildingCopy", replaced);
 }
+
+TEST(String, ParseDouble) {
+  using openstudio::string_conversions::parseDouble;
+  double value = -1.0;
+
+  const std::string number = "+2.25e3 next";
+  const char* end = parseDouble(number.data(), number.data() + number.size(), value);
+  ASSERT_NE(nullptr, end);
+  EXPECT_DOUBLE_EQ(2250.0, value);
+  EXPECT_EQ(' ', *end);
+
+  // Never reads past last
+  const std::string bounded = "12.5";
+  end = parseDouble(bounded.data(), bounded.data() + 2, value);
+  ASSERT_NE(nullptr, end);
+  EXPECT_DOUBLE_EQ(12.0, value);
+  EXPECT_EQ(bounded.data() + 2, end);
+
+  // Round trips the shortest representation
+  const std::string pi = "3.141592653589793";
+  ASSERT_NE(nullptr, parseDouble(pi.data(), pi.data() + pi.size(), value));
+  EXPECT_EQ(3.141592653589793, value);
+
+  // Like std::from_chars, no leading whitespace, and the value is untouched on failure
+  value = -1.0;
+  for (const std::string invalid : {"", " 1", "abc", "1e999"}) {
+    EXPECT_EQ(nullptr, parseDouble(invalid.data(), invalid.data() + invalid.size(), value)) << "'" << invalid << "'";
+    EXPECT_EQ(-1.0, value);
+  }
+}
@@ -32,8 +32,16 @@
 #include "../UUID.hpp"
 #include "../String.hpp"
 
+#include <boost/uuid/uuid_io.hpp>
+
 #include <iostream>
 #include <set>
+#include <sstream>
+
+#ifndef _WIN32
+#  include <sys/wait.h>
+#  include <unistd.h>
+#endif
 
 using std::cout;
 using openstudio::UUID;
@@ -91,3 +99,65 @@ TEST(UUID, UUID_UID) {
   EXPECT_EQ(uuid, toUUID(uuidStr));
   EXPECT_EQ(uuid, toUUID(uidStr));  // no extra conversion process
 }
+
+TEST(UUID, Version4) {
+  std::set<string> strs;
+  for (unsigned i = 0; i < 1000; ++i) {
+    UUID uuid = createUUID();
+    EXPECT_EQ(boost::uuids::uuid::version_random_number_based, uuid.version());
+    EXPECT_EQ(boost::uuids::uuid::variant_rfc_4122, uuid.variant());
+
+    // written the same way as boost's stream operator, and found by uuidInString
+    string str = toString(uuid);
+    stringstream ss;
+    ss << '{';
+    boost::uuids::operator<<(ss, uuid);
+    ss << '}';
+    EXPECT_EQ(ss.str(), str);
+    EXPECT_TRUE(boost::regex_match(str, openstudio::uuidInString()));
+    strs.insert(str);
+  }
+  EXPECT_EQ(1000u, strs.size());
+
+  EXPECT_EQ("{00000000-0000-0000-0000-000000000000}", toString(UUID()));
+  EXPECT_EQ("00000000-0000-0000-0000-000000000000", removeBraces(UUID()));
+  EXPECT_EQ(0u, openstudio::createUniqueName("Zone").find("Zone {"));
+}
+
+TEST(UUID, Hash) {
+  openstudio::UUIDHash hash;
+  UUID uuid = createUUID();
+  EXPECT_EQ(hash(uuid), hash(toUUID(toString(uuid))));
+
+  // UUIDs differing only in their last byte still hash apart
+  UUID uuid1 = toUUID("{00000000-0000-0000-0000-000000000001}");
+  UUID uuid2 = toUUID("{00000000-0000-0000-0000-000000000002}");
+  EXPECT_NE(hash(uuid1), hash(uuid2));
+}
+
+#ifndef _WIN32
+TEST(UUID, Fork) {
+  // the child of a fork does not generate the same UUIDs as its parent
+  createUUID();
+  int fds[2];
+  ASSERT_EQ(0, pipe(fds));
+  pid_t pid = fork();
+  ASSERT_NE(-1, pid);
+  if (pid == 0) {
+    close(fds[0]);
+    string str = toString(createUUID());
+    ssize_t written = write(fds[1], str.data(), str.size());
+    close(fds[1]);
+    _exit(written == static_cast<ssize_t>(str.size()) ? 0 : 1);
+  }
+  close(fds[1]);
+  string parentStr = toString(createUUID());
+  string childStr(38, '\0');
+  ssize_t numRead = read(fds[0], &childStr[0], childStr.size());
+  close(fds[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  ASSERT_EQ(38, numRead);
+  EXPECT_NE(parentStr, childStr);
+}
+#endif
@@ -36,7 +36,12 @@
 #include "Intersection.hpp"
 #include <utilities/geometry/Transformation.hpp>
 
+#include <boost/functional/hash.hpp>
+
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -103,100 +108,201 @@ size_t Polyhedron::numVertices() const {
   return count;
 }
 
-std::vector<Point3d> Polyhedron::uniqueVertices() const {
+namespace {
+
+  // Tolerance-aware spatial hash used to weld vertices that are isAlmostEqual3dPt.
+  // Cells are tol wide, so any point almost equal to a welded vertex lies in one of the 27 cells surrounding it
+  class VertexWelder
+  {
+   public:
+    explicit VertexWelder(size_t expectedSize, double tol = 0.0127) : m_tol(tol) {
+      m_vertices.reserve(expectedSize);
+      m_cells.reserve(expectedSize);
+    }
+
+    // Returns the index of the first welded vertex that is almost equal to pt, welding pt as a new vertex if there is none.
+    // Picking the lowest index among all the candidates keeps the same result as a linear search in insertion order
+    size_t weld(const Point3d& pt) {
+      const CellKey key = cellKey(pt);
+      size_t result = m_vertices.size();
+      for (std::int64_t i = key.i - 1; i <= key.i + 1; ++i) {
+        for (std::int64_t j = key.j - 1; j <= key.j + 1; ++j) {
+          for (std::int64_t k = key.k - 1; k <= key.k + 1; ++k) {
+            auto it = m_cells.find(CellKey{i, j, k});
+            if (it == m_cells.end()) {
+              continue;
+            }
+            for (const size_t index : it->second) {
+              if ((index < result) && isAlmostEqual3dPt(pt, m_vertices[index], m_tol)) {
+                result = index;
+              }
+            }
+          }
+        }
+      }
+      if (result == m_vertices.size()) {
+        m_vertices.push_back(pt);
+        m_cells[key].push_back(result);
+      }
+      return result;
+    }
+
+    const std::vector<Point3d>& vertices() const {
+      return m_vertices;
+    }
+
+   private:
+    struct CellKey
+    {
+      std::int64_t i;
+      std::int64_t j;
+      std::int64_t k;
+
+      bool operator==(const CellKey& other) const {
+        return (i == other.i) && (j == other.j) && (k == other.k);
+      }
+    };
+
+    struct CellKeyHash
+    {
+      size_t operator()(const CellKey& key) const {
+        size_t seed = 0;
+        boost::hash_combine(seed, key.i);
+        boost::hash_combine(seed, key.j);
+        boost::hash_combine(seed, key.k);
+        return seed;
+      }
+    };
+
+    CellKey cellKey(const Point3d& pt) const {
+      return {static_cast<std::int64_t>(std::floor(pt.x() / m_tol)), static_cast<std::int64_t>(std::floor(pt.y() / m_tol)),
+              static_cast<std::int64_t>(std::floor(pt.z() / m_tol))};
+    }
 
-  std::vector<Point3d> uniqVertices;
-  uniqVertices.reserve(numVertices());
+    double m_tol;
+    std::vector<Point3d> m_vertices;
+    std::unordered_map<CellKey, std::vector<size_t>, CellKeyHash> m_cells;
+  };
 
+  // An undirected edge between two welded vertices, and the half-edges (surface, vertex index) that use it
+  struct HalfEdgeUses
+  {
+    size_t firstSurfNum;
+    size_t firstVertexIndex;
+    std::vector<size_t> surfNums;
+  };
+
+}  // namespace
+
+std::vector<Point3d> Polyhedron::uniqueVertices() const {
+  VertexWelder welder(numVertices());
   for (const auto& surface : m_surfaces) {
     for (const auto& pt : surface.vertices) {
-      if (std::find_if(uniqVertices.cbegin(), uniqVertices.cend(), [&pt](const auto& unqV) { return isAlmostEqual3dPt(pt, unqV); })
-          == uniqVertices.cend()) {
-        uniqVertices.push_back(pt);
-      }
+      welder.weld(pt);
     }
   }
-  return uniqVertices;
+  return welder.vertices();
 }
 
 std::vector<Surface3dEdge> Polyhedron::edgesNotTwoForEnclosedVolumeTest(const Polyhedron& volumePoly) {
 
-  std::vector<Surface3dEdge> uniqueSurface3dEdges;
-  uniqueSurface3dEdges.reserve(volumePoly.numVertices());
-
-  // construct list of unique edges
-  int surfNum = 0;
-  for (const auto& surface : volumePoly.m_surfaces) {
-    LOG(Debug, "Surface: " << surface.name);
-    const auto& vertices = surface.vertices;
-    for (auto it = vertices.begin(); it != vertices.end(); ++it) {
-      auto itnext = std::next(it);
-      if (itnext == std::end(vertices)) {
-        itnext = std::begin(vertices);
-      }
-      Surface3dEdge thisSurface3dEdge(*it, *itnext, surface, surfNum);
-      auto itFound = std::find(uniqueSurface3dEdges.begin(), uniqueSurface3dEdges.end(), thisSurface3dEdge);
-      if (itFound == uniqueSurface3dEdges.end()) {
-        LOG(Debug, "NOT FOUND: " << thisSurface3dEdge);
-        uniqueSurface3dEdges.emplace_back(std::move(thisSurface3dEdge));
-      } else {
-        LOG(Debug, "    FOUND: " << thisSurface3dEdge);
-        itFound->appendSurface(surface);
+  const size_t nVertices = volumePoly.numVertices();
+  VertexWelder welder(nVertices);
+
+  // Each half-edge is keyed by its welded end points, regardless of its direction
+  std::vector<HalfEdgeUses> edges;
+  edges.reserve(nVertices);
+  std::unordered_map<std::pair<size_t, size_t>, size_t, boost::hash<std::pair<size_t, size_t>>> edgeIndices;
+  edgeIndices.reserve(nVertices);
+
+  std::vector<size_t> vertexIds;
+  for (size_t surfNum = 0; surfNum < volumePoly.m_surfaces.size(); ++surfNum) {
+    const auto& vertices = volumePoly.m_surfaces[surfNum].vertices;
+    vertexIds.clear();
+    for (const auto& pt : vertices) {
+      vertexIds.push_back(welder.weld(pt));
+    }
+    for (size_t i = 0; i < vertexIds.size(); ++i) {
+      const size_t a = vertexIds[i];
+      const size_t b = vertexIds[(i + 1) % vertexIds.size()];
+      auto [it, inserted] = edgeIndices.try_emplace(std::make_pair(std::min(a, b), std::max(a, b)), edges.size());
+      if (inserted) {
+        edges.push_back(HalfEdgeUses{surfNum, i, {}});
       }
+      edges[it->second].surfNums.push_back(surfNum);
     }
-    ++surfNum;
   }
 
-  for (auto& edge : uniqueSurface3dEdges) {
-    LOG(Debug, edge);
-  }
   // All edges for an enclosed polyhedron should be shared by two (and only two) sides.
-  // So if the count is not two for all edges, the polyhedron is not enclosed, so erase all that are 2
-  uniqueSurface3dEdges.erase(
-    std::remove_if(uniqueSurface3dEdges.begin(), uniqueSurface3dEdges.end(), [](const auto& edge) { return edge.count() == 2; }),
-    uniqueSurface3dEdges.end());
+  // So only build the Surface3dEdges for the ones that aren't, in the order they were first encountered
+  std::vector<Surface3dEdge> result;
+  for (const auto& edge : edges) {
+    if (edge.surfNums.size() == 2) {
+      continue;
+    }
+    const auto& vertices = volumePoly.m_surfaces[edge.firstSurfNum].vertices;
+    const auto& start = vertices[edge.firstVertexIndex];
+    const auto& end = vertices[(edge.firstVertexIndex + 1) % vertices.size()];
+    Surface3dEdge surface3dEdge(start, end, volumePoly.m_surfaces[edge.firstSurfNum], edge.firstSurfNum);
+    for (auto it = std::next(edge.surfNums.begin()); it != edge.surfNums.end(); ++it) {
+      surface3dEdge.appendSurface(volumePoly.m_surfaces[*it]);
+    }
+    result.emplace_back(std::move(surface3dEdge));
+  }
 
-  return uniqueSurface3dEdges;
+  return result;
 }
 
 Polyhedron Polyhedron::updateZonePolygonsForMissingColinearPoints() const {
   // Make a copy, we don't want to mutate in place
   Polyhedron updZonePoly(*this);
 
+  // Sort the unique vertices by x so each edge only has to look at the ones that fall within its bounding box
   std::vector<Point3d> uniqVertices = uniqueVertices();
+  std::sort(uniqVertices.begin(), uniqVertices.end(), [](const Point3d& lhs, const Point3d& rhs) { return lhs.x() < rhs.x(); });
+
+  constexpr double tol = 0.0127;
+  std::vector<std::pair<double, Point3d>> colinearPoints;
+  std::vector<Point3d> newVertices;
 
   for (auto& surface : updZonePoly.m_surfaces) {
-    // for (int iterationLimiter = 0; iterationLimiter < 20; ++iterationLimiter) {  // could probably be while loop but want to make sure it does not get stuck
-    LOG(Debug, surface.name)
-    bool insertedVertext = true;
-    while (insertedVertext) {
-      insertedVertext = false;
-      auto& vertices = surface.vertices;
-      for (auto it = vertices.begin(); it != vertices.end(); ++it) {
-
-        auto itnext = std::next(it);
-        if (itnext == std::end(vertices)) {
-          itnext = std::begin(vertices);
+    const auto& vertices = surface.vertices;
+    newVertices.clear();
+    newVertices.reserve(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+      const Point3d& start = vertices[i];
+      const Point3d& end = vertices[(i + 1) % vertices.size()];
+      newVertices.push_back(start);
+
+      // A point within tolerance of the segment has to be within its bounding box, grown by the tolerance
+      const double minX = std::min(start.x(), end.x()) - tol;
+      const double maxX = std::max(start.x(), end.x()) + tol;
+      const double minY = std::min(start.y(), end.y()) - tol;
+      const double maxY = std::max(start.y(), end.y()) + tol;
+      const double minZ = std::min(start.z(), end.z()) - tol;
+      const double maxZ = std::max(start.z(), end.z()) + tol;
+
+      colinearPoints.clear();
+      auto it = std::lower_bound(uniqVertices.cbegin(), uniqVertices.cend(), minX, [](const Point3d& pt, double x) { return pt.x() < x; });
+      for (; (it != uniqVertices.cend()) && (it->x() <= maxX); ++it) {
+        const Point3d& testVertex = *it;
+        if ((testVertex.y() < minY) || (testVertex.y() > maxY) || (testVertex.z() < minZ) || (testVertex.z() > maxZ)) {
+          continue;
         }
-
-        // Don't care about surfNum
-        Surface3dEdge thisSurface3dEdge(*it, *itnext, surface, 0);
-
-        // now go through all the vertices and see if they are colinear with start and end vertices
-        for (const auto& testVertex : uniqVertices) {
-          if (thisSurface3dEdge.containsPoint(testVertex)) {
-            LOG(Debug, testVertex << " is on " << thisSurface3dEdge);
-            vertices.insert(itnext, testVertex);
-            insertedVertext = true;
-            break;
-          }
+        if (!isAlmostEqual3dPt(start, testVertex) && !isAlmostEqual3dPt(end, testVertex) && isPointOnLineBetweenPoints(start, end, testVertex)) {
+          colinearPoints.emplace_back(getDistance(start, testVertex), testVertex);
         }
-        // Break out of the surface loop too, and start again at the while
-        if (insertedVertext) {
-          break;
+      }
+
+      // Insert all the points found on this edge at once, ordered from start to end
+      std::sort(colinearPoints.begin(), colinearPoints.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+      for (const auto& [distance, pt] : colinearPoints) {
+        if (!isAlmostEqual3dPt(newVertices.back(), pt)) {
+          newVertices.push_back(pt);
         }
       }
     }
+    surface.vertices.swap(newVertices);
   }
   return updZonePoly;
 }
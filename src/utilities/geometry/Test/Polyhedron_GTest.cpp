@@ -143,3 +143,55 @@ TEST_F(GeometryFixture, Polyhedron_Titled_Roof) {
   EXPECT_DOUBLE_EQ(volume, zonePoly.calcPolyhedronVolume());
   EXPECT_DOUBLE_EQ(volume, zonePoly.calcDivergenceTheoremVolume());
 }
+
+TEST_F(GeometryFixture, Polyhedron_ManyColinearPoints) {
+
+  // A 20x10x3 box, with the south wall split in four. The roof and floor are missing the three intermediate points on their south edge
+  std::vector<Surface3d> surfaces;
+  for (int i = 0; i < 4; ++i) {
+    const double x0 = 5.0 * i;
+    const double x1 = 5.0 * (i + 1);
+    surfaces.emplace_back(std::vector<Point3d>{{x0, +0.0, +3.0}, {x0, +0.0, +0.0}, {x1, +0.0, +0.0}, {x1, +0.0, +3.0}}, "SOUTH-" + std::to_string(i));
+  }
+  surfaces.emplace_back(std::vector<Point3d>{{+20.0, +10.0, +3.0}, {+20.0, +10.0, +0.0}, {+0.0, +10.0, +0.0}, {+0.0, +10.0, +3.0}}, "NORTH");
+  surfaces.emplace_back(std::vector<Point3d>{{+20.0, +0.0, +3.0}, {+20.0, +0.0, +0.0}, {+20.0, +10.0, +0.0}, {+20.0, +10.0, +3.0}}, "EAST");
+  // Vertices within tolerance of the others should be welded to them
+  surfaces.emplace_back(std::vector<Point3d>{{+0.0, +10.005, +3.0}, {+0.0, +10.0, +0.0}, {+0.0, +0.0, +0.0}, {-0.005, +0.0, +3.0}}, "WEST");
+  surfaces.emplace_back(std::vector<Point3d>{{+0.0, +0.0, +0.0}, {+0.0, +10.0, +0.0}, {+20.0, +10.0, +0.0}, {+20.0, +0.0, +0.0}}, "FLOOR");
+  surfaces.emplace_back(std::vector<Point3d>{{+20.0, +0.0, +3.0}, {+20.0, +10.0, +3.0}, {+0.0, +10.0, +3.0}, {+0.0, +0.0, +3.0}}, "ROOF");
+
+  Polyhedron zonePoly(surfaces);
+  EXPECT_EQ(36, zonePoly.numVertices());
+  EXPECT_EQ(14, zonePoly.uniqueVertices().size());
+
+  // The south edges of roof and floor, and the top and bottom edges of each south wall
+  std::vector<Surface3dEdge> edgeNot2orig = Polyhedron::edgesNotTwoForEnclosedVolumeTest(zonePoly);
+  ASSERT_EQ(10, edgeNot2orig.size());
+  for (const auto& edge : edgeNot2orig) {
+    EXPECT_EQ(1, edge.count());
+  }
+  EXPECT_EQ("SOUTH-0", edgeNot2orig.front().allSurfaces().front().name);
+  EXPECT_EQ(0, edgeNot2orig.front().firstSurfNum());
+
+  // All three points are inserted at once, in order along the edge
+  auto updatedZonePoly = zonePoly.updateZonePolygonsForMissingColinearPoints();
+  EXPECT_EQ(42, updatedZonePoly.numVertices());
+  EXPECT_TRUE(Polyhedron::edgesNotTwoForEnclosedVolumeTest(updatedZonePoly).empty());
+
+  auto r = zonePoly.isEnclosedVolume();
+  EXPECT_TRUE(r.isEnclosedVolume);
+  EXPECT_TRUE(r.edgesNot2.empty());
+  EXPECT_NEAR(20.0 * 10.0 * 3.0, zonePoly.calcPolyhedronVolume(), 0.5);
+
+  // Without a roof, the four top edges are only used once, and there is nothing the colinear repair can do about it
+  surfaces.pop_back();
+  Polyhedron openPoly(surfaces);
+  r = openPoly.isEnclosedVolume();
+  EXPECT_FALSE(r.isEnclosedVolume);
+  ASSERT_EQ(7, r.edgesNot2.size());
+  for (const auto& edge : r.edgesNot2) {
+    EXPECT_EQ(1, edge.count());
+    EXPECT_DOUBLE_EQ(3.0, edge.start().z());
+    EXPECT_DOUBLE_EQ(3.0, edge.end().z());
+  }
+}
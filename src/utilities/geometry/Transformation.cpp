@@ -70,7 +70,7 @@ Transformation::Transformation(const Vector& vector) : m_storage(Matrix(4, 4)) {
   m_storage(0, 1) = vector[4];
   m_storage(1, 1) = vector[5];
   m_storage(2, 1) = vector[6];
-  m_storage(2, 1) = vector[7];
+  m_storage(3, 1) = vector[7];
   m_storage(0, 2) = vector[8];
   m_storage(1, 2) = vector[9];
   m_storage(2, 2) = vector[10];
@@ -65,6 +65,7 @@ namespace detail {
     oField = IddField::load("Generic Data Field", "A2; \\field Generic Data Field \n \\type alpha \n \\begin-extensible", m_name);
     OS_ASSERT(oField);
     m_extensibleFields.push_back(*oField);
+    updateNameFieldCache();
   }
 
   // GETTERS
@@ -180,6 +181,7 @@ namespace detail {
         unsigned newMaxFields = m_properties.maxFields.get() + 1;
         m_properties.maxFields = newMaxFields;
       }
+      updateNameFieldCache();
     }
   }
 
@@ -234,22 +236,12 @@ namespace detail {
   }
 
   bool IddObject_Impl::hasNameField() const {
-    if (m_nameFieldCache) {
-      return m_nameFieldCache->first;
-    }
-
-    unsigned index = 0;
-    if (hasHandleField()) {
-      index = 1;
-    }
-    bool result = ((m_fields.size() > index) && (m_fields[index].isNameField()));
-    m_nameFieldCache = std::pair<bool, unsigned>(result, index);
-    return result;
+    return m_nameFieldCache.first;
   }
 
   boost::optional<unsigned> IddObject_Impl::nameFieldIndex() const {
-    if (hasNameField()) {
-      return m_nameFieldCache->second;
+    if (m_nameFieldCache.first) {
+      return m_nameFieldCache.second;
     }
     return boost::none;
   }
@@ -476,6 +468,17 @@ namespace detail {
     if (m_properties.extensible) {
       makeExtensible();
     }
+
+    updateNameFieldCache();
+  }
+
+  void IddObject_Impl::updateNameFieldCache() {
+    unsigned index = 0;
+    if (hasHandleField()) {
+      index = 1;
+    }
+    bool result = ((m_fields.size() > index) && (m_fields[index].isNameField()));
+    m_nameFieldCache = std::pair<bool, unsigned>(result, index);
   }
 
   void IddObject_Impl::makeExtensible() {
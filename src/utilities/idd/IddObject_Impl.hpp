@@ -190,8 +190,9 @@ namespace detail {
     IddFieldVector m_extensibleFields;  // vector of extensible fields, forms single
                                         // extensible field group
     std::vector<unsigned> m_urlIdx;
-    // .first = hasNameField(); .second = nameFieldIndex
-    mutable boost::optional<std::pair<bool, unsigned>> m_nameFieldCache;
+    // .first = hasNameField(); .second = nameFieldIndex. Filled whenever m_fields changes, never lazily, as IddObjects are shared
+    // between threads
+    std::pair<bool, unsigned> m_nameFieldCache{false, 0};
 
     // partial constructor used by load
     IddObject_Impl(const std::string& name, const std::string& group, IddObjectType type);
@@ -199,6 +200,9 @@ namespace detail {
     // parse
     void parse(const std::string& text);
 
+    // compute m_nameFieldCache from m_fields
+    void updateNameFieldCache();
+
     void parseObject(const std::string& text);
     void parseProperty(const std::string& text);
     void parseFields(const std::string& text);
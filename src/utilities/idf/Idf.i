@@ -111,6 +111,9 @@
   %ignore openstudio::WorkspaceObject::idfObject() const;
   %ignore openstudio::Workspace::order() const;
 
+  // Returns implementation pointers, only meant for C++ hot paths
+  %ignore openstudio::Workspace::getObjectImplsByType;
+
   // Ignore the progressBar stuff, which is swig'ed later in UtilitiesPlot. I doubt it's useful, so do not bother with partial classes
   %ignore openstudio::Workspace::connectProgressBar(openstudio::ProgressBar&);
   %ignore openstudio::Workspace::disconnectProgressBar(openstudio::ProgressBar&);
@@ -315,6 +315,7 @@ namespace detail {
   }
 
   void IdfObject_Impl::setComment(const std::string& comment, bool /*checkValidity*/) {
+    beforeChange();
     m_comment = makeComment(comment);
     m_diffs.push_back(IdfObjectDiff(boost::none, boost::none, boost::none));
   }
@@ -328,6 +329,7 @@ namespace detail {
   }
 
   bool IdfObject_Impl::setFieldComment(unsigned index, const std::string& cmnt, bool /*checkValidity*/) {
+    beforeChange();
     if (index < m_fields.size()) {
       if (index >= m_fieldComments.size()) {
         m_fieldComments.resize(index + 1);
@@ -351,6 +353,7 @@ namespace detail {
   }
 
   boost::optional<std::string> IdfObject_Impl::setName(const std::string& _newName, bool /*checkValidity*/) {
+    beforeChange();
     std::string newName = encodeString(_newName);
 
     switch (m_iddObject.type().value()) {
@@ -435,6 +438,7 @@ namespace detail {
   }
 
   bool IdfObject_Impl::setString(unsigned index, const std::string& _value, bool checkValidity) {
+    beforeChange();
     std::string value = encodeString(_value);
 
     if (m_iddObject.hasNameField() && (index == m_iddObject.nameFieldIndex().get())) {
@@ -574,6 +578,7 @@ namespace detail {
   }
 
   bool IdfObject_Impl::pushString(const std::string& value, bool checkValidity) {
+    beforeChange();
     // get new index
     unsigned index = m_fields.size();
     if (m_iddObject.hasNameField() && (index == m_iddObject.nameFieldIndex().get())) {
@@ -598,6 +603,7 @@ namespace detail {
   }
 
   IdfExtensibleGroup IdfObject_Impl::pushExtensibleGroup(const std::vector<std::string>& values, bool checkValidity) {
+    beforeChange();
     unsigned groupSize = m_iddObject.properties().numExtensible;
     unsigned n = numFields();
     IdfObject_ImplPtr p = nullptr;
@@ -675,6 +681,7 @@ namespace detail {
   }
 
   IdfExtensibleGroup IdfObject_Impl::insertExtensibleGroup(unsigned groupIndex, const std::vector<std::string>& values, bool checkValidity) {
+    beforeChange();
     // if really a push request, send it there
     if (groupIndex == numExtensibleGroups()) {
       return pushExtensibleGroup(values, checkValidity);
@@ -788,6 +795,7 @@ namespace detail {
   /** Pops the final extensible group from the object, if possible. Returns the popped data if
    *  successful. Otherwise, the returned vector will be empty. */
   std::vector<std::string> IdfObject_Impl::popExtensibleGroup(bool /*checkValidity*/) {
+    beforeChange();
 
     unsigned groupSize = m_iddObject.properties().numExtensible;
     unsigned numBeforePop = numFields();
@@ -828,6 +836,7 @@ namespace detail {
   }
 
   std::vector<std::string> IdfObject_Impl::eraseExtensibleGroup(unsigned groupIndex, bool checkValidity) {
+    beforeChange();
     StringVector result;
     if (groupIndex >= numExtensibleGroups()) {
       return result;
@@ -886,6 +895,7 @@ namespace detail {
   }
 
   std::vector<std::vector<std::string>> IdfObject_Impl::clearExtensibleGroups(bool checkValidity) {
+    beforeChange();
 
     // data to restore if cannot delete all groups
     std::vector<StringVector> rollbackValues;
@@ -1376,6 +1386,8 @@ namespace detail {
     m_diffs.clear();
   }
 
+  void IdfObject_Impl::beforeChange() {}
+
   // PRIVATE
 
   void IdfObject_Impl::resizeToMinFields() {
@@ -397,6 +397,10 @@ namespace detail {
     // idf differences
     std::vector<IdfObjectDiff> m_diffs;
 
+    /** Called by each setter before it changes anything. Lets WorkspaceObject_Impl save its state
+     *  when its Workspace has a batch of edits open. */
+    virtual void beforeChange();
+
     // GETTER HELPERS
 
     std::vector<std::string> fields() const;
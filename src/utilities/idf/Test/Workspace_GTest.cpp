@@ -70,6 +70,8 @@
 using namespace openstudio;
 
 #include <iostream>
+#include <algorithm>
+#include <set>
 
 TEST_F(IdfFixture, IdfFile_Workspace_DefaultConstructor) {
   Workspace workspaceNone(StrictnessLevel::Minimal);
@@ -290,6 +292,134 @@ TEST_F(IdfFixture, Workspace_FollowingPointers) {
   }
 }
 
+TEST_F(IdfFixture, Workspace_SourcesByType) {
+  Workspace workspace(epIdfFile, StrictnessLevel::Draft);
+
+  // sources() is the union of getSources over sourceIddObjectTypes(), each source listed once and
+  // pointing back at the target from at least one of its fields
+  auto checkSources = [](const Workspace& ws) {
+    for (const WorkspaceObject& target : ws.objects()) {
+      WorkspaceObjectVector sources = target.sources();
+      std::set<Handle> sourceHandles;
+      for (const WorkspaceObject& source : sources) {
+        EXPECT_TRUE(sourceHandles.insert(source.handle()).second);
+        EXPECT_TRUE(ws == source.workspace());
+        EXPECT_FALSE(source.getSourceIndices(target.handle()).empty());
+      }
+
+      std::set<Handle> sourceHandlesByType;
+      for (const IddObjectType& type : target.sourceIddObjectTypes()) {
+        WorkspaceObjectVector sourcesOfType = target.getSources(type);
+        EXPECT_FALSE(sourcesOfType.empty());
+        for (const WorkspaceObject& source : sourcesOfType) {
+          EXPECT_EQ(type, source.iddObject().type());
+          sourceHandlesByType.insert(source.handle());
+        }
+      }
+      EXPECT_EQ(sourceHandles, sourceHandlesByType);
+      EXPECT_LE(sources.size(), target.numSources());
+    }
+  };
+
+  checkSources(workspace);
+  checkSources(workspace.clone());
+  checkSources(workspace.clone(true));
+
+  // Removing the only Lights of a zone drops its Lights group
+  WorkspaceObjectVector lights = workspace.getObjectsByType(IddObjectType::Lights);
+  ASSERT_FALSE(lights.empty());
+  OptionalWorkspaceObject zone = lights[0].getTarget(LightsFields::ZoneorZoneListorSpaceorSpaceListName);
+  ASSERT_TRUE(zone);
+  ASSERT_EQ(1u, zone->getSources(IddObjectType(IddObjectType::Lights)).size());
+  EXPECT_FALSE(lights[0].remove().empty());
+  EXPECT_TRUE(zone->getSources(IddObjectType(IddObjectType::Lights)).empty());
+  std::vector<IddObjectType> types = zone->sourceIddObjectTypes();
+  EXPECT_EQ(types.end(), std::find(types.begin(), types.end(), IddObjectType(IddObjectType::Lights)));
+  checkSources(workspace);
+}
+
+class BatchChangeCounter : public WorkspaceWatcher
+{
+ public:
+  explicit BatchChangeCounter(const Workspace& workspace) : WorkspaceWatcher(workspace) {}
+
+  virtual void onChangeWorkspace() override {
+    ++numChanges;
+  }
+
+  unsigned numChanges = 0;
+};
+
+TEST_F(IdfFixture, Workspace_Batch) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  OptionalWorkspaceObject zone1 = ws.addObject(IdfObject(IddObjectType::Zone));
+  OptionalWorkspaceObject zone2 = ws.addObject(IdfObject(IddObjectType::Zone));
+  OptionalWorkspaceObject lights = ws.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(zone1);
+  ASSERT_TRUE(zone2);
+  ASSERT_TRUE(lights);
+  ASSERT_TRUE(lights->setPointer(LightsFields::ZoneorZoneListorSpaceorSpaceListName, zone1->handle()));
+  ASSERT_TRUE(lights->setString(LightsFields::DesignLevelCalculationMethod, "Watts/Area"));
+  ASSERT_TRUE(lights->setDouble(LightsFields::WattsperZoneFloorArea, 10.0));
+  EXPECT_FALSE(lights->setDouble(LightsFields::WattsperZoneFloorArea, -1.0));
+
+  std::shared_ptr<detail::Workspace_Impl> wsImpl = ws.getImpl<detail::Workspace_Impl>();
+  BatchChangeCounter counter(ws);
+
+  // edits are committed together, with one change signal per edited object
+  EXPECT_FALSE(ws.isBatchOpen());
+  EXPECT_TRUE(ws.startBatch());
+  EXPECT_TRUE(ws.isBatchOpen());
+  EXPECT_FALSE(ws.startBatch());
+  std::size_t changeCount = wsImpl->changeCount();
+  for (int i = 1; i <= 10; ++i) {
+    EXPECT_TRUE(lights->setDouble(LightsFields::WattsperZoneFloorArea, 2.0 * i));
+  }
+  EXPECT_TRUE(lights->setPointer(LightsFields::ZoneorZoneListorSpaceorSpaceListName, zone2->handle()));
+  EXPECT_TRUE(zone1->setName("Batch Zone"));
+  EXPECT_EQ(0u, counter.numChanges);
+  EXPECT_LT(changeCount, wsImpl->changeCount());
+  EXPECT_TRUE(ws.commitBatch());
+  EXPECT_FALSE(ws.isBatchOpen());
+  EXPECT_EQ(2u, counter.numChanges);
+  EXPECT_DOUBLE_EQ(20.0, lights->getDouble(LightsFields::WattsperZoneFloorArea).get());
+  EXPECT_EQ("Batch Zone", zone1->name().get());
+  ASSERT_TRUE(lights->getTarget(LightsFields::ZoneorZoneListorSpaceorSpaceListName));
+  EXPECT_EQ(zone2->handle(), lights->getTarget(LightsFields::ZoneorZoneListorSpaceorSpaceListName)->handle());
+
+  // field data is checked at commit, and a failed commit restores the fields and pointers
+  counter.numChanges = 0;
+  EXPECT_TRUE(ws.startBatch());
+  EXPECT_TRUE(lights->setDouble(LightsFields::WattsperZoneFloorArea, -1.0));
+  EXPECT_TRUE(lights->setPointer(LightsFields::ZoneorZoneListorSpaceorSpaceListName, zone1->handle()));
+  EXPECT_EQ(1u, zone1->getSources(IddObjectType(IddObjectType::Lights)).size());
+  changeCount = wsImpl->changeCount();
+  EXPECT_FALSE(ws.commitBatch());
+  EXPECT_FALSE(ws.isBatchOpen());
+  EXPECT_EQ(0u, counter.numChanges);
+  EXPECT_LT(changeCount, wsImpl->changeCount());
+  EXPECT_DOUBLE_EQ(20.0, lights->getDouble(LightsFields::WattsperZoneFloorArea).get());
+  ASSERT_TRUE(lights->getTarget(LightsFields::ZoneorZoneListorSpaceorSpaceListName));
+  EXPECT_EQ(zone2->handle(), lights->getTarget(LightsFields::ZoneorZoneListorSpaceorSpaceListName)->handle());
+  EXPECT_TRUE(zone1->getSources(IddObjectType(IddObjectType::Lights)).empty());
+  EXPECT_EQ(1u, zone2->getSources(IddObjectType(IddObjectType::Lights)).size());
+
+  // rolling back by hand
+  EXPECT_TRUE(ws.startBatch());
+  EXPECT_TRUE(zone1->setName("Rolled Back Zone"));
+  EXPECT_TRUE(lights->setPointer(LightsFields::ZoneorZoneListorSpaceorSpaceListName, Handle()));
+  ws.rollbackBatch();
+  EXPECT_FALSE(ws.isBatchOpen());
+  EXPECT_EQ(0u, counter.numChanges);
+  EXPECT_EQ("Batch Zone", zone1->name().get());
+  ASSERT_TRUE(lights->getTarget(LightsFields::ZoneorZoneListorSpaceorSpaceListName));
+  EXPECT_EQ(zone2->handle(), lights->getTarget(LightsFields::ZoneorZoneListorSpaceorSpaceListName)->handle());
+
+  // with no batch open, edits signal right away
+  EXPECT_TRUE(lights->setDouble(LightsFields::WattsperZoneFloorArea, 5.0));
+  EXPECT_EQ(1u, counter.numChanges);
+}
+
 // This test mimics the creation of a budget building. In particular, it blindly changes out
 // all lights objects and their schedules.
 //
@@ -472,6 +602,58 @@ TEST_F(IdfFixture, Workspace_RemoveAllZones) {
   EXPECT_EQ(static_cast<size_t>(0), zones.size());
 }
 
+TEST_F(IdfFixture, Workspace_ObjectsByTypeBuckets) {
+  Workspace workspace(epIdfFile, StrictnessLevel::Draft);
+
+  auto zoneHandles = [&workspace]() {
+    std::set<Handle> result;
+    for (const auto& impl : workspace.getObjectImplsByType(IddObjectType::Zone)) {
+      result.insert(impl->handle());
+    }
+    return result;
+  };
+
+  WorkspaceObjectVector zones = workspace.getObjectsByType(IddObjectType::Zone);
+  ASSERT_EQ(6u, zones.size());
+  EXPECT_EQ(6u, workspace.numObjectsOfType(IddObjectType::Zone));
+  EXPECT_EQ(6u, zoneHandles().size());
+
+  // Removing from the middle of the bucket moves the last zone into the freed slot
+  std::set<Handle> expected;
+  for (const auto& zone : zones) {
+    expected.insert(zone.handle());
+  }
+  for (unsigned i : {2u, 0u, 3u}) {
+    expected.erase(zones[i].handle());
+    EXPECT_TRUE(workspace.removeObject(zones[i].handle()));
+    EXPECT_EQ(expected, zoneHandles());
+    EXPECT_EQ(expected.size(), workspace.numObjectsOfType(IddObjectType::Zone));
+    EXPECT_EQ(expected.size(), workspace.getObjectsByType(IddObjectType::Zone).size());
+  }
+
+  // Adding back
+  OptionalWorkspaceObject newZone = workspace.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(newZone);
+  expected.insert(newZone->handle());
+  EXPECT_EQ(expected, zoneHandles());
+
+  std::vector<IddObjectType> types = workspace.iddObjectTypes();
+  EXPECT_NE(types.end(), std::find(types.begin(), types.end(), IddObjectType(IddObjectType::Zone)));
+  EXPECT_EQ(types.end(), std::find(types.begin(), types.end(), IddObjectType(IddObjectType::Version)));
+
+  // Emptied buckets are no longer listed
+  for (const Handle& handle : expected) {
+    EXPECT_TRUE(workspace.removeObject(handle));
+  }
+  EXPECT_TRUE(workspace.getObjectImplsByType(IddObjectType::Zone).empty());
+  types = workspace.iddObjectTypes();
+  EXPECT_EQ(types.end(), std::find(types.begin(), types.end(), IddObjectType(IddObjectType::Zone)));
+
+  // A type that was never added
+  EXPECT_TRUE(workspace.getObjectImplsByType(IddObjectType::OS_Space).empty());
+  EXPECT_EQ(0u, workspace.numObjectsOfType(IddObjectType::OS_Space));
+}
+
 TEST_F(IdfFixture, Workspace_SameNameNotReference) {
   Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
 
@@ -537,6 +719,42 @@ TEST_F(IdfFixture, Workspace_Clone) {
   EXPECT_FALSE(cloneHandles == wsHandles);
 }
 
+TEST_F(IdfFixture, Workspace_CloneLarge) {
+  // enough objects for the copies to be made on several threads
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  std::vector<IdfObject> idfObjects;
+  for (unsigned i = 0; i < 3000; ++i) {
+    IdfObject zone(IddObjectType::Zone);
+    zone.setName("Zone " + std::to_string(i));
+    IdfObject lights(IddObjectType::Lights);
+    lights.setName("Lights " + std::to_string(i));
+    lights.setString(LightsFields::ZoneorZoneListorSpaceorSpaceListName, "Zone " + std::to_string(i));
+    idfObjects.push_back(zone);
+    idfObjects.push_back(lights);
+  }
+  ASSERT_EQ(idfObjects.size(), workspace.addObjects(idfObjects).size());
+
+  for (bool keepHandles : {true, false}) {
+    Workspace clone = workspace.clone(keepHandles);
+    ASSERT_EQ(workspace.numObjects(), clone.numObjects());
+
+    for (IddObjectType type : {IddObjectType(IddObjectType::Zone), IddObjectType(IddObjectType::Lights)}) {
+      WorkspaceObjectVector objects = workspace.getObjectsByType(type);
+      WorkspaceObjectVector cloneObjects = clone.getObjectsByType(type);
+      ASSERT_EQ(objects.size(), cloneObjects.size());
+      for (unsigned i = 0, n = objects.size(); i < n; ++i) {
+        EXPECT_EQ(keepHandles, objects[i].handle() == cloneObjects[i].handle());
+        EXPECT_TRUE(objects[i].dataFieldsEqual(cloneObjects[i]));
+        EXPECT_TRUE(objects[i].objectListFieldsEqual(cloneObjects[i]));
+        EXPECT_EQ(objects[i].numSources(), cloneObjects[i].numSources());
+        for (const WorkspaceObject& target : cloneObjects[i].targets()) {
+          EXPECT_TRUE(clone == target.workspace());
+        }
+      }
+    }
+  }
+}
+
 TEST_F(IdfFixture, Workspace_Insert) {
   Workspace workspace(epIdfFile, StrictnessLevel::Minimal);
   unsigned n = workspace.handles().size();
@@ -42,7 +42,12 @@
 #include "../core/StringHelpers.hpp"
 
 #include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <memory>
+#include <thread>
 
 using namespace std;
 using openstudio::istringEqual;  // used for all name comparisons
@@ -168,9 +173,7 @@ namespace detail {
     m_workspaceObjectOrder = otherImpl->m_workspaceObjectOrder;
     otherImpl->m_workspaceObjectOrder = twoo;
 
-    IddObjectTypeMap tiotm = m_iddObjectTypeMap;
-    m_iddObjectTypeMap = otherImpl->m_iddObjectTypeMap;
-    otherImpl->m_iddObjectTypeMap = tiotm;
+    m_iddObjectTypeBuckets.swap(otherImpl->m_iddObjectTypeBuckets);
 
     IdfReferencesMap tirm = m_idfReferencesMap;
     m_idfReferencesMap = otherImpl->m_idfReferencesMap;
@@ -359,14 +362,39 @@ namespace detail {
   }
 
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByType(IddObjectType objectType) const {
-    auto loc = m_iddObjectTypeMap.find(objectType);
-    if (loc == m_iddObjectTypeMap.end()) {
+    const IddObjectTypeBucket& bucket = getObjectImplsByType(objectType);
+    std::vector<WorkspaceObject> result;
+    result.reserve(bucket.size());
+    for (const auto& objectImplPtr : bucket) {
+      result.push_back(objectImplPtr);
+    }
+    return result;
+  }
+
+  const std::vector<std::shared_ptr<WorkspaceObject_Impl>>& Workspace_Impl::getObjectImplsByType(IddObjectType objectType) const {
+    static const IddObjectTypeBucket emptyBucket;
+    const auto index = static_cast<std::size_t>(objectType.value());
+    if (index >= m_iddObjectTypeBuckets.size()) {
+      return emptyBucket;
+    }
+    return m_iddObjectTypeBuckets[index];
+  }
+
+  std::vector<IddObjectType> Workspace_Impl::iddObjectTypes() const {
+    OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
+    if (!versionIdd) {
       return {};
     }
-    std::vector<WorkspaceObject> result;
-    result.reserve(loc->second.size());
-    for (auto it = loc->second.begin(); it != loc->second.end(); ++it) {
-      result.push_back(it->second);
+
+    std::vector<IddObjectType> result;
+    for (std::size_t index = 0; index < m_iddObjectTypeBuckets.size(); ++index) {
+      if (m_iddObjectTypeBuckets[index].empty()) {
+        continue;
+      }
+      IddObjectType type(static_cast<int>(index));
+      if (type != versionIdd->type()) {
+        result.push_back(type);
+      }
     }
     return result;
   }
@@ -448,6 +476,10 @@ namespace detail {
     return m_fastNaming;
   }
 
+  std::size_t Workspace_Impl::changeCount() const {
+    return m_changeCount;
+  }
+
   // SETTERS
 
   bool Workspace_Impl::setStrictnessLevel(StrictnessLevel level) {
@@ -573,22 +605,48 @@ namespace detail {
     this->progressValue.nano_emit(0);
     this->progressCaption.nano_emit("Cloning Objects");
 
-    // step 1: add objects to maps
+    // step 1: add objects to maps, sized for all of them up front
+    m_workspaceObjectMap.reserve(m_workspaceObjectMap.size() + objectImplPtrs.size());
+    std::vector<std::size_t> numNewObjectsByType;
+    for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+      const auto index = static_cast<std::size_t>(ptr->iddObject().type().value());
+      if (index >= numNewObjectsByType.size()) {
+        numNewObjectsByType.resize(index + 1, 0);
+      }
+      ++numNewObjectsByType[index];
+    }
+    if (numNewObjectsByType.size() > m_iddObjectTypeBuckets.size()) {
+      m_iddObjectTypeBuckets.resize(numNewObjectsByType.size());
+    }
+    for (std::size_t index = 0; index < numNewObjectsByType.size(); ++index) {
+      if (numNewObjectsByType[index] > 0) {
+        m_iddObjectTypeBuckets[index].reserve(m_iddObjectTypeBuckets[index].size() + numNewObjectsByType[index]);
+      }
+    }
     HandleVector newHandles;
+    newHandles.reserve(objectImplPtrs.size());
     for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
       newHandles.push_back(ptr->handle());
       m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(), ptr));
-      insertIntoIddObjectTypeMap(ptr);
+      insertIntoIddObjectTypeBuckets(ptr);
       insertIntoIdfReferencesMap(ptr);
       this->progressValue.nano_emit(++i);
     }
 
     // step 2: apply handle map to pointers
     if (!oldNewHandleMap.empty()) {
+      // every pointer of every object is looked up, so hash the map once
+      HashedHandleMap hashedHandleMap(oldNewHandleMap.size());
+      hashedHandleMap.insert(oldNewHandleMap.begin(), oldNewHandleMap.end());
       for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
-        ptr->initializeOnClone(oldNewHandleMap);
+        ptr->initializeOnClone(hashedHandleMap);
         this->progressValue.nano_emit(++i);
       }
+    } else {
+      // handles are kept, only the reverse pointers' source objects need to be found in this workspace
+      for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+        ptr->relinkReversePointers();
+      }
     }
 
     // step 3: apply handle map to orderer
@@ -1411,6 +1469,7 @@ namespace detail {
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
       registerRemovalOfObject(objectData->objectImplPtr, sources, removedHandles);
+      ++m_changeCount;
       this->onChange.nano_emit();
       return true;
     } else {
@@ -1444,6 +1503,7 @@ namespace detail {
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       registerRemovalOfObjects(objectData, sources, handles);
+      ++m_changeCount;
       this->onChange.nano_emit();
       return true;
     } else {
@@ -1518,6 +1578,60 @@ namespace detail {
     m_fastNaming = fastNaming;
   }
 
+  // BATCH EDITS
+
+  bool Workspace_Impl::startBatch() {
+    if (m_batchOpen) {
+      return false;
+    }
+    m_batchOpen = true;
+    return true;
+  }
+
+  bool Workspace_Impl::commitBatch() {
+    if (!m_batchOpen) {
+      return true;
+    }
+    for (const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr : m_batchObjects) {
+      if (objectImplPtr->initialized() && !objectImplPtr->batchEditsAreValid(m_strictnessLevel)) {
+        LOG(Warn, "Rolling back batch of edits because object " << objectImplPtr->briefDescription() << " is not valid at strictness level "
+                                                                 << m_strictnessLevel.valueName() << ".");
+        rollbackBatch();
+        return false;
+      }
+    }
+    m_batchOpen = false;
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> batchObjects;
+    batchObjects.swap(m_batchObjects);
+    for (const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr : batchObjects) {
+      objectImplPtr->commitBatchEdits();
+    }
+    return true;
+  }
+
+  void Workspace_Impl::rollbackBatch() {
+    m_batchOpen = false;
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> batchObjects;
+    batchObjects.swap(m_batchObjects);
+    for (auto it = batchObjects.rbegin(); it != batchObjects.rend(); ++it) {
+      (*it)->rollBackBatchEdits();
+    }
+    ++m_changeCount;
+  }
+
+  bool Workspace_Impl::isBatchOpen() const {
+    return m_batchOpen;
+  }
+
+  void Workspace_Impl::addToBatch(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    OS_ASSERT(m_batchOpen);
+    m_batchObjects.push_back(objectImplPtr);
+  }
+
+  void Workspace_Impl::holdChangeSignals() {
+    ++m_changeCount;
+  }
+
   // OBJECT ORDER
 
   WorkspaceObjectOrder Workspace_Impl::order() {
@@ -1547,11 +1661,7 @@ namespace detail {
   }
 
   unsigned Workspace_Impl::numObjectsOfType(IddObjectType type) const {
-    auto iotmLoc = m_iddObjectTypeMap.find(type);
-    if (iotmLoc == m_iddObjectTypeMap.end()) {
-      return 0;
-    }
-    return iotmLoc->second.size();
+    return getObjectImplsByType(type).size();
   }
 
   unsigned Workspace_Impl::numObjectsOfType(const IddObject& objectType) const {
@@ -1945,8 +2055,8 @@ namespace detail {
       m_workspaceObjectOrder.push_back(h);
     }
 
-    // IddObjectTypeMap
-    insertIntoIddObjectTypeMap(ptr);
+    // IddObjectTypeBuckets
+    insertIntoIddObjectTypeBuckets(ptr);
 
     // IdfReferencesMap
     insertIntoIdfReferencesMap(ptr);
@@ -1958,8 +2068,28 @@ namespace detail {
     m_workspaceObjectMap[handle] = objectImplPtr;
   }
 
-  void Workspace_Impl::insertIntoIddObjectTypeMap(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
-    m_iddObjectTypeMap[objectImplPtr->iddObject().type()].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
+  void Workspace_Impl::insertIntoIddObjectTypeBuckets(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    const auto index = static_cast<std::size_t>(objectImplPtr->iddObject().type().value());
+    if (index >= m_iddObjectTypeBuckets.size()) {
+      m_iddObjectTypeBuckets.resize(index + 1);
+    }
+    IddObjectTypeBucket& bucket = m_iddObjectTypeBuckets[index];
+    objectImplPtr->m_iddObjectTypeBucketIndex = bucket.size();
+    bucket.push_back(objectImplPtr);
+  }
+
+  void Workspace_Impl::removeFromIddObjectTypeBuckets(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    const auto index = static_cast<std::size_t>(objectImplPtr->iddObject().type().value());
+    OS_ASSERT(index < m_iddObjectTypeBuckets.size());
+    IddObjectTypeBucket& bucket = m_iddObjectTypeBuckets[index];
+    const std::size_t position = objectImplPtr->m_iddObjectTypeBucketIndex;
+    OS_ASSERT((position < bucket.size()) && (bucket[position] == objectImplPtr));
+    // swap-remove: move the last object of the bucket into the freed slot
+    if (position + 1 != bucket.size()) {
+      bucket[position] = std::move(bucket.back());
+      bucket[position]->m_iddObjectTypeBucketIndex = position;
+    }
+    bucket.pop_back();
   }
 
   void Workspace_Impl::insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
@@ -2159,16 +2289,8 @@ namespace detail {
       }
     }
 
-    // IddObjectTypeMap
-    auto iotmLoc = m_iddObjectTypeMap.find(objectImplPtr->iddObject().type());
-    OS_ASSERT(iotmLoc != m_iddObjectTypeMap.end());
-    auto loc = iotmLoc->second.find(handle);
-    OS_ASSERT(loc != iotmLoc->second.end());
-    iotmLoc->second.erase(loc);
-    // erase entry if set is empty
-    if (iotmLoc->second.empty()) {
-      m_iddObjectTypeMap.erase(iotmLoc);
-    }
+    // IddObjectTypeBuckets
+    removeFromIddObjectTypeBuckets(objectImplPtr);
 
     // WorkspaceObjectOrder
     if (m_workspaceObjectOrder.isDirectOrder()) {
@@ -2216,6 +2338,7 @@ namespace detail {
     auto sh_ptr = object.getImpl<WorkspaceObject_Impl>();
     this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
     this->addWorkspaceObjectPtr.nano_emit(sh_ptr, object.iddObject().type(), object.handle());
+    ++m_changeCount;
     this->onChange.nano_emit();
   }
 
@@ -2228,8 +2351,8 @@ namespace detail {
       m_workspaceObjectOrder.insert(savedObject.handle, *(savedObject.orderIndex));
     }
 
-    // IddObjectTypeMap
-    insertIntoIddObjectTypeMap(savedObject.objectImplPtr);
+    // IddObjectTypeBuckets
+    insertIntoIddObjectTypeBuckets(savedObject.objectImplPtr);
 
     // IdfReferencesMap
     insertIntoIdfReferencesMap(savedObject.objectImplPtr);
@@ -2349,24 +2472,83 @@ namespace detail {
   }
 
   void Workspace_Impl::change() {
+    ++m_changeCount;
     this->onChange.nano_emit();
   }
 
   void Workspace_Impl::createAndAddClonedObjects(const std::shared_ptr<detail::Workspace_Impl>& /*thisImpl*/,
                                                  std::shared_ptr<detail::Workspace_Impl> cloneImpl, bool keepHandles) const {
-    detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs;
+    // bucket by bucket, so each of the clone's buckets lists its objects in the same order as here
+    detail::WorkspaceObject_ImplPtrVector originalObjectImplPtrs;
+    originalObjectImplPtrs.reserve(m_workspaceObjectMap.size());
+    for (const IddObjectTypeBucket& bucket : m_iddObjectTypeBuckets) {
+      originalObjectImplPtrs.insert(originalObjectImplPtrs.end(), bucket.begin(), bucket.end());
+    }
+    OS_ASSERT(originalObjectImplPtrs.size() == m_workspaceObjectMap.size());
+
+    detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs = createClonedObjectImpls(*cloneImpl, originalObjectImplPtrs, keepHandles);
+
     HandleMap oldNewHandleMap;
-    for (const WorkspaceObject& object : allObjects()) {
-      newObjectImplPtrs.push_back(cloneImpl->createObject(object.getImpl<detail::WorkspaceObject_Impl>(), keepHandles));
-      Handle h = newObjectImplPtrs.back()->handle();
-      if (!keepHandles) {
-        oldNewHandleMap.insert(HandleMap::value_type(object.handle(), h));
+    if (!keepHandles) {
+      // sorted input lets the map be built in linear time
+      std::vector<std::pair<Handle, Handle>> oldNewHandles;
+      oldNewHandles.reserve(newObjectImplPtrs.size());
+      for (std::size_t i = 0, n = newObjectImplPtrs.size(); i < n; ++i) {
+        oldNewHandles.emplace_back(originalObjectImplPtrs[i]->handle(), newObjectImplPtrs[i]->handle());
       }
+      std::sort(oldNewHandles.begin(), oldNewHandles.end(),
+                [](const std::pair<Handle, Handle>& lhs, const std::pair<Handle, Handle>& rhs) { return lhs.first < rhs.first; });
+      oldNewHandleMap = HandleMap(oldNewHandles.begin(), oldNewHandles.end());
     }
+
     // add Object_ImplPtrs to clone's Workspace_Impl
     cloneImpl->addClones(newObjectImplPtrs, oldNewHandleMap, true);
   }
 
+  std::vector<std::shared_ptr<WorkspaceObject_Impl>>
+    Workspace_Impl::createClonedObjectImpls(Workspace_Impl& cloneImpl, const std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs,
+                                            bool keepHandles) {
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> result(objectImplPtrs.size());
+
+    // Copies only read the original and write their own slot of result, so chunks of them can run on
+    // separate threads. Small workspaces are not worth starting threads for.
+    const std::size_t chunkSize = 1024;
+    const std::size_t numChunks = (objectImplPtrs.size() + chunkSize - 1) / chunkSize;
+    std::atomic<std::size_t> nextChunk{0};
+    std::exception_ptr error;
+    std::atomic<bool> failed{false};
+    auto worker = [&]() {
+      for (std::size_t chunk = nextChunk++; (chunk < numChunks) && !failed; chunk = nextChunk++) {
+        try {
+          const std::size_t end = std::min(objectImplPtrs.size(), (chunk + 1) * chunkSize);
+          for (std::size_t i = chunk * chunkSize; i < end; ++i) {
+            result[i] = cloneImpl.createObject(objectImplPtrs[i], keepHandles);
+          }
+        } catch (...) {
+          if (!failed.exchange(true)) {
+            error = std::current_exception();
+          }
+        }
+      }
+    };
+
+    const std::size_t numThreads = std::min<std::size_t>(numChunks / 2, std::thread::hardware_concurrency());
+    std::vector<std::thread> threads;
+    for (std::size_t t = 1; t < numThreads; ++t) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    if (error) {
+      std::rethrow_exception(error);
+    }
+
+    return result;
+  }
+
   void Workspace_Impl::createAndAddSubsetClonedObjects(const std::shared_ptr<detail::Workspace_Impl>& thisImpl,
                                                        std::shared_ptr<detail::Workspace_Impl> cloneImpl, const std::vector<Handle>& handles,
                                                        bool keepHandles) const {
@@ -2523,6 +2705,14 @@ std::vector<WorkspaceObject> Workspace::getObjectsByType(IddObjectType objectTyp
   return m_impl->getObjectsByType(objectType);
 }
 
+std::vector<IddObjectType> Workspace::iddObjectTypes() const {
+  return m_impl->iddObjectTypes();
+}
+
+const std::vector<std::shared_ptr<detail::WorkspaceObject_Impl>>& Workspace::getObjectImplsByType(IddObjectType objectType) const {
+  return m_impl->getObjectImplsByType(objectType);
+}
+
 std::vector<WorkspaceObject> Workspace::getObjectsByType(const IddObject& objectType) const {
   return m_impl->getObjectsByType(objectType);
 }
@@ -2612,6 +2802,22 @@ void Workspace::setFastNaming(bool fastNaming) {
   m_impl->setFastNaming(fastNaming);
 }
 
+bool Workspace::startBatch() {
+  return m_impl->startBatch();
+}
+
+bool Workspace::commitBatch() {
+  return m_impl->commitBatch();
+}
+
+void Workspace::rollbackBatch() {
+  m_impl->rollbackBatch();
+}
+
+bool Workspace::isBatchOpen() const {
+  return m_impl->isBatchOpen();
+}
+
 // ORDER
 
 WorkspaceObjectOrder Workspace::order() {
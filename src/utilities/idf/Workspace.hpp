@@ -205,6 +205,15 @@ class UTILITIES_API Workspace
   /** Returns all objects with .iddObject() == objectType. */
   std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
+  /** Returns the IddObjectTypes that have at least one object in this Workspace, excluding the version
+   *  object type as objects() does. Together with getObjectsByType, this visits objects() one type at a time. */
+  std::vector<IddObjectType> iddObjectTypes() const;
+
+  /** Returns the implementation objects of all objects of type objectType, in no particular order. This is a
+   *  view on the Workspace's own storage, so nothing is copied, but it is invalidated by adding or removing
+   *  objects. Prefer getObjectsByType unless this is on a hot path. */
+  const std::vector<std::shared_ptr<detail::WorkspaceObject_Impl>>& getObjectImplsByType(IddObjectType objectType) const;
+
   /** Returns the first object found of type objectType and named name (case insensitive,
    *  exact match). */
   boost::optional<WorkspaceObject> getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const;
@@ -340,6 +349,28 @@ class UTILITIES_API Workspace
    *  handle. */
   void setFastNaming(bool fastNaming);
 
+  //@}
+  /** @name Batch Edits */
+  //@{
+
+  /** Opens a batch of edits, and returns false if one is already open. While the batch is open,
+   *  setters skip the checks on field data, the Workspace's change count still moves with each
+   *  edit, and change signals are held. Checks on names and pointers are not deferred. */
+  bool startBatch();
+
+  /** Checks the fields edited in the open batch at strictnessLevel() and closes it. On success,
+   *  each edited object emits its change signals once, with one diff per changed field. On failure,
+   *  the batch is rolled back and false is returned. */
+  bool commitBatch();
+
+  /** Closes the open batch, restoring the fields and pointers each edited object had before the
+   *  batch. Objects added or removed during the batch are not part of it, so they are not removed
+   *  or re-added, and pointers to removed objects stay null. No change signals are emitted. */
+  void rollbackBatch();
+
+  /** Returns true if a batch of edits is open. */
+  bool isBatchOpen() const;
+
   //@}
   /** @name Object Order */
   //@{
@@ -70,8 +70,18 @@ namespace detail {
     : IdfObject_Impl(other, keepHandle),
       m_initialized(false),
       m_workspace(workspace),
-      m_sourceData(other.m_sourceData),
-      m_targetData(other.m_targetData) {}
+      m_sourceData(other.m_sourceData) {
+    if (other.m_targetData) {
+      // other's sources live in other's workspace, so only keep their handles until relinkReversePointers
+      m_targetData = TargetData();
+      for (const auto& [sourceType, reversePointers] : other.m_targetData->reversePointersBySourceType) {
+        ReversePointerSet& copiedPointers = m_targetData->reversePointersBySourceType[sourceType];
+        for (const ReversePointer& rp : reversePointers) {
+          copiedPointers.insert(copiedPointers.end(), ReversePointer(rp.sourceHandle, rp.fieldIndex));
+        }
+      }
+    }
+  }
 
   std::vector<IdfObject> WorkspaceObject_Impl::remove() {
     std::vector<IdfObject> result;
@@ -129,38 +139,45 @@ namespace detail {
     }
   }
 
-  void WorkspaceObject_Impl::initializeOnClone(const HandleMap& oldNewHandleMap) {
+  void WorkspaceObject_Impl::initializeOnClone(const HashedHandleMap& oldNewHandleMap) {
     OS_ASSERT(m_workspace);
+    auto applyHandleMap = [&oldNewHandleMap](const Handle& original) {
+      auto it = oldNewHandleMap.find(original);
+      return (it == oldNewHandleMap.end()) ? Handle() : it->second;
+    };
     if (m_sourceData) {
       SourceData::pointer_set mappedPointers;
       for (const ForwardPointer& fp : m_sourceData->pointers) {
-        Handle th = openstudio::applyHandleMap(fp.targetHandle, oldNewHandleMap);
+        Handle th = applyHandleMap(fp.targetHandle);
         if (th.isNull() && !fp.targetHandle.isNull() && !oldNewHandleMap.empty()) {
           // if cloned object is also in this workspace, and fp.targetHandle not in
           // the map, may be in the workspace
           OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
           if (target) {
             // need to set reverse pointer
-            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(), fp.fieldIndex);
+            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this, fp.fieldIndex);
             th = fp.targetHandle;
           }
         }
-        mappedPointers.insert(ForwardPointer(fp.fieldIndex, th));
+        mappedPointers.insert(mappedPointers.end(), ForwardPointer(fp.fieldIndex, th));
         if (!th.isNull()) {
           m_workspace->forwardReferences(m_handle, fp.fieldIndex, th);
         }
       }
-      m_sourceData->pointers = mappedPointers;
+      m_sourceData->pointers.swap(mappedPointers);
     }
     if (m_targetData) {
-      TargetData::pointer_set mappedPointers;
-      for (const ReversePointer& rp : m_targetData->reversePointers) {
-        Handle sh = openstudio::applyHandleMap(rp.sourceHandle, oldNewHandleMap);
-        if (!sh.isNull()) {
-          mappedPointers.insert(ReversePointer(sh, rp.fieldIndex));
+      TargetData mappedData;
+      for (const auto& [sourceType, reversePointers] : m_targetData->reversePointersBySourceType) {
+        for (const ReversePointer& rp : reversePointers) {
+          Handle sh = applyHandleMap(rp.sourceHandle);
+          if (!sh.isNull()) {
+            mappedData.reversePointersBySourceType[sourceType].insert(ReversePointer(sh, rp.fieldIndex));
+          }
         }
       }
-      m_targetData->reversePointers = mappedPointers;
+      m_targetData = std::move(mappedData);
+      relinkReversePointers();
     }
   }
 
@@ -296,14 +313,9 @@ namespace detail {
       return result;
     }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        result.push_back(*owo);
+      for (const auto& [sourceType, reversePointers] : m_targetData->reversePointersBySourceType) {
+        appendSources(reversePointers, result);
       }
-      std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -314,16 +326,23 @@ namespace detail {
       return result;
     }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        if (owo->iddObject().type() == type) {
-          result.push_back(*owo);
-        }
+      auto it = m_targetData->reversePointersBySourceType.find(type.value());
+      if (it != m_targetData->reversePointersBySourceType.end()) {
+        appendSources(it->second, result);
+      }
+    }
+    return result;
+  }
+
+  std::vector<IddObjectType> WorkspaceObject_Impl::sourceIddObjectTypes() const {
+    std::vector<IddObjectType> result;
+    if (!initialized()) {
+      return result;
+    }
+    if (m_targetData) {
+      for (const auto& [sourceType, reversePointers] : m_targetData->reversePointersBySourceType) {
+        result.push_back(IddObjectType(sourceType));
       }
-      std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -334,7 +353,9 @@ namespace detail {
       return result;
     }
     if (m_targetData) {
-      result = m_targetData->reversePointers;
+      for (const auto& [sourceType, reversePointers] : m_targetData->reversePointersBySourceType) {
+        result.insert(reversePointers.begin(), reversePointers.end());
+      }
     }
     return result;
   }
@@ -451,7 +472,8 @@ namespace detail {
       if (!result) {
         return false;
       }
-      if (checkValidity && level > StrictnessLevel::None) {
+      // inside a batch, data checks wait for Workspace_Impl::commitBatch
+      if (checkValidity && level > StrictnessLevel::None && !m_batchSnapshot) {
         if (!fieldDataIsValid(index, level).empty()) {
           // rollback
           IdfObject_Impl::setString(index, *oldValue, false);
@@ -479,7 +501,7 @@ namespace detail {
         result = !pushExtensibleGroup(StringVector(), false).empty();
       }
       result = IdfObject_Impl::setString(index, value, false);
-      if (checkValidity) {
+      if (checkValidity && !m_batchSnapshot) {
         result = result && isValid(m_workspace->strictnessLevel());
       }
       if (!result) {
@@ -724,10 +746,13 @@ namespace detail {
     if (m_handle.isNull()) {
       return 0u;
     }
+    unsigned result = 0;
     if (m_targetData) {
-      return m_targetData->reversePointers.size();
+      for (const auto& [sourceType, reversePointers] : m_targetData->reversePointersBySourceType) {
+        result += reversePointers.size();
+      }
     }
-    return 0;
+    return result;
   }
 
   bool WorkspaceObject_Impl::isSource() const {
@@ -952,6 +977,12 @@ namespace detail {
       return;
     }
 
+    if (m_batchSnapshot) {
+      // keep the diffs, signals are emitted once by commitBatchEdits
+      m_workspace->holdChangeSignals();
+      return;
+    }
+
     bool nameChange = false;
     bool dataChange = false;
 
@@ -1020,11 +1051,12 @@ namespace detail {
   // Post-condition: field index is a pointer with a null targetHandle.
   void WorkspaceObject_Impl::nullifyPointer(unsigned index) {
     OS_ASSERT(!m_handle.isNull());
+    beforeChange();
     // reverse pointer
     OptionalWorkspaceObject oTarget = getTarget(index);
     if (oTarget) {
       WorkspaceObject target = *oTarget;
-      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(m_handle, index);
+      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(*this, index);
       // remove forwarded reference if no other source sets the same
       m_workspace->removeForwardedReferences(handle(), index, target);
     }
@@ -1038,31 +1070,132 @@ namespace detail {
     OS_ASSERT(insertResult.second);
   }
 
-  // Pre-condition:  Object sourceHandle points to this object from field index.
+  // Pre-condition:  Object source points to this object from field index.
   // Post-condition: That information is removed from this object's m_targetData (in preparation for
   //                 a change to the source pointer).
-  void WorkspaceObject_Impl::nullifyReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::nullifyReversePointer(const WorkspaceObject_Impl& source, unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     OS_ASSERT(m_targetData);
-    auto it = m_targetData->reversePointers.find(ReversePointer(sourceHandle, index));
-    OS_ASSERT(it != m_targetData->reversePointers.end());
-    m_targetData->reversePointers.erase(it);
+    auto groupIt = m_targetData->reversePointersBySourceType.find(source.iddObject().type().value());
+    OS_ASSERT(groupIt != m_targetData->reversePointersBySourceType.end());
+    auto it = groupIt->second.find(ReversePointer(source.handle(), index));
+    OS_ASSERT(it != groupIt->second.end());
+    groupIt->second.erase(it);
+    if (groupIt->second.empty()) {
+      m_targetData->reversePointersBySourceType.erase(groupIt);
+    }
   }
 
-  // Pre-condition:  ReversePointer(sourceHandle,index) is not in m_targetData.
-  // Post-condition: m_targetData indicates that object sourceHandle points to this object from
+  // Pre-condition:  ReversePointer(source.handle(),index) is not in m_targetData.
+  // Post-condition: m_targetData indicates that object source points to this object from
   //                 field index.
-  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::setReversePointer(WorkspaceObject_Impl& source, unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     if (!m_targetData) {
       m_targetData = TargetData();
     }
     // automatically maintains uniqueness
     std::pair<TargetData::pointer_set::iterator, bool> insertResult;
-    insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle, index));
+    insertResult =
+      m_targetData->reversePointersBySourceType[source.iddObject().type().value()].insert(ReversePointer(source.handle(), index, &source));
     OS_ASSERT(insertResult.second);
   }
 
+  void WorkspaceObject_Impl::relinkReversePointers() {
+    OS_ASSERT(m_workspace);
+    if (!m_targetData) {
+      return;
+    }
+    for (auto& [sourceType, reversePointers] : m_targetData->reversePointersBySourceType) {
+      ReversePointerSet relinkedPointers;
+      for (const ReversePointer& rp : reversePointers) {
+        WorkspaceObject_Impl* source = nullptr;
+        if (OptionalWorkspaceObject owo = m_workspace->getObject(rp.sourceHandle)) {
+          source = owo->getImpl<WorkspaceObject_Impl>().get();
+        }
+        relinkedPointers.insert(relinkedPointers.end(), ReversePointer(rp.sourceHandle, rp.fieldIndex, source));
+      }
+      reversePointers.swap(relinkedPointers);
+    }
+  }
+
+  void WorkspaceObject_Impl::beforeChange() {
+    if (m_batchSnapshot || !m_workspace || !m_workspace->isBatchOpen() || !initialized()) {
+      return;
+    }
+    m_batchSnapshot = std::make_unique<BatchSnapshot>();
+    m_batchSnapshot->comment = m_comment;
+    m_batchSnapshot->fields = m_fields;
+    m_batchSnapshot->fieldComments = m_fieldComments;
+    if (m_sourceData) {
+      m_batchSnapshot->pointers.assign(m_sourceData->pointers.begin(), m_sourceData->pointers.end());
+    }
+    m_workspace->addToBatch(std::static_pointer_cast<WorkspaceObject_Impl>(shared_from_this()));
+  }
+
+  bool WorkspaceObject_Impl::batchEditsAreValid(StrictnessLevel level) const {
+    OS_ASSERT(m_batchSnapshot);
+    if (level == StrictnessLevel::None) {
+      return true;
+    }
+    if (m_fields.size() != m_batchSnapshot->fields.size()) {
+      return isValid(level);
+    }
+    for (unsigned i = 0, n = m_fields.size(); i < n; ++i) {
+      if ((m_fields[i] != m_batchSnapshot->fields[i]) && !fieldDataIsValid(i, level).empty()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void WorkspaceObject_Impl::commitBatchEdits() {
+    m_batchSnapshot.reset();
+    if (!initialized()) {
+      m_diffs.clear();
+      return;
+    }
+    coalesceDiffs();
+    emitChangeSignals();
+  }
+
+  void WorkspaceObject_Impl::rollBackBatchEdits() {
+    std::unique_ptr<BatchSnapshot> snapshot;
+    snapshot.swap(m_batchSnapshot);
+    OS_ASSERT(snapshot);
+    m_diffs.clear();
+    if (!initialized()) {
+      return;
+    }
+
+    // unhook the current targets, then point back at the saved ones that are still around
+    if (m_sourceData) {
+      UnsignedVector linkedIndices;
+      for (const ForwardPointer& ptr : m_sourceData->pointers) {
+        if (!ptr.targetHandle.isNull()) {
+          linkedIndices.push_back(ptr.fieldIndex);
+        }
+      }
+      for (const unsigned index : linkedIndices) {
+        nullifyPointer(index);
+      }
+      m_sourceData->pointers.clear();
+      for (const ForwardPointer& ptr : snapshot->pointers) {
+        m_sourceData->pointers.insert(m_sourceData->pointers.end(), ForwardPointer(ptr.fieldIndex, Handle()));
+      }
+    }
+
+    m_comment = snapshot->comment;
+    m_fields = snapshot->fields;
+    m_fieldComments = snapshot->fieldComments;
+
+    for (const ForwardPointer& ptr : snapshot->pointers) {
+      if (!ptr.targetHandle.isNull() && m_workspace->isMember(ptr.targetHandle)) {
+        setPointerImpl(ptr.fieldIndex, ptr.targetHandle);
+      }
+    }
+  }
+
   void WorkspaceObject_Impl::restorePointers() {
     OS_ASSERT(!m_handle.isNull());
     if (m_sourceData) {
@@ -1073,14 +1206,14 @@ namespace detail {
             WorkspaceObjectVector sources = target->getSources(iddObject().type());
             HandleVector h = getHandles<WorkspaceObject>(sources);
             if (std::find(h.begin(), h.end(), m_handle) == h.end()) {
-              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle, ptr.fieldIndex);
+              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this, ptr.fieldIndex);
             }
           }
         }
       }
     }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
+      for (const ReversePointer& ptr : getReversePointers()) {
         OptionalWorkspaceObject source = m_workspace->getObject(ptr.sourceHandle);
         if (source) {
           OptionalWorkspaceObject oTarget = source->getTarget(ptr.fieldIndex);
@@ -1104,6 +1237,7 @@ namespace detail {
   // Post-condition: Field index points to object targetHandle.
   Handle WorkspaceObject_Impl::setPointerImpl(unsigned index, const Handle& targetHandle) {
     OS_ASSERT(!m_handle.isNull());
+    beforeChange();
     Handle result;
     // check current status
     auto fpIt = getIteratorAtFieldIndex<SourceData>(m_sourceData->pointers, index);
@@ -1131,7 +1265,7 @@ namespace detail {
     if (!targetHandle.isNull()) {
       OptionalWorkspaceObject target = m_workspace->getObject(targetHandle);
       OS_ASSERT(target);
-      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle, index);
+      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this, index);
       // forward references if is object-list and defines references simultaneously
       m_workspace->forwardReferences(m_handle, index, targetHandle);
     }
@@ -1195,6 +1329,7 @@ namespace detail {
     if (m_handle.isNull()) {
       return false;
     }
+    beforeChange();
 
     unsigned index = numFields() - 1;
     // last field must be nonextensible, and final size must satisfy minimum number of fields
@@ -1224,8 +1359,63 @@ namespace detail {
     return true;
   }
 
+  void WorkspaceObject_Impl::coalesceDiffs() {
+    std::vector<IdfObjectDiff> objectLevelDiffs;
+    std::map<unsigned, std::vector<IdfObjectDiff>> fieldDiffs;
+    for (const IdfObjectDiff& diff : m_diffs) {
+      if (boost::optional<unsigned> index = diff.index()) {
+        fieldDiffs[*index].push_back(diff);
+      } else if (objectLevelDiffs.empty()) {
+        objectLevelDiffs.push_back(diff);
+      }
+    }
+
+    std::vector<IdfObjectDiff> result = objectLevelDiffs;
+    for (const auto& [index, diffs] : fieldDiffs) {
+      const IdfObjectDiff& first = diffs.front();
+      const IdfObjectDiff& last = diffs.back();
+      boost::optional<UUID> oldHandle;
+      boost::optional<UUID> newHandle;
+      bool isPointerDiff = false;
+      for (const IdfObjectDiff& diff : diffs) {
+        if (boost::optional<WorkspaceObjectDiff> workspaceObjectDiff = diff.optionalCast<WorkspaceObjectDiff>()) {
+          if (!isPointerDiff) {
+            oldHandle = workspaceObjectDiff->oldHandle();
+          }
+          newHandle = workspaceObjectDiff->newHandle();
+          isPointerDiff = true;
+        }
+      }
+      if (isPointerDiff) {
+        result.push_back(WorkspaceObjectDiff(index, first.oldValue(), last.newValue(), oldHandle, newHandle));
+      } else {
+        result.push_back(IdfObjectDiff(index, first.oldValue(), last.newValue()));
+      }
+    }
+    m_diffs.swap(result);
+  }
+
   // QUERY HELPERS
 
+  void WorkspaceObject_Impl::appendSources(const ReversePointerSet& reversePointers, std::vector<WorkspaceObject>& result) const {
+    const Handle* previousSourceHandle = nullptr;
+    for (const ReversePointer& ptr : reversePointers) {
+      OS_ASSERT(!ptr.sourceHandle.isNull());
+      // ordered by source handle first, so pointers from different fields of one source are adjacent
+      if (previousSourceHandle && (*previousSourceHandle == ptr.sourceHandle)) {
+        continue;
+      }
+      previousSourceHandle = &ptr.sourceHandle;
+      if (ptr.source) {
+        result.push_back(WorkspaceObject(std::static_pointer_cast<WorkspaceObject_Impl>(ptr.source->shared_from_this())));
+      } else {
+        OptionalWorkspaceObject owo = m_workspace->getObject(ptr.sourceHandle);
+        OS_ASSERT(owo);
+        result.push_back(*owo);
+      }
+    }
+  }
+
   void WorkspaceObject_Impl::populateValidityReport(ValidityReport& report, bool checkNames) const {
     // StrictnessLevel::Minimal
     if (report.level() > StrictnessLevel::None) {
@@ -1356,6 +1546,10 @@ std::vector<WorkspaceObject> WorkspaceObject::getSources(IddObjectType objectTyp
   return getImpl<WorkspaceObject_Impl>()->getSources(objectType);
 }
 
+std::vector<IddObjectType> WorkspaceObject::sourceIddObjectTypes() const {
+  return getImpl<WorkspaceObject_Impl>()->sourceIddObjectTypes();
+}
+
 // SETTERS
 
 bool WorkspaceObject::setPointer(unsigned index, const Handle& targetHandle) {
@@ -90,6 +90,10 @@ class UTILITIES_API WorkspaceObject : public IdfObject
   /** Returns all objects of type that point to this object, filtering for duplicate objects. */
   std::vector<WorkspaceObject> getSources(IddObjectType type) const;
 
+  /** Returns the IddObjectTypes of the objects that point to this object. Together with getSources,
+   *  this visits sources() one type at a time. */
+  std::vector<IddObjectType> sourceIddObjectTypes() const;
+
   /** Like getString except for reference fields getString will return the
    *  name of the referenced object. This method, getField, will always return the string value
    *  of the field.
@@ -36,6 +36,11 @@
 #include <utilities/idf/IdfObject_Impl.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
 
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+
 namespace openstudio {
 
 // forward declarations
@@ -44,7 +49,11 @@ class Workspace;
 
 namespace detail {
 
-  class Workspace_Impl;  // forward declaration
+  class Workspace_Impl;         // forward declaration
+  class WorkspaceObject_Impl;  // forward declaration
+
+  /// Hashed version of HandleMap, for remapping the pointers of many cloned objects.
+  using HashedHandleMap = std::unordered_map<Handle, Handle, UUIDHash>;
 
   struct UTILITIES_API ForwardPointer
   {
@@ -73,9 +82,12 @@ namespace detail {
   {
     Handle sourceHandle;
     unsigned fieldIndex;
+    /// Direct pointer to the source object, or nullptr if it has not been located in the target's
+    /// workspace yet (as in a copy made for another workspace). Not part of the ordering.
+    WorkspaceObject_Impl* source;
 
-    ReversePointer() : fieldIndex(0) {}
-    ReversePointer(const Handle& h, unsigned i) : sourceHandle(h), fieldIndex(i) {}
+    ReversePointer() : fieldIndex(0), source(nullptr) {}
+    ReversePointer(const Handle& h, unsigned i, WorkspaceObject_Impl* s = nullptr) : sourceHandle(h), fieldIndex(i), source(s) {}
   };
   struct UTILITIES_API ReversePointerLess
   {
@@ -94,20 +106,29 @@ namespace detail {
     using pointer_type = ReversePointer;
     using pointer_set = ReversePointerSet;
 
-    pointer_set reversePointers;
+    /// Reverse pointers grouped by the IddObjectType value of their source objects. Groups are
+    /// never left empty.
+    std::map<int, pointer_set> reversePointersBySourceType;
   };
   using OptionalTargetData = boost::optional<TargetData>;
 
+  // The pointer set is keyed on field index, so these are lookups rather than scans
   template <class T>
   typename T::pointer_set::iterator getIteratorAtFieldIndex(typename T::pointer_set& pointerSet, unsigned fieldIndex) {
-    return std::find_if(pointerSet.begin(), pointerSet.end(),
-                        [fieldIndex](const auto& ptr_type) { return fieldIndexEqualTo<typename T::pointer_type>(ptr_type, fieldIndex); });
+    static_assert(std::is_same<typename T::pointer_set::key_compare, FieldIndexLess<typename T::pointer_type>>::value,
+                  "pointer_set must be ordered by field index");
+    typename T::pointer_type key;
+    key.fieldIndex = fieldIndex;
+    return pointerSet.find(key);
   }
 
   template <class T>
   typename T::pointer_set::const_iterator getConstIteratorAtFieldIndex(const typename T::pointer_set& pointerSet, unsigned fieldIndex) {
-    return std::find_if(pointerSet.begin(), pointerSet.end(),
-                        [fieldIndex](const auto& ptr_type) { return fieldIndexEqualTo<typename T::pointer_type>(ptr_type, fieldIndex); });
+    static_assert(std::is_same<typename T::pointer_set::key_compare, FieldIndexLess<typename T::pointer_type>>::value,
+                  "pointer_set must be ordered by field index");
+    typename T::pointer_type key;
+    key.fieldIndex = fieldIndex;
+    return pointerSet.find(key);
   }
 
   class UTILITIES_API WorkspaceObject_Impl : public IdfObject_Impl
@@ -129,7 +150,7 @@ namespace detail {
     virtual void initializeOnAdd(bool expectToLosePointers = false);
 
     /** Complete copy construction process by updating pointer handles. */
-    virtual void initializeOnClone(const HandleMap& oldNewHandleMap);
+    virtual void initializeOnClone(const HashedHandleMap& oldNewHandleMap);
 
     virtual ~WorkspaceObject_Impl() = default;
 
@@ -170,6 +191,9 @@ namespace detail {
     /** Returns the objects of type that point to this object. */
     std::vector<WorkspaceObject> getSources(IddObjectType type) const;
 
+    /** Returns the IddObjectTypes of the objects that point to this object. */
+    std::vector<IddObjectType> sourceIddObjectTypes() const;
+
     /** Provided for Workspace_Impl to get easy access to targetData. */
     ReversePointerSet getReversePointers() const;
 
@@ -311,9 +335,28 @@ namespace detail {
     /** Mechanics only exposed to Workspace_Impl for use in object removal. */
     void nullifyPointer(unsigned index);
 
-    void nullifyReversePointer(const Handle& sourceHandle, unsigned index);
+    void nullifyReversePointer(const WorkspaceObject_Impl& source, unsigned index);
+
+    void setReversePointer(WorkspaceObject_Impl& source, unsigned index);
+
+    /** Points each reverse pointer at the source object with the same handle in this object's
+     *  workspace. Called once the sources of a cloned object have been added. */
+    void relinkReversePointers();
+
+    /** Saves this object's fields and pointers the first time it is edited while its Workspace has a
+     *  batch open, and adds it to the batch. */
+    virtual void beforeChange() override;
+
+    /** Returns true if every field changed since this object joined the batch is valid at level.
+     *  Those are the checks setString skipped while the batch was open. */
+    bool batchEditsAreValid(StrictnessLevel level) const;
 
-    void setReversePointer(const Handle& sourceHandle, unsigned index);
+    /** Leaves the batch, emitting the change signals held while it was open with one diff per field. */
+    void commitBatchEdits();
+
+    /** Leaves the batch, restoring the fields and pointers saved when this object joined it. No
+     *  signals are emitted. */
+    void rollBackBatchEdits();
 
     /** Called when restoring object because could not remove and retain validity. Double-checks
      *  that companion pointers are in place. May not be able to fix all if multiple objects are
@@ -338,9 +381,20 @@ namespace detail {
    private:
     bool m_initialized;
     Workspace_Impl* m_workspace;
+    std::size_t m_iddObjectTypeBucketIndex = 0;  // position in m_workspace's bucket for this object's IddObjectType
     OptionalSourceData m_sourceData;
     OptionalTargetData m_targetData;
 
+    // state before the first edit made while the workspace had a batch open, null when not in a batch
+    struct BatchSnapshot
+    {
+      std::string comment;
+      std::vector<std::string> fields;
+      std::vector<std::string> fieldComments;
+      std::vector<ForwardPointer> pointers;
+    };
+    std::unique_ptr<BatchSnapshot> m_batchSnapshot;
+
     // SETTER HELPERS
 
     /** Sets pointer at field index to targetHandle, and returns old target. */
@@ -350,8 +404,16 @@ namespace detail {
 
     void restoreOriginalNumFields(unsigned n);
 
+    // QUERY HELPERS
+
+    /** Appends the distinct source objects in reversePointers to result. */
+    void appendSources(const ReversePointerSet& reversePointers, std::vector<WorkspaceObject>& result) const;
+
     bool popField();
 
+    /** Merges m_diffs into one diff per field, from the first old value to the last new value. */
+    void coalesceDiffs();
+
     // configure logging
     REGISTER_LOGGER("utilities.idf.WorkspaceObject");
   };
@@ -40,8 +40,6 @@
 #include <utilities/idd/IddFileAndFactoryWrapper.hpp>
 #include <nano/nano_signal_slot.hpp>  // Signal-Slot replacement
 
-#include <boost/functional/hash.hpp>
-
 #include <utilities/core/Logger.hpp>
 
 #include <string>
@@ -178,6 +176,13 @@ namespace detail {
     /// get all idf objects by full idd type
     std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
+    /// get the types that have at least one object, excluding the version object type
+    std::vector<IddObjectType> iddObjectTypes() const;
+
+    /** Returns the implementation pointers of all objects of type objectType, in no particular order, without
+     *  copying anything. The reference is invalidated by adding or removing objects. */
+    const std::vector<std::shared_ptr<WorkspaceObject_Impl>>& getObjectImplsByType(IddObjectType objectType) const;
+
     /** Returns the first object found of type objectType and named name (case insensitive,
      *  exact match). */
     boost::optional<WorkspaceObject> getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const;
@@ -199,6 +204,10 @@ namespace detail {
     /** Returns true if fast naming is enabled. */
     bool fastNaming() const;
 
+    /** Returns a counter that is incremented each time onChange is emitted. Objects can compare it to a saved
+     *  value to know whether an expensive derived quantity they cached is still valid. */
+    std::size_t changeCount() const;
+
     //@}
     /** @name Setters */
     //@{
@@ -335,6 +344,28 @@ namespace detail {
      *  in other. */
     bool resolvePotentialNameConflicts(Workspace& other);
 
+    //@}
+    /** @name Batch Edits */
+    //@{
+
+    /** Opens a batch of edits. Returns false if one is already open. */
+    bool startBatch();
+
+    /** Closes the open batch. Returns false, and rolls the batch back, if an edited object fails
+     *  the field checks that were deferred. */
+    bool commitBatch();
+
+    /** Closes the open batch, restoring the fields of every object edited in it. */
+    void rollbackBatch();
+
+    bool isBatchOpen() const;
+
+    /** Called by an object on its first edit in the open batch. */
+    void addToBatch(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr);
+
+    /** Called by an object in the open batch in place of emitting its change signals. */
+    void holdChangeSignals();
+
     //@}
     /** @name Object Order */
     //@{
@@ -473,6 +504,10 @@ namespace detail {
     void createAndAddSubsetClonedObjects(const std::shared_ptr<Workspace_Impl>& thisImpl, std::shared_ptr<Workspace_Impl> cloneImpl,
                                          const std::vector<Handle>& handles, bool keepHandles) const;
 
+    // copies of objectImplPtrs made by cloneImpl.createObject, in the same order, on several threads if there are many
+    static std::vector<std::shared_ptr<WorkspaceObject_Impl>>
+      createClonedObjectImpls(Workspace_Impl& cloneImpl, const std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs, bool keepHandles);
+
    private:
     // DATA
 
@@ -480,16 +515,23 @@ namespace detail {
     std::string m_header;                                 // header for the IdfFile
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper;  // IDD file to be used for validity checking
     bool m_fastNaming;
+    std::size_t m_changeCount = 0;
 
-    using WorkspaceObjectMap = std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl>, boost::hash<boost::uuids::uuid>>;
+    // objects edited in the open batch, in the order of their first edit
+    bool m_batchOpen = false;
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> m_batchObjects;
+
+    using WorkspaceObjectMap = std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl>, UUIDHash>;
     WorkspaceObjectMap m_workspaceObjectMap;
 
     // object for ordering objects in the collection.
     WorkspaceObjectOrder m_workspaceObjectOrder;
 
-    // map of IddObjectType to set of objects identified by UUID
-    using IddObjectTypeMap = std::map<IddObjectType, WorkspaceObjectMap>;
-    IddObjectTypeMap m_iddObjectTypeMap;
+    // dense per-type buckets of objects, indexed by IddObjectType::value(). each object keeps its
+    // position in its bucket (WorkspaceObject_Impl::m_iddObjectTypeBucketIndex) so removal is a swap-remove
+    using IddObjectTypeBucket = std::vector<std::shared_ptr<WorkspaceObject_Impl>>;
+    using IddObjectTypeBuckets = std::vector<IddObjectTypeBucket>;
+    IddObjectTypeBuckets m_iddObjectTypeBuckets;
 
     // map of reference to set of objects identified by UUID
     using IdfReferencesMap = std::unordered_map<std::string, WorkspaceObjectMap>;  // , IstringCompare
@@ -532,7 +574,9 @@ namespace detail {
 
     void insertIntoObjectMap(const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& object);
 
-    void insertIntoIddObjectTypeMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
+    void insertIntoIddObjectTypeBuckets(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    void removeFromIddObjectTypeBuckets(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
@@ -13,6 +13,7 @@
 #include "../../idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
+#include <utilities/idd/OS_Space_FieldEnums.hxx>
 
 //#include <iostream>
 
@@ -84,6 +85,107 @@ static void BM_WorkspaceSetNameWithoutAnyChecks(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+// Copies a std::vector<WorkspaceObject> out of the type's bucket
+static void BM_WorkspaceGetObjectsByType(benchmark::State& state) {
+  Workspace w = setUpWorkspaceWithNObjectsOfEveryType(state.range(0));
+
+  for (auto _ : state) {
+    size_t n = 0;
+    for (const auto& obj : w.getObjectsByType(IddObjectType::OS_Space)) {
+      n += obj.numFields();
+    }
+    benchmark::DoNotOptimize(n);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Iterates the type's bucket in place
+static void BM_WorkspaceGetObjectImplsByType(benchmark::State& state) {
+  Workspace w = setUpWorkspaceWithNObjectsOfEveryType(state.range(0));
+
+  for (auto _ : state) {
+    size_t n = 0;
+    for (const auto& impl : w.getObjectImplsByType(IddObjectType::OS_Space)) {
+      n += impl->numFields();
+    }
+    benchmark::DoNotOptimize(n);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Moves every space a few times, each edit checked and signaled on its own
+static void BM_WorkspaceEditsWithoutBatch(benchmark::State& state) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+  std::vector<WorkspaceObject> spaces = w.getObjectsByType(IddObjectType::OS_Space);
+
+  for (auto _ : state) {
+    for (auto& space : spaces) {
+      for (int i = 0; i < 8; ++i) {
+        space.setDouble(OS_SpaceFields::XOrigin, static_cast<double>(i));
+      }
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Same edits in one batch, checked and signaled once per space at commit
+static void BM_WorkspaceEditsInBatch(benchmark::State& state) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+  std::vector<WorkspaceObject> spaces = w.getObjectsByType(IddObjectType::OS_Space);
+
+  for (auto _ : state) {
+    w.startBatch();
+    for (auto& space : spaces) {
+      for (int i = 0; i < 8; ++i) {
+        space.setDouble(OS_SpaceFields::XOrigin, static_cast<double>(i));
+      }
+    }
+    w.commitBatch();
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Every cloned object gets a new handle, and is hashed into the clone's object map
+static void BM_WorkspaceClone(benchmark::State& state) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+
+  for (auto _ : state) {
+    Workspace clone = w.clone();
+    benchmark::DoNotOptimize(clone);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Creates N handles and names, then adds the objects to an empty workspace
+static void addSpaces(benchmark::State& state, bool fastNaming) {
+  for (auto _ : state) {
+    Workspace w(StrictnessLevel::Draft, IddFileType::OpenStudio);
+    w.setFastNaming(fastNaming);
+    std::vector<IdfObject> spaces;
+    spaces.reserve(state.range(0));
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      spaces.emplace_back(IddObjectType::OS_Space);
+    }
+    std::vector<WorkspaceObject> added = w.addObjects(spaces);
+    benchmark::DoNotOptimize(added);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_WorkspaceAddObjects(benchmark::State& state) {
+  addSpaces(state, false);
+}
+
+static void BM_WorkspaceAddObjectsFastNaming(benchmark::State& state) {
+  addSpaces(state, true);
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -94,3 +196,17 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->A
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
 
 BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
+
+BENCHMARK(BM_WorkspaceGetObjectsByType)->RangeMultiplier(8)->Range(2, 32768)->Complexity();
+
+BENCHMARK(BM_WorkspaceGetObjectImplsByType)->RangeMultiplier(8)->Range(2, 32768)->Complexity();
+
+BENCHMARK(BM_WorkspaceEditsWithoutBatch)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
+
+BENCHMARK(BM_WorkspaceEditsInBatch)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
+
+BENCHMARK(BM_WorkspaceClone)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 32768)->Complexity();
+
+BENCHMARK(BM_WorkspaceAddObjects)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 32768)->Complexity();
+
+BENCHMARK(BM_WorkspaceAddObjectsFastNaming)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 32768)->Complexity();
@@ -0,0 +1,80 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2023, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_ILLUMINANCEMAPSERIES_HPP
+#define UTILITIES_SQL_ILLUMINANCEMAPSERIES_HPP
+
+#include "../data/Vector.hpp"
+#include "../data/Matrix.hpp"
+#include "../time/DateTime.hpp"
+
+#include <vector>
+
+namespace openstudio {
+
+/** All the hourly maps of one illuminance map, as returned by SqlFile::illuminanceMaps from a single query.
+ *  The values are stored in one dense [time][y][x] array, so map t is the contiguous block starting at t * x.size() * y.size() */
+struct IlluminanceMapSeries
+{
+  /// HourlyReportIndex of each map, ascending
+  std::vector<int> hourlyReportIndices;
+  /// date and time of each map
+  std::vector<DateTime> dateTimes;
+  /// x positions (m), ascending
+  Vector x;
+  /// y positions (m), ascending
+  Vector y;
+  /// illuminance (lux), the value at x(i), y(j) of map t is illuminance[(t * y.size() + j) * x.size() + i]
+  std::vector<double> illuminance;
+
+  /// number of maps
+  size_t size() const {
+    return hourlyReportIndices.size();
+  }
+
+  /// value (lux) at x(i), y(j) of map t
+  double value(size_t t, unsigned i, unsigned j) const {
+    return illuminance[(t * y.size() + j) * x.size() + i];
+  }
+
+  /// map t as a Matrix, value(i,j) is the illuminance at x(i), y(j), same as SqlFile::illuminanceMap
+  Matrix illuminanceMap(size_t t) const {
+    Matrix result(x.size(), y.size());
+    for (unsigned j = 0; j < y.size(); ++j) {
+      for (unsigned i = 0; i < x.size(); ++i) {
+        result(i, j) = value(t, i, j);
+      }
+    }
+    return result;
+  }
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_SQL_ILLUMINANCEMAPSERIES_HPP
@@ -45,6 +45,14 @@ SqlFile::SqlFile(const openstudio::path& path, const bool createIndexes) {
   }
 }
 
+SqlFile::SqlFile(const openstudio::path& path, const bool createIndexes, const bool readOnly) {
+  try {
+    m_impl = std::shared_ptr<detail::SqlFile_Impl>(new detail::SqlFile_Impl(path, createIndexes, readOnly));
+  } catch (const std::exception& e) {
+    LOG(Error, "Could not create SqlFile for path '" << openstudio::toString(path) << "' error:" << e.what());
+  }
+}
+
 SqlFile::SqlFile(const openstudio::path& t_path, const openstudio::EpwFile& t_epwFile, const openstudio::DateTime& t_simulationTime,
                  const openstudio::Calendar& t_calendar, const bool createIndexes) {
   try {
@@ -74,6 +82,44 @@ bool SqlFile::connectionOpen() const {
   return result;
 }
 
+bool SqlFile::readOnly() const {
+  bool result = false;
+  if (m_impl) {
+    result = m_impl->readOnly();
+  }
+  return result;
+}
+
+bool SqlFile::exportTimeSeriesCache(const openstudio::path& cachePath, const std::vector<std::string>& timeSeriesNames) const {
+  bool result = false;
+  if (m_impl) {
+    result = m_impl->exportTimeSeriesCache(cachePath, timeSeriesNames);
+  }
+  return result;
+}
+
+bool SqlFile::attachTimeSeriesCache(const openstudio::path& cachePath) {
+  bool result = false;
+  if (m_impl) {
+    result = m_impl->attachTimeSeriesCache(cachePath);
+  }
+  return result;
+}
+
+void SqlFile::detachTimeSeriesCache() {
+  if (m_impl) {
+    m_impl->detachTimeSeriesCache();
+  }
+}
+
+bool SqlFile::hasTimeSeriesCache() const {
+  bool result = false;
+  if (m_impl) {
+    result = m_impl->hasTimeSeriesCache();
+  }
+  return result;
+}
+
 openstudio::path SqlFile::path() const {
   openstudio::path result;
   if (m_impl) {
@@ -2204,6 +2250,20 @@ void SqlFile::illuminanceMap(int hourlyReportIndex, std::vector<double>& x, std:
   }
 }
 
+IlluminanceMapSeries SqlFile::illuminanceMaps(int mapIndex) const {
+  if (m_impl) {
+    return m_impl->illuminanceMaps(mapIndex);
+  }
+  return {};
+}
+
+IlluminanceMapSeries SqlFile::illuminanceMaps(const std::string& name) const {
+  if (m_impl) {
+    return m_impl->illuminanceMaps(name);
+  }
+  return {};
+}
+
 // equality test
 bool SqlFile::operator==(const SqlFile& other) const {
   return (m_impl == other.m_impl);
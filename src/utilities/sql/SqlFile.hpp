@@ -33,6 +33,7 @@
 #include "../UtilitiesAPI.hpp"
 
 #include "SummaryData.hpp"
+#include "IlluminanceMapSeries.hpp"
 #include "SqlFileDataDictionary.hpp"
 #include "SqlFileEnums.hpp"
 #include "SqlFile_Impl.hpp"
@@ -79,6 +80,12 @@ class UTILITIES_API SqlFile
   /// Creates indexes by default, pass in false for no new indexes and quicker opening
   explicit SqlFile(const openstudio::path& path, const bool createIndexes = true);
 
+  /// constructor from path, optionally opening the file in read-only mode
+  /// In read-only mode the file is opened as immutable and never modified (safe on a read-only filesystem and with concurrent readers):
+  /// createIndexes then builds an indexed sidecar copy in the temp directory (replacing the one of a previous version of the file, if any),
+  /// and every thread querying this SqlFile uses its own connection
+  SqlFile(const openstudio::path& path, const bool createIndexes, const bool readOnly);
+
   /// initializes a new sql file for output
   /// Creates indexes by default, pass in false for no indexes and quicker creation
   SqlFile(const openstudio::path& t_path, const openstudio::EpwFile& t_epwFile, const openstudio::DateTime& t_simulationTime,
@@ -100,6 +107,25 @@ class UTILITIES_API SqlFile
   /// returns whether or not connection is open
   bool connectionOpen() const;
 
+  /// returns whether the file was opened in read-only mode
+  bool readOnly() const;
+
+  /// Extracts the time series named in timeSeriesNames (all of them if empty) into a compact columnar cache file, in a single pass
+  /// over the data tables. The cache holds one shared time axis and a float64 column per data dictionary item, and is memory mapped
+  /// when attached. A cache saved next to the sql file as '<filename>.tscache' is attached automatically when the file is opened.
+  bool exportTimeSeriesCache(const openstudio::path& cachePath,
+                             const std::vector<std::string>& timeSeriesNames = std::vector<std::string>()) const;
+
+  /// Serves timeSeries queries from a cache created by exportTimeSeriesCache, items that are not in it still query the sql file.
+  /// Returns false if the cache is invalid or was not exported from this very file (same size and modification time)
+  bool attachTimeSeriesCache(const openstudio::path& cachePath);
+
+  /// Stops serving timeSeries queries from the time series cache
+  void detachTimeSeriesCache();
+
+  /// Whether timeSeries queries are served from a time series cache
+  bool hasTimeSeriesCache() const;
+
   /// get the path
   openstudio::path path() const;
 
@@ -1112,6 +1138,14 @@ class UTILITIES_API SqlFile
    *  value(i,j) is the illuminance at x(i), y(j) fills in x,y, illuminance*/
   void illuminanceMap(int hourlyReportIndex, std::vector<double>& x, std::vector<double>& y, std::vector<double>& illuminance) const;
 
+  /** all the hourly maps (lux) of the illuminance map, in one dense [time][y][x] array retrieved with a single query
+   *  rather than one query per hour. Empty if there is no such map */
+  IlluminanceMapSeries illuminanceMaps(int mapIndex) const;
+
+  /** all the hourly maps (lux) of the illuminance map, in one dense [time][y][x] array retrieved with a single query
+   *  rather than one query per hour. Empty if there is no such map */
+  IlluminanceMapSeries illuminanceMaps(const std::string& name) const;
+
   /// Returns the summary data for each installlocation and fuel type found in report variables
   std::vector<SummaryData> getSummaryData() const;
 
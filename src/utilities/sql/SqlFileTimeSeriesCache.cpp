@@ -0,0 +1,234 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2023, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SqlFileTimeSeriesCache.hpp"
+
+#include "../core/Path.hpp"
+#include "../core/UUID.hpp"
+
+#include <boost/interprocess/file_mapping.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <tuple>
+
+namespace openstudio {
+namespace detail {
+
+  namespace {
+
+    constexpr char cacheMagic[8] = {'O', 'S', 'T', 'S', 'C', 'A', 'C', '1'};
+    constexpr std::uint32_t endianMarker = 0x01020304;
+
+    struct FileHeader
+    {
+      char magic[8];
+      std::uint32_t endianMarker;
+      std::uint32_t nTimes;
+      std::uint64_t nColumns;
+      std::uint64_t nRows;
+      std::uint64_t sourceSize;
+      std::int64_t sourceMTime;
+    };
+    static_assert(sizeof(FileHeader) == 48, "FileHeader must not be padded");
+
+    constexpr std::uint64_t paddedTo8(std::uint64_t n) {
+      return (n + 7) & ~std::uint64_t(7);
+    }
+
+    template <typename T>
+    void writeArray(std::ofstream& ofs, const std::vector<T>& v) {
+      ofs.write(reinterpret_cast<const char*>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(T)));
+    }
+
+    void writePadding(std::ofstream& ofs, std::uint64_t writtenBytes) {
+      static constexpr char zeros[8] = {};
+      ofs.write(zeros, static_cast<std::streamsize>(paddedTo8(writtenBytes) - writtenBytes));
+    }
+
+  }  // namespace
+
+  bool SqlFileTimeSeriesCache::write(const openstudio::path& cachePath, std::uint64_t sourceSize, std::int64_t sourceMTime,
+                                     const TimeAxis& timeAxis, std::vector<Column> columns) {
+    const std::size_t nTimes = timeAxis.year.size();
+    if ((timeAxis.month.size() != nTimes) || (timeAxis.day.size() != nTimes) || (timeAxis.interval.size() != nTimes)
+        || (timeAxis.envPeriodIndex.size() != nTimes)) {
+      LOG(Error, "Inconsistent time axis, not writing the time series cache");
+      return false;
+    }
+
+    // Sorted so the columns can be binary searched straight out of the mapping
+    std::sort(columns.begin(), columns.end(), [](const Column& lhs, const Column& rhs) {
+      return std::tie(lhs.recordIndex, lhs.envPeriodIndex) < std::tie(rhs.recordIndex, rhs.envPeriodIndex);
+    });
+
+    std::vector<ColumnEntry> entries;
+    entries.reserve(columns.size());
+    std::uint64_t nRows = 0;
+    for (const auto& column : columns) {
+      entries.push_back(ColumnEntry{column.recordIndex, column.envPeriodIndex, nRows, column.values.size()});
+      nRows += column.values.size();
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+    header.endianMarker = endianMarker;
+    header.nTimes = static_cast<std::uint32_t>(nTimes);
+    header.nColumns = entries.size();
+    header.nRows = nRows;
+    header.sourceSize = sourceSize;
+    header.sourceMTime = sourceMTime;
+
+    // Written under a unique name then renamed, so a concurrent reader never maps a partial file
+    const openstudio::path tmpPath = cachePath.parent_path() / toPath(toString(cachePath.filename()) + "." + removeBraces(createUUID()));
+    {
+      std::ofstream ofs(toString(tmpPath), std::ios_base::binary | std::ios_base::trunc);
+      if (!ofs) {
+        LOG(Error, "Unable to write the time series cache at '" << toString(cachePath) << "'");
+        return false;
+      }
+      ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      for (const auto* v : {&timeAxis.year, &timeAxis.month, &timeAxis.day, &timeAxis.interval, &timeAxis.envPeriodIndex}) {
+        writeArray(ofs, *v);
+      }
+      writePadding(ofs, 5 * sizeof(std::int32_t) * nTimes);
+      writeArray(ofs, entries);
+      for (const auto& column : columns) {
+        writeArray(ofs, column.timePositions);
+      }
+      writePadding(ofs, sizeof(std::uint32_t) * nRows);
+      for (const auto& column : columns) {
+        writeArray(ofs, column.values);
+      }
+      if (!ofs) {
+        LOG(Error, "Failed writing the time series cache at '" << toString(cachePath) << "'");
+        ofs.close();
+        openstudio::filesystem::remove(tmpPath);
+        return false;
+      }
+    }
+
+    try {
+      boost::filesystem::rename(tmpPath, cachePath);
+    } catch (const std::exception& e) {
+      LOG(Error, "Unable to move the time series cache to '" << toString(cachePath) << "': " << e.what());
+      openstudio::filesystem::remove(tmpPath);
+      return false;
+    }
+    return true;
+  }
+
+  std::shared_ptr<const SqlFileTimeSeriesCache> SqlFileTimeSeriesCache::load(const openstudio::path& cachePath, std::uint64_t sourceSize,
+                                                                              std::int64_t sourceMTime) {
+    if (!openstudio::filesystem::is_regular_file(cachePath)) {
+      return nullptr;
+    }
+
+    std::shared_ptr<SqlFileTimeSeriesCache> result(new SqlFileTimeSeriesCache());
+    try {
+      const boost::interprocess::file_mapping mapping(toString(cachePath).c_str(), boost::interprocess::read_only);
+      result->m_region = boost::interprocess::mapped_region(mapping, boost::interprocess::read_only);
+    } catch (const std::exception& e) {
+      LOG(Warn, "Unable to map the time series cache at '" << toString(cachePath) << "': " << e.what());
+      return nullptr;
+    }
+
+    const auto* base = static_cast<const char*>(result->m_region.get_address());
+    const std::uint64_t size = result->m_region.get_size();
+    if (size < sizeof(FileHeader)) {
+      LOG(Warn, "Invalid time series cache at '" << toString(cachePath) << "'");
+      return nullptr;
+    }
+
+    FileHeader header{};
+    std::memcpy(&header, base, sizeof(header));
+    if ((std::memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) != 0) || (header.endianMarker != endianMarker)) {
+      LOG(Warn, "Invalid time series cache at '" << toString(cachePath) << "'");
+      return nullptr;
+    }
+    if ((header.sourceSize != sourceSize) || (header.sourceMTime != sourceMTime)) {
+      LOG(Info, "Time series cache at '" << toString(cachePath) << "' is out of date, ignoring it");
+      return nullptr;
+    }
+
+    const std::uint64_t timeAxisOffset = sizeof(FileHeader);
+    const std::uint64_t columnsOffset = timeAxisOffset + paddedTo8(5 * sizeof(std::int32_t) * header.nTimes);
+    const std::uint64_t timePositionsOffset = columnsOffset + sizeof(ColumnEntry) * header.nColumns;
+    const std::uint64_t valuesOffset = timePositionsOffset + paddedTo8(sizeof(std::uint32_t) * header.nRows);
+    if (size != valuesOffset + sizeof(double) * header.nRows) {
+      LOG(Warn, "Truncated time series cache at '" << toString(cachePath) << "'");
+      return nullptr;
+    }
+
+    const auto* timeAxis = reinterpret_cast<const std::int32_t*>(base + timeAxisOffset);
+    result->m_nTimes = header.nTimes;
+    result->m_nColumns = header.nColumns;
+    result->m_year = timeAxis;
+    result->m_month = timeAxis + header.nTimes;
+    result->m_day = timeAxis + 2 * std::uint64_t(header.nTimes);
+    result->m_interval = timeAxis + 3 * std::uint64_t(header.nTimes);
+    result->m_columns = reinterpret_cast<const ColumnEntry*>(base + columnsOffset);
+    result->m_timePositions = reinterpret_cast<const std::uint32_t*>(base + timePositionsOffset);
+    result->m_values = reinterpret_cast<const double*>(base + valuesOffset);
+
+    // Validate the column directory once, so forEachRow never reads outside the mapping
+    for (std::uint64_t i = 0; i < header.nColumns; ++i) {
+      const ColumnEntry& entry = result->m_columns[i];
+      if ((entry.firstRow > header.nRows) || (entry.nRows > header.nRows - entry.firstRow)) {
+        LOG(Warn, "Corrupt time series cache at '" << toString(cachePath) << "'");
+        return nullptr;
+      }
+    }
+    if (std::any_of(result->m_timePositions, result->m_timePositions + header.nRows, [&header](std::uint32_t t) { return t >= header.nTimes; })) {
+      LOG(Warn, "Corrupt time series cache at '" << toString(cachePath) << "'");
+      return nullptr;
+    }
+
+    return result;
+  }
+
+  std::size_t SqlFileTimeSeriesCache::numColumns() const {
+    return m_nColumns;
+  }
+
+  const SqlFileTimeSeriesCache::ColumnEntry* SqlFileTimeSeriesCache::findColumn(int recordIndex, int envPeriodIndex) const {
+    const ColumnEntry* end = m_columns + m_nColumns;
+    const ColumnEntry* it = std::lower_bound(m_columns, end, std::make_pair(recordIndex, envPeriodIndex),
+                                             [](const ColumnEntry& entry, const std::pair<int, int>& key) {
+                                               return std::tie(entry.recordIndex, entry.envPeriodIndex) < std::tie(key.first, key.second);
+                                             });
+    if ((it == end) || (it->recordIndex != recordIndex) || (it->envPeriodIndex != envPeriodIndex)) {
+      return nullptr;
+    }
+    return it;
+  }
+
+}  // namespace detail
+}  // namespace openstudio
@@ -0,0 +1,133 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2023, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILETIMESERIESCACHE_HPP
+#define UTILITIES_SQL_SQLFILETIMESERIESCACHE_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "../core/Filesystem.hpp"
+#include "../core/Logger.hpp"
+
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** SqlFileTimeSeriesCache is a compact columnar copy of the time series stored in an EnergyPlus SQL file.
+   *
+   *  The file holds a single time axis (one entry per row of the Time table) followed by one column of float64 values per data dictionary
+   *  item (ie per dictionary index and environment period), each value pointing back to its position on the time axis. Everything is
+   *  stored as fixed width native-endian arrays, so the file is memory mapped as is and the values read straight out of the mapping.
+   *
+   *  A cache records the size and modification time of the SQL file it was extracted from, and refuses to load against any other file. */
+  class UTILITIES_API SqlFileTimeSeriesCache
+  {
+   public:
+    /// One entry per row of the Time table, ordered by TimeIndex. year is zero if the SQL file has no Year field
+    struct TimeAxis
+    {
+      std::vector<std::int32_t> year;
+      std::vector<std::int32_t> month;
+      std::vector<std::int32_t> day;
+      std::vector<std::int32_t> interval;
+      std::vector<std::int32_t> envPeriodIndex;
+    };
+
+    /// The values of one data dictionary item, in the order the SQL file returns them
+    struct Column
+    {
+      std::int32_t recordIndex = 0;
+      std::int32_t envPeriodIndex = 0;
+      std::vector<std::uint32_t> timePositions;
+      std::vector<double> values;
+    };
+
+    /// Writes a cache file, returns false on failure
+    static bool write(const openstudio::path& cachePath, std::uint64_t sourceSize, std::int64_t sourceMTime, const TimeAxis& timeAxis,
+                      std::vector<Column> columns);
+
+    /// Memory maps a cache file, returns nullptr if it is missing, invalid, or was not extracted from a file of this size and modification time
+    static std::shared_ptr<const SqlFileTimeSeriesCache> load(const openstudio::path& cachePath, std::uint64_t sourceSize,
+                                                               std::int64_t sourceMTime);
+
+    /// Number of cached data dictionary items
+    std::size_t numColumns() const;
+
+    /// Calls f(value, year, month, day, interval) for each row of the given data dictionary item.
+    /// Returns false, without calling f, if that item is not in the cache
+    template <typename F>
+    bool forEachRow(int recordIndex, int envPeriodIndex, F&& f) const {
+      const ColumnEntry* entry = findColumn(recordIndex, envPeriodIndex);
+      if (entry == nullptr) {
+        return false;
+      }
+      for (std::uint64_t i = entry->firstRow; i < entry->firstRow + entry->nRows; ++i) {
+        const std::uint32_t t = m_timePositions[i];
+        f(m_values[i], m_year[t], m_month[t], m_day[t], m_interval[t]);
+      }
+      return true;
+    }
+
+   private:
+    struct ColumnEntry
+    {
+      std::int32_t recordIndex;
+      std::int32_t envPeriodIndex;
+      std::uint64_t firstRow;
+      std::uint64_t nRows;
+    };
+
+    SqlFileTimeSeriesCache() = default;
+
+    const ColumnEntry* findColumn(int recordIndex, int envPeriodIndex) const;
+
+    boost::interprocess::mapped_region m_region;
+
+    std::uint32_t m_nTimes = 0;
+    std::uint64_t m_nColumns = 0;
+    const std::int32_t* m_year = nullptr;
+    const std::int32_t* m_month = nullptr;
+    const std::int32_t* m_day = nullptr;
+    const std::int32_t* m_interval = nullptr;
+    const ColumnEntry* m_columns = nullptr;
+    const std::uint32_t* m_timePositions = nullptr;
+    const double* m_values = nullptr;
+
+    REGISTER_LOGGER("openstudio.energyplus.SqlFileTimeSeriesCache");
+  };
+
+}  // namespace detail
+}  // namespace openstudio
+
+#endif  // UTILITIES_SQL_SQLFILETIMESERIESCACHE_HPP
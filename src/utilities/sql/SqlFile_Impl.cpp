@@ -38,9 +38,19 @@
 #include "../core/Assert.hpp"
 #include "../core/ASCIIStrings.hpp"
 #include "../core/StringHelpers.hpp"
+#include "../core/FilesystemHelpers.hpp"
+#include "../core/UUID.hpp"
 
 #include <sqlite3.h>
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <string_view>
+#include <unordered_map>
+
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
 using boost::multi_index::ordered_unique;
@@ -60,13 +70,47 @@ namespace detail {
     return {reinterpret_cast<const char*>(column)};
   }
 
-  SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
+  // Indexes on the large tables, created by createIndexes
+  static constexpr std::array<std::string_view, 6> indexStatements{
+    "CREATE INDEX IF NOT EXISTS rddMTR ON ReportDataDictionary (IsMeter);",
+    "CREATE INDEX IF NOT EXISTS redRD ON ReportExtendedData (ReportDataIndex);",
+    "CREATE INDEX IF NOT EXISTS rdTI ON ReportData (TimeIndex ASC);",
+    "CREATE INDEX IF NOT EXISTS rdDI ON ReportData (ReportDataDictionaryIndex ASC);",
+    "CREATE INDEX IF NOT EXISTS dmhdHRI ON DaylightMapHourlyData (HourlyReportIndex ASC);",
+    "CREATE INDEX IF NOT EXISTS dmhrMNI ON DaylightMapHourlyReports (MapNumber);",
+  };
+
+  // Source of SqlFile_Impl::m_openId
+  static std::atomic<std::uint64_t> nextOpenId{1};
+
+  // SQLite URI for an immutable read-only connection: the file is assumed to not change while it's open, so no locking at all is performed,
+  // which is what allows opening it from a read-only filesystem and from many processes at once
+  static std::string immutableUri(const openstudio::path& p) {
+    std::string uri = "file:";
+    std::string genericPath = p.generic_string();
+    if (genericPath.empty() || genericPath.front() != '/') {
+      // Windows drive letter: file:///C:/...
+      uri += "///";
+    }
+    for (const char c : genericPath) {
+      if (c == '%' || c == '?' || c == '#') {
+        uri += fmt::format("%{:02X}", static_cast<unsigned char>(c));
+      } else {
+        uri += c;
+      }
+    }
+    uri += "?immutable=1";
+    return uri;
+  }
+
+  SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes, const bool readOnly)
     : m_path(path),
       m_connectionOpen(false),
       m_supportedVersion(false),
       m_hasYear(true),
       m_hasIlluminanceMapYear(true),
-      m_illuminanceMapHasOnly2RefPts(false) {
+      m_illuminanceMapHasOnly2RefPts(false),
+      m_readOnly(readOnly) {
     if (openstudio::filesystem::exists(m_path)) {
       m_path = openstudio::filesystem::canonical(m_path);
     }
@@ -74,6 +118,13 @@ namespace detail {
     if (createIndexes) {
       this->createIndexes();
     }
+    // Serve time series from a cache exported next to the file, if there is one
+    if (m_connectionOpen) {
+      const openstudio::path cachePath = m_path.parent_path() / toPath(toString(m_path.filename()) + ".tscache");
+      if (openstudio::filesystem::is_regular_file(cachePath)) {
+        attachTimeSeriesCache(cachePath);
+      }
+    }
   }
 
   SqlFile_Impl::SqlFile_Impl(const openstudio::path& t_path, const openstudio::EpwFile& t_epwFile, const openstudio::DateTime& t_simulationTime,
@@ -252,6 +303,10 @@ namespace detail {
   }
 
   void SqlFile_Impl::removeIndexes() {
+    if (m_readOnly) {
+      LOG(Warn, "Cannot remove indexes from a SqlFile opened in read-only mode");
+      return;
+    }
     if (m_connectionOpen) {
       try {
         execAndThrowOnError("DROP INDEX IF EXISTS rddMTR;");
@@ -292,42 +347,109 @@ namespace detail {
   }
 
   void SqlFile_Impl::createIndexes() {
+    if (m_readOnly) {
+      createIndexSidecar();
+      return;
+    }
     if (m_connectionOpen) {
-      try {
-        execAndThrowOnError("CREATE INDEX IF NOT EXISTS rddMTR ON ReportDataDictionary (IsMeter);");
-      } catch (const std::runtime_error& e) {
-        LOG(Trace, "Error adding index: " + std::string(e.what()));
+      for (const auto& stmt : indexStatements) {
+        try {
+          execAndThrowOnError(std::string{stmt});
+        } catch (const std::runtime_error& e) {
+          LOG(Trace, "Error adding index: " + std::string(e.what()));
+        }
       }
+    }
+  }
 
-      try {
-        execAndThrowOnError("CREATE INDEX IF NOT EXISTS redRD ON ReportExtendedData (ReportDataIndex);");
-      } catch (const std::runtime_error& e) {
-        LOG(Trace, "Error adding index: " + std::string(e.what()));
-      }
+  std::string SqlFile_Impl::indexSidecarPrefix() const {
+    return fmt::format("{}-{:016x}-", toString(m_path.stem()), std::hash<std::string>{}(toString(m_path)));
+  }
 
-      try {
-        execAndThrowOnError("CREATE INDEX IF NOT EXISTS rdTI ON ReportData (TimeIndex ASC);");
-      } catch (const std::runtime_error& e) {
-        LOG(Trace, "Error adding index: " + std::string(e.what()));
-      }
+  openstudio::path SqlFile_Impl::indexSidecarPath() const {
+    // Keyed on the location, size and modification time of the original file, so a re-run simulation never picks up a stale sidecar
+    const std::string version =
+      fmt::format("{}|{}", openstudio::filesystem::file_size(m_path), openstudio::filesystem::last_write_time_as_time_t(m_path));
+    return openstudio::filesystem::temp_directory_path() / toPath("openstudio-sql-indexes")
+           / toPath(fmt::format("{}{:016x}.sql", indexSidecarPrefix(), std::hash<std::string>{}(version)));
+  }
 
-      try {
-        execAndThrowOnError("CREATE INDEX IF NOT EXISTS rdDI ON ReportData (ReportDataDictionaryIndex ASC);");
-      } catch (const std::runtime_error& e) {
-        LOG(Trace, "Error adding index: " + std::string(e.what()));
+  void SqlFile_Impl::removeStaleIndexSidecars(const openstudio::path& sidecarPath) const {
+    // Sidecars built for older versions of the same file would otherwise pile up in the temp directory, one full copy per re-run
+    const std::string prefix = indexSidecarPrefix();
+    const std::string current = toString(sidecarPath.filename());
+    boost::system::error_code ec;
+    for (openstudio::filesystem::directory_iterator it(sidecarPath.parent_path(), ec), end; !ec && it != end; it.increment(ec)) {
+      const std::string fileName = toString(it->path().filename());
+      // Leave alone the sidecar of the current version, and a copy of it that another process may be building
+      if (fileName.compare(0, prefix.size(), prefix) == 0 && fileName.compare(0, current.size(), current) != 0) {
+        // May fail if another process still has it open (on Windows), it is then removed by a later run
+        boost::system::error_code removeEc;
+        openstudio::filesystem::remove(it->path(), removeEc);
       }
+    }
+  }
+
+  void SqlFile_Impl::createIndexSidecar() {
+    if (!m_connectionOpen || !m_indexSidecarPath.empty()) {
+      return;
+    }
 
+    // SQLite cannot index a table from another database, so the sidecar is an indexed copy of the whole file, built once and shared by
+    // every process that opens the same results
+    const openstudio::path sidecarPath = indexSidecarPath();
+    if (!openstudio::filesystem::exists(sidecarPath)) {
       try {
-        execAndThrowOnError("CREATE INDEX IF NOT EXISTS dmhdHRI ON DaylightMapHourlyData (HourlyReportIndex ASC);");
-      } catch (const std::runtime_error& e) {
-        LOG(Trace, "Error adding index: " + std::string(e.what()));
+        openstudio::filesystem::create_directories(sidecarPath.parent_path());
+      } catch (const std::exception& e) {
+        LOG(Warn, "Unable to create the index sidecar directory '" << toString(sidecarPath.parent_path()) << "': " << e.what());
+        return;
       }
 
-      try {
-        execAndThrowOnError("CREATE INDEX IF NOT EXISTS dmhrMNI ON DaylightMapHourlyReports (MapNumber);");
-      } catch (const std::runtime_error& e) {
-        LOG(Trace, "Error adding index: " + std::string(e.what()));
+      // Build under a unique name then rename, so concurrent processes never open a half-written sidecar
+      const openstudio::path tmpPath =
+        sidecarPath.parent_path() / toPath(toString(sidecarPath.filename()) + "." + openstudio::removeBraces(openstudio::createUUID()));
+      sqlite3* sidecarDb = nullptr;
+      bool ok = (sqlite3_open_v2(toString(tmpPath).c_str(), &sidecarDb, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) == SQLITE_OK);
+      if (ok) {
+        sqlite3_backup* backup = sqlite3_backup_init(sidecarDb, "main", m_db, "main");
+        ok = (backup != nullptr) && (sqlite3_backup_step(backup, -1) == SQLITE_DONE);
+        if (backup != nullptr) {
+          ok = (sqlite3_backup_finish(backup) == SQLITE_OK) && ok;
+        }
+      }
+      if (ok) {
+        for (const auto& stmt : indexStatements) {
+          char* err = nullptr;
+          if (sqlite3_exec(sidecarDb, std::string{stmt}.c_str(), nullptr, nullptr, &err) != SQLITE_OK) {
+            LOG(Trace, "Error adding index to sidecar: " << (err != nullptr ? err : ""));
+            sqlite3_free(err);
+          }
+        }
       }
+      sqlite3_close(sidecarDb);
+
+      if (ok) {
+        try {
+          boost::filesystem::rename(tmpPath, sidecarPath);
+        } catch (const std::exception&) {
+          // Another process won the race, its sidecar is just as good
+          ok = openstudio::filesystem::exists(sidecarPath);
+        }
+      }
+      openstudio::filesystem::remove(tmpPath);
+      if (!ok) {
+        LOG(Warn, "Unable to build the index sidecar for '" << toString(m_path) << "', queries will run without indexes");
+        return;
+      }
+      removeStaleIndexSidecars(sidecarPath);
+    }
+
+    m_indexSidecarPath = sidecarPath;
+    if (!reopen()) {
+      LOG(Warn, "Unable to open the index sidecar '" << toString(sidecarPath) << "', falling back to the original file");
+      m_indexSidecarPath.clear();
+      reopen();
     }
   }
 
@@ -428,6 +550,179 @@ namespace detail {
     return m_connectionOpen;
   }
 
+  bool SqlFile_Impl::readOnly() const {
+    return m_readOnly;
+  }
+
+  bool SqlFile_Impl::exportTimeSeriesCache(const openstudio::path& cachePath, const std::vector<std::string>& timeSeriesNames) const {
+    if (!m_connectionOpen) {
+      return false;
+    }
+
+    // The shared time axis: one entry per row of the Time table
+    SqlFileTimeSeriesCache::TimeAxis timeAxis;
+    std::unordered_map<int, std::uint32_t> timeIndexToPosition;
+    {
+      std::string s = "SELECT TimeIndex, ";
+      if (hasYear()) {
+        s += "Year, ";
+      }
+      s += "Month, Day, Interval, EnvironmentPeriodIndex FROM Time ORDER BY TimeIndex";
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      sqlite3_prepare_v2(connection(), s.c_str(), -1, &sqlStmtPtr, nullptr);
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        int b = 0;
+        timeIndexToPosition.emplace(sqlite3_column_int(sqlStmtPtr, b++), static_cast<std::uint32_t>(timeAxis.year.size()));
+        timeAxis.year.push_back(hasYear() ? sqlite3_column_int(sqlStmtPtr, b++) : 0);
+        timeAxis.month.push_back(sqlite3_column_int(sqlStmtPtr, b++));
+        timeAxis.day.push_back(sqlite3_column_int(sqlStmtPtr, b++));
+        timeAxis.interval.push_back(sqlite3_column_int(sqlStmtPtr, b++));
+        timeAxis.envPeriodIndex.push_back(sqlite3_column_int(sqlStmtPtr, b++));
+      }
+      sqlite3_finalize(sqlStmtPtr);
+    }
+
+    // The dictionary indexes to extract, per table
+    std::map<std::string, std::set<int>> wantedRecordIndexes;
+    for (const auto& item : m_dataDictionary) {
+      if (timeSeriesNames.empty() || std::find(timeSeriesNames.begin(), timeSeriesNames.end(), item.name) != timeSeriesNames.end()) {
+        wantedRecordIndexes[item.table].insert(item.recordIndex);
+      }
+    }
+
+    // A single pass over each data table, bucketing the values per data dictionary item. Rows come back in the same order as the
+    // per-item queries in timeSeries, so the cached columns are identical to what they return
+    std::map<std::pair<int, int>, SqlFileTimeSeriesCache::Column> columns;
+    for (const auto& [table, recordIndexes] : wantedRecordIndexes) {
+      std::string dictionaryColumn;
+      if (table == "ReportMeterData") {
+        dictionaryColumn = "ReportMeterDataDictionaryIndex";
+      } else if (table == "ReportVariableData") {
+        dictionaryColumn = "ReportVariableDataDictionaryIndex";
+      } else {
+        continue;
+      }
+      const std::string s = "SELECT " + dictionaryColumn + ", TimeIndex, VariableValue FROM " + table;
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      sqlite3_prepare_v2(connection(), s.c_str(), -1, &sqlStmtPtr, nullptr);
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        const int recordIndex = sqlite3_column_int(sqlStmtPtr, 0);
+        if (recordIndexes.find(recordIndex) == recordIndexes.end()) {
+          continue;
+        }
+        auto it = timeIndexToPosition.find(sqlite3_column_int(sqlStmtPtr, 1));
+        if (it == timeIndexToPosition.end()) {
+          continue;
+        }
+        const int envPeriodIndex = timeAxis.envPeriodIndex[it->second];
+        auto& column = columns[std::make_pair(recordIndex, envPeriodIndex)];
+        column.recordIndex = recordIndex;
+        column.envPeriodIndex = envPeriodIndex;
+        column.timePositions.push_back(it->second);
+        column.values.push_back(sqlite3_column_double(sqlStmtPtr, 2));
+      }
+      sqlite3_finalize(sqlStmtPtr);
+    }
+
+    // Items without any data still get an (empty) column, so they are served from the cache too
+    for (const auto& item : m_dataDictionary) {
+      auto it = wantedRecordIndexes.find(item.table);
+      if ((it != wantedRecordIndexes.end()) && (it->second.count(item.recordIndex) != 0)) {
+        auto& column = columns[std::make_pair(item.recordIndex, item.envPeriodIndex)];
+        column.recordIndex = item.recordIndex;
+        column.envPeriodIndex = item.envPeriodIndex;
+      }
+    }
+
+    std::vector<SqlFileTimeSeriesCache::Column> columnVector;
+    columnVector.reserve(columns.size());
+    for (auto& [key, column] : columns) {
+      columnVector.push_back(std::move(column));
+    }
+
+    return SqlFileTimeSeriesCache::write(cachePath, openstudio::filesystem::file_size(m_path),
+                                         openstudio::filesystem::last_write_time_as_time_t(m_path), timeAxis, std::move(columnVector));
+  }
+
+  bool SqlFile_Impl::attachTimeSeriesCache(const openstudio::path& cachePath) {
+    auto cache = SqlFileTimeSeriesCache::load(cachePath, openstudio::filesystem::file_size(m_path),
+                                              openstudio::filesystem::last_write_time_as_time_t(m_path));
+    if (!cache) {
+      return false;
+    }
+    LOG(Debug, "Serving " << cache->numColumns() << " time series from the cache at '" << toString(cachePath) << "'");
+    m_timeSeriesCache = std::move(cache);
+    return true;
+  }
+
+  void SqlFile_Impl::detachTimeSeriesCache() {
+    m_timeSeriesCache.reset();
+  }
+
+  bool SqlFile_Impl::hasTimeSeriesCache() const {
+    return m_timeSeriesCache != nullptr;
+  }
+
+  sqlite3* SqlFile_Impl::openReadOnlyConnection() const {
+    const openstudio::path& dbPath = m_indexSidecarPath.empty() ? m_path : m_indexSidecarPath;
+    sqlite3* db = nullptr;
+    // Each connection is only ever used by a single thread, so there is no need for SQLite's own per-connection mutex
+    int code = sqlite3_open_v2(immutableUri(dbPath).c_str(), &db, SQLITE_OPEN_READONLY | SQLITE_OPEN_URI | SQLITE_OPEN_NOMUTEX, nullptr);
+    if (code != SQLITE_OK) {
+      LOG(Error, "Unable to open a read-only connection to '" << toString(dbPath) << "': " << sqlite3_errstr(code));
+      sqlite3_close(db);
+      return nullptr;
+    }
+    return db;
+  }
+
+  SqlFile_Impl::ThreadConnection::~ThreadConnection() {
+    close();
+  }
+
+  bool SqlFile_Impl::ThreadConnection::isClosed() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return closed;
+  }
+
+  void SqlFile_Impl::ThreadConnection::close() {
+    std::lock_guard<std::mutex> lock(mutex);
+    sqlite3_close(db);
+    db = nullptr;
+    closed = true;
+  }
+
+  sqlite3* SqlFile_Impl::connection() const {
+    if (!m_readOnly || !m_connectionOpen || std::this_thread::get_id() == m_ownerThreadId) {
+      return m_db;
+    }
+
+    // Held per thread rather than by thread id in the SqlFile_Impl: the connections of short-lived threads are closed as they exit,
+    // and a thread can never pick up the connection of an earlier thread that had the same id
+    thread_local std::unordered_map<std::uint64_t, std::shared_ptr<ThreadConnection>> threadConnections;
+    auto it = threadConnections.find(m_openId);
+    if (it != threadConnections.end()) {
+      return it->second->db;
+    }
+
+    // forget the connections of the files closed since
+    for (auto jt = threadConnections.begin(); jt != threadConnections.end();) {
+      jt = jt->second->isClosed() ? threadConnections.erase(jt) : std::next(jt);
+    }
+
+    auto threadConnection = std::make_shared<ThreadConnection>();
+    threadConnection->db = openReadOnlyConnection();
+    {
+      std::lock_guard<std::mutex> lock(m_threadConnectionsMutex);
+      m_threadConnections.erase(std::remove_if(m_threadConnections.begin(), m_threadConnections.end(),
+                                               [](const std::weak_ptr<ThreadConnection>& weakConnection) { return weakConnection.expired(); }),
+                                m_threadConnections.end());
+      m_threadConnections.push_back(threadConnection);
+    }
+    threadConnections.emplace(m_openId, threadConnection);
+    return threadConnection->db;
+  }
+
   int SqlFile_Impl::getNextIndex(const std::string& t_tableName, const std::string& t_columnName) {
     // Interestingly, you CANNOT bind any database identifier (such as the table name / column name) but only litteral values...
     // boost::optional<int> maxindex = execAndReturnFirstInt("SELECT MAX( ? ) FROM ?", t_columnName, t_tableName);
@@ -447,6 +742,15 @@ namespace detail {
 
   bool SqlFile_Impl::close() {
     if (m_connectionOpen) {
+      {
+        std::lock_guard<std::mutex> lock(m_threadConnectionsMutex);
+        for (const std::weak_ptr<ThreadConnection>& weakConnection : m_threadConnections) {
+          if (std::shared_ptr<ThreadConnection> threadConnection = weakConnection.lock()) {
+            threadConnection->close();
+          }
+        }
+        m_threadConnections.clear();
+      }
       sqlite3_close(m_db);
       m_connectionOpen = false;
     }
@@ -469,7 +773,15 @@ namespace detail {
     m_sqliteFilename = toString(m_path.make_preferred().native());
     std::string fileName = m_sqliteFilename;
 
-    int code = sqlite3_open_v2(fileName.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE, nullptr);
+    int code = 0;
+    if (m_readOnly) {
+      m_ownerThreadId = std::this_thread::get_id();
+      m_openId = nextOpenId++;
+      m_db = openReadOnlyConnection();
+      code = (m_db == nullptr) ? SQLITE_CANTOPEN : SQLITE_OK;
+    } else {
+      code = sqlite3_open_v2(fileName.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE, nullptr);
+    }
 
     m_connectionOpen = (code == 0);
     if (m_connectionOpen) {  // create index on dictionaryIndex for large table reportvariabledata
@@ -794,7 +1106,7 @@ namespace detail {
                          "  and VariableType='Sum' "
                          "  group by VariableName, ReportingFrequency, VariableUnits";
 
-      sqlite3_prepare_v2(m_db, stmt.c_str(), -1, &sqlStmtPtr, nullptr);
+      sqlite3_prepare_v2(connection(), stmt.c_str(), -1, &sqlStmtPtr, nullptr);
       while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
         double value = sqlite3_column_double(sqlStmtPtr, 0);
         std::string variablename = columnText(sqlite3_column_text(sqlStmtPtr, 1));
@@ -843,7 +1155,7 @@ namespace detail {
       std::map<int, std::string>::iterator envPeriodsItr;
 
       s << "SELECT EnvironmentPeriodIndex, EnvironmentName FROM EnvironmentPeriods";
-      sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
       code = sqlite3_step(sqlStmtPtr);
       while (code == SQLITE_ROW) {
         std::string queryEnvPeriod = boost::to_upper_copy(columnText(sqlite3_column_text(sqlStmtPtr, 1)));
@@ -855,7 +1167,7 @@ namespace detail {
       s.str("");
       s << "SELECT ReportMeterDataDictionaryIndex, VariableName, KeyValue, ReportingFrequency, VariableUnits";
       s << " FROM ReportMeterDataDictionary";
-      code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
       table = "ReportMeterData";
 
@@ -881,7 +1193,7 @@ namespace detail {
       s.str("");
       s << "SELECT ReportVariableDatadictionaryIndex, VariableName, KeyValue, ReportingFrequency, VariableUnits";
       s << " FROM ReportVariableDatadictionary";
-      code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
       table = "ReportVariableData";
 
@@ -2594,7 +2906,7 @@ namespace detail {
 
       sqlite3_stmt* sqlStmtPtr;
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
       code = sqlite3_step(sqlStmtPtr);
       std::stringstream s2;
@@ -2639,7 +2951,7 @@ namespace detail {
       s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
 
       sqlite3_stmt* sqlStmtPtr;
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
       code = sqlite3_step(sqlStmtPtr);
       if (code == SQLITE_ROW) {
@@ -2667,7 +2979,7 @@ namespace detail {
       s << "SELECT Month, Day, Hour from Time where TimeIndex in (";
       s << "SELECT min(timeIndex) FROM time )";
       sqlite3_stmt* sqlStmtPtr;
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
       code = sqlite3_step(sqlStmtPtr);
       if (code == SQLITE_ROW) {
@@ -2728,7 +3040,7 @@ namespace detail {
           s << ")";
 
           sqlite3_stmt* sqlStmtPtr;
-          int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+          int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
           code = sqlite3_step(sqlStmtPtr);
           if (code == SQLITE_ROW) {
@@ -2764,7 +3076,7 @@ namespace detail {
         << " LIMIT 1";
 
       sqlite3_stmt* sqlStmtPtr;
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
       code = sqlite3_step(sqlStmtPtr);
       if (code == SQLITE_ROW) {
@@ -2814,7 +3126,7 @@ namespace detail {
         << " order by TimeIndex DESC LIMIT 1";
 
       sqlite3_stmt* sqlStmtPtr;
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
       code = sqlite3_step(sqlStmtPtr);
       if (code == SQLITE_ROW) {
@@ -2872,59 +3184,19 @@ namespace detail {
       std::string energyPlusVersion = this->energyPlusVersion();
       VersionString version(energyPlusVersion);
 
-      std::stringstream s;
-      // v8.9.0 added the 'Year' field
-      s << "SELECT dt.VariableValue, ";
-      if (hasYear()) {
-        s << "Time.Year, ";
-      }
-      s << "Time.Month, Time.Day, "
-        // << "Time.Hour, Time.Minute, "
-        << "Time.Interval FROM ";
-      s << dataDictionary.table;
-      s << " dt INNER JOIN Time ON Time.timeIndex = dt.TimeIndex";
-      s << " WHERE ";
-      if (dataDictionary.table == "ReportMeterData") {
-        s << " dt.ReportMeterDataDictionaryIndex=";
-      } else if (dataDictionary.table == "ReportVariableData") {
-        s << " dt.ReportVariableDataDictionaryIndex=";
-      }
-      s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-      s << " AND Time.EnvironmentPeriodIndex = ";
-      s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
-
-      sqlite3_stmt* sqlStmtPtr;
-
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
-
-      code = sqlite3_step(sqlStmtPtr);
-      std::stringstream s2;
-      s2 << "SQL Query:" << '\n';
-      s2 << s.str();
-      s2 << "Return Code:" << '\n';
-      s2 << code;
-      LOG(Debug, s2.str());
-
       long cumulativeSeconds = 0;
 
-      while (code == SQLITE_ROW) {
-        int b = 0;
-        double value = sqlite3_column_double(sqlStmtPtr, b++);
+      // Handles one row of the time series, whether it comes from the time series cache or from the SQL query below
+      auto processRow = [&](double value, int yearValue, unsigned month, unsigned day, unsigned intervalColumn) {
         stdValues.push_back(value);
 
         boost::optional<unsigned> year;
-        if (hasYear()) {
-          year = sqlite3_column_int(sqlStmtPtr, b++);
-          // As of EnergyPlus 9.4 and perhaps earlier, the anual run periods will have a valid year,
-          // however the sizing periods will have year = 0
-          if (year.get() == 0) {
-            year.reset();
-          }
+        // As of EnergyPlus 9.4 and perhaps earlier, the anual run periods will have a valid year,
+        // however the sizing periods will have year = 0
+        if (hasYear() && (yearValue != 0)) {
+          year = yearValue;
         }
 
-        unsigned month = sqlite3_column_int(sqlStmtPtr, b++);
-        unsigned day = sqlite3_column_int(sqlStmtPtr, b++);
-
         // In cases where you report the same meter key for eg at Daily and at Timestep frequency
         // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
         // And since we can compute this easily, might as well do it
@@ -2937,7 +3209,7 @@ namespace detail {
           intervalMinutes = day * 24 * 60;
         } else {
           // If Detailed, Timestep, RunPeriod, or Annual: it varies
-          intervalMinutes = sqlite3_column_int(sqlStmtPtr, b);  // Notice I'm not incrementing the counter here on purpose
+          intervalMinutes = intervalColumn;
 
           if (reportingFrequency == ReportingFrequency::Annual) {
             // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
@@ -2951,8 +3223,6 @@ namespace detail {
             }
           }
         }
-        // Don't forget to increment the counter anyway, no matter whether we did call sqlite3_column_int or not
-        ++b;
 
         if ((version.major() == 8) && (version.minor() == 3)) {
           // workaround for bug in E+ 8.3, issue #1692
@@ -2993,13 +3263,71 @@ namespace detail {
           isIntervalTimeSeries = false;
           reportingIntervalMinutes.reset();
         }
+      };
+
+      const bool fromCache =
+        m_timeSeriesCache
+        && m_timeSeriesCache->forEachRow(dataDictionary.recordIndex, dataDictionary.envPeriodIndex,
+                                         [&processRow](double value, int year, int month, int day, int interval) {
+                                           processRow(value, year, static_cast<unsigned>(month), static_cast<unsigned>(day),
+                                                      static_cast<unsigned>(interval));
+                                         });
+
+      if (fromCache) {
+        LOG(Debug, "Served time series for record index " << dataDictionary.recordIndex << " from the time series cache");
+      } else {
+        std::stringstream s;
+        // v8.9.0 added the 'Year' field
+        s << "SELECT dt.VariableValue, ";
+        if (hasYear()) {
+          s << "Time.Year, ";
+        }
+        s << "Time.Month, Time.Day, "
+          // << "Time.Hour, Time.Minute, "
+          << "Time.Interval FROM ";
+        s << dataDictionary.table;
+        s << " dt INNER JOIN Time ON Time.timeIndex = dt.TimeIndex";
+        s << " WHERE ";
+        if (dataDictionary.table == "ReportMeterData") {
+          s << " dt.ReportMeterDataDictionaryIndex=";
+        } else if (dataDictionary.table == "ReportVariableData") {
+          s << " dt.ReportVariableDataDictionaryIndex=";
+        }
+        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
+        s << " AND Time.EnvironmentPeriodIndex = ";
+        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
+
+        sqlite3_stmt* sqlStmtPtr;
+
+        int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
-        // step to next row
         code = sqlite3_step(sqlStmtPtr);
-      }
+        std::stringstream s2;
+        s2 << "SQL Query:" << '\n';
+        s2 << s.str();
+        s2 << "Return Code:" << '\n';
+        s2 << code;
+        LOG(Debug, s2.str());
+
+        while (code == SQLITE_ROW) {
+          int b = 0;
+          double value = sqlite3_column_double(sqlStmtPtr, b++);
+          int year = 0;
+          if (hasYear()) {
+            year = sqlite3_column_int(sqlStmtPtr, b++);
+          }
+          unsigned month = sqlite3_column_int(sqlStmtPtr, b++);
+          unsigned day = sqlite3_column_int(sqlStmtPtr, b++);
+          unsigned interval = sqlite3_column_int(sqlStmtPtr, b++);
+          processRow(value, year, month, day, interval);
 
-      // must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
+          // step to next row
+          code = sqlite3_step(sqlStmtPtr);
+        }
+
+        // must finalize to prevent memory leaks
+        sqlite3_finalize(sqlStmtPtr);
+      }
 
       if (firstReportDateTime && !stdSecondsFromFirstReport.empty()) {
         if (isIntervalTimeSeries) {
@@ -3040,7 +3368,7 @@ namespace detail {
 
       sqlite3_stmt* sqlStmtPtr;
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
       code = sqlite3_step(sqlStmtPtr);
       std::stringstream s2;
@@ -3436,7 +3764,7 @@ namespace detail {
       // first date time of dst
       std::string s = "select month, day, hour, minute from Time where dst=1 group by month order by month, day, hour, minute";
 
-      int code = sqlite3_prepare_v2(m_db, s.c_str(), -1, &sqlStmtPtr, nullptr);
+      int code = sqlite3_prepare_v2(connection(), s.c_str(), -1, &sqlStmtPtr, nullptr);
 
       code = sqlite3_step(sqlStmtPtr);
       if (code == SQLITE_ROW) {
@@ -3452,7 +3780,7 @@ namespace detail {
       // last date time of dst
       s = "select month, day, hour, minute from Time where dst=1 group by month order by month desc, day desc, hour desc, minute desc";
 
-      code = sqlite3_prepare_v2(m_db, s.c_str(), -1, &sqlStmtPtr, nullptr);
+      code = sqlite3_prepare_v2(connection(), s.c_str(), -1, &sqlStmtPtr, nullptr);
 
       code = sqlite3_step(sqlStmtPtr);
       if (code == SQLITE_ROW) {
@@ -3487,7 +3815,7 @@ namespace detail {
     std::string result;
     if (m_db) {
       sqlite3_stmt* sqlStmtPtr;
-      sqlite3_prepare_v2(m_db, "SELECT EnergyPlusVersion FROM Simulations", -1, &sqlStmtPtr, nullptr);
+      sqlite3_prepare_v2(connection(), "SELECT EnergyPlusVersion FROM Simulations", -1, &sqlStmtPtr, nullptr);
       int code = sqlite3_step(sqlStmtPtr);
       if (code == SQLITE_ROW) {
         // in 8.1 this is 'EnergyPlus-Windows-32 8.1.0.008, YMD=2014.11.08 22:49'
@@ -3519,7 +3847,7 @@ namespace detail {
 
     sqlite3_stmt* sqlStmtPtr;
 
-    int code = sqlite3_prepare_v2(m_db, s.c_str(), -1, &sqlStmtPtr, nullptr);
+    int code = sqlite3_prepare_v2(connection(), s.c_str(), -1, &sqlStmtPtr, nullptr);
     code = sqlite3_step(sqlStmtPtr);
 
     while (code == SQLITE_ROW) {
@@ -3575,7 +3903,7 @@ namespace detail {
       std::stringstream s;
       s << "SELECT ReferencePt" << ptNum << " FROM DaylightMaps WHERE MapNumber=" << mapIndex;
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
       code = sqlite3_step(sqlStmtPtr);
 
       if (code == SQLITE_ROW) {
@@ -3587,7 +3915,7 @@ namespace detail {
       std::stringstream s;
       s << "SELECT ReferencePts FROM DaylightMaps WHERE MapNumber=" << mapIndex;
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
       code = sqlite3_step(sqlStmtPtr);
 
       if (code == SQLITE_ROW) {
@@ -3635,7 +3963,7 @@ namespace detail {
 
     sqlite3_stmt* sqlStmtPtr;
 
-    int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
     code = sqlite3_step(sqlStmtPtr);
 
     if (code == SQLITE_ROW) {
@@ -3672,7 +4000,7 @@ namespace detail {
 
     sqlite3_stmt* sqlStmtPtr;
 
-    int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
     code = sqlite3_step(sqlStmtPtr);
 
     if (code == SQLITE_ROW) {
@@ -3704,7 +4032,7 @@ namespace detail {
 
     sqlite3_stmt* sqlStmtPtr;
 
-    int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
     code = sqlite3_step(sqlStmtPtr);
 
     if (code == SQLITE_ROW) {
@@ -3861,7 +4189,7 @@ namespace detail {
 
     sqlite3_stmt* sqlStmtPtr;
 
-    int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
     code = sqlite3_step(sqlStmtPtr);
     while (code == SQLITE_ROW) {
       std::pair<int, DateTime> pair;
@@ -3905,7 +4233,7 @@ namespace detail {
 
     sqlite3_stmt* sqlStmtPtr;
 
-    int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
     code = sqlite3_step(sqlStmtPtr);
     if (code == SQLITE_ROW) {
       int b = 0;
@@ -3960,7 +4288,7 @@ namespace detail {
     sqlite3_stmt* sqlStmtPtr;
 
     boost::optional<int> timeIndex;
-    int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    int code = sqlite3_prepare_v2(connection(), s.str().c_str(), -1, &sqlStmtPtr, nullptr);
     code = sqlite3_step(sqlStmtPtr);
     if (code == SQLITE_ROW) {
       timeIndex = sqlite3_column_int(sqlStmtPtr, 0);
@@ -4008,7 +4336,7 @@ namespace detail {
 
     sqlite3_stmt* sqlStmtPtr;
 
-    int code = sqlite3_prepare_v2(m_db, statement.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    int code = sqlite3_prepare_v2(connection(), statement.str().c_str(), -1, &sqlStmtPtr, nullptr);
     code = sqlite3_step(sqlStmtPtr);
     if (code == SQLITE_ROW) {
       xVal = sqlite3_column_double(sqlStmtPtr, 0);
@@ -4079,7 +4407,7 @@ namespace detail {
 
     sqlite3_stmt* sqlStmtPtr;
 
-    int code = sqlite3_prepare_v2(m_db, statement.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    int code = sqlite3_prepare_v2(connection(), statement.str().c_str(), -1, &sqlStmtPtr, nullptr);
     code = sqlite3_step(sqlStmtPtr);
     while (code == SQLITE_ROW) {
       if (i >= M) {
@@ -4108,6 +4436,82 @@ namespace detail {
     return illuminance;
   }
 
+  IlluminanceMapSeries SqlFile_Impl::illuminanceMaps(const std::string& name) const {
+    boost::optional<int> mapIndex = illuminanceMapIndex(name);
+    if (!mapIndex) {
+      LOG(Error, "Unknown illuminance map '" << name << "'");
+      return {};
+    }
+    return illuminanceMaps(*mapIndex);
+  }
+
+  IlluminanceMapSeries SqlFile_Impl::illuminanceMaps(int mapIndex) const {
+    IlluminanceMapSeries result;
+
+    std::vector<std::pair<int, DateTime>> reportIndicesDates = illuminanceMapHourlyReportIndicesDates(mapIndex);
+    if (reportIndicesDates.empty()) {
+      return result;
+    }
+    std::sort(reportIndicesDates.begin(), reportIndicesDates.end(),
+              [](const std::pair<int, DateTime>& lhs, const std::pair<int, DateTime>& rhs) { return lhs.first < rhs.first; });
+    result.hourlyReportIndices.reserve(reportIndicesDates.size());
+    result.dateTimes.reserve(reportIndicesDates.size());
+    for (const auto& [hourlyReportIndex, dateTime] : reportIndicesDates) {
+      result.hourlyReportIndices.push_back(hourlyReportIndex);
+      result.dateTimes.push_back(dateTime);
+    }
+
+    // The grid is the same for every hour of a map
+    result.x = illuminanceMapX(result.hourlyReportIndices.front());
+    result.y = illuminanceMapY(result.hourlyReportIndices.front());
+    const size_t M = result.x.size();
+    const size_t N = result.y.size();
+    result.illuminance.assign(result.size() * M * N, 0.0);
+
+    const std::string statement = "SELECT d.HourlyReportIndex, d.X, d.Y, d.Illuminance FROM DaylightMapHourlyData d"
+                                  " INNER JOIN DaylightMapHourlyReports r ON r.HourlyReportIndex = d.HourlyReportIndex"
+                                  " WHERE r.MapNumber = ? ORDER BY d.HourlyReportIndex, d.Y, d.X";
+
+    sqlite3_stmt* sqlStmtPtr = nullptr;
+    sqlite3_prepare_v2(connection(), statement.c_str(), -1, &sqlStmtPtr, nullptr);
+    sqlite3_bind_int(sqlStmtPtr, 1, mapIndex);
+
+    // Rows come ordered by hour then by grid point, so the time slot only ever moves forward
+    size_t t = 0;
+    size_t nUnexpected = 0;
+    while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+      const int hourlyReportIndex = sqlite3_column_int(sqlStmtPtr, 0);
+      while ((t < result.size()) && (result.hourlyReportIndices[t] < hourlyReportIndex)) {
+        ++t;
+      }
+      if ((t == result.size()) || (result.hourlyReportIndices[t] != hourlyReportIndex)) {
+        ++nUnexpected;
+        continue;
+      }
+
+      const double xVal = sqlite3_column_double(sqlStmtPtr, 1);
+      const double yVal = sqlite3_column_double(sqlStmtPtr, 2);
+      const auto xIt = std::lower_bound(result.x.begin(), result.x.end(), xVal);
+      const auto yIt = std::lower_bound(result.y.begin(), result.y.end(), yVal);
+      if ((xIt == result.x.end()) || (*xIt != xVal) || (yIt == result.y.end()) || (*yIt != yVal)) {
+        ++nUnexpected;
+        continue;
+      }
+      const size_t i = std::distance(result.x.begin(), xIt);
+      const size_t j = std::distance(result.y.begin(), yIt);
+      result.illuminance[(t * N + j) * M + i] = sqlite3_column_double(sqlStmtPtr, 3);
+    }
+
+    /// must finalize to prevent memory leaks
+    sqlite3_finalize(sqlStmtPtr);
+
+    if (nUnexpected > 0) {
+      LOG(Warn, "Ignored " << nUnexpected << " illuminance map points of map " << mapIndex << " that are not on its " << M << "x" << N << " grid");
+    }
+
+    return result;
+  }
+
   // find the illuminance map index by name
   boost::optional<int> SqlFile_Impl::illuminanceMapIndex(const std::string& name) const {
     // TODO: haven't figured out how to bind properly to the LIKE statement, tried
@@ -33,9 +33,11 @@
 #include "../UtilitiesAPI.hpp"
 
 #include "SummaryData.hpp"
+#include "IlluminanceMapSeries.hpp"
 #include "SqlFileEnums.hpp"
 #include "SqlFileDataDictionary.hpp"
 #include "PreparedStatement.hpp"
+#include "SqlFileTimeSeriesCache.hpp"
 #include "../data/DataEnums.hpp"
 #include "../data/EndUses.hpp"
 #include "../core/Optional.hpp"
@@ -45,7 +47,12 @@
 
 #include <boost/optional.hpp>
 
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 struct sqlite3;
@@ -68,7 +75,9 @@ namespace detail {
     /// or if file is not valid
     /// createIndexes will create useful indexes when opening an sqlite file but for faster opening
     /// pass in false if those indexes are not needed
-    SqlFile_Impl(const openstudio::path& path, const bool createIndexes = true);
+    /// readOnly opens the file as an immutable read-only database which is never written to: createIndexes then builds the indexes into a
+    /// sidecar copy of the file in the temp directory, and each thread querying the file gets its own connection
+    SqlFile_Impl(const openstudio::path& path, const bool createIndexes = true, const bool readOnly = false);
 
     /// createIndexes will create useful indexes when creating an sqlite file but for faster creation
     /// pass in false if those indexes are not needed
@@ -87,6 +96,21 @@ namespace detail {
     /// returns whether or not connection is open
     bool connectionOpen() const;
 
+    /// returns whether the file was opened in read-only mode
+    bool readOnly() const;
+
+    /// extracts the time series named in timeSeriesNames (all of them if empty) into a columnar cache file at cachePath
+    bool exportTimeSeriesCache(const openstudio::path& cachePath, const std::vector<std::string>& timeSeriesNames) const;
+
+    /// serves time series from the cache file at cachePath, returns false if it does not match this file
+    bool attachTimeSeriesCache(const openstudio::path& cachePath);
+
+    /// stops serving time series from the cache
+    void detachTimeSeriesCache();
+
+    /// whether time series are served from a cache
+    bool hasTimeSeriesCache() const;
+
     /// get the path
     openstudio::path path() const;
 
@@ -1077,12 +1101,18 @@ namespace detail {
     /// value(i,j) is the illuminance at x(i), y(j) - returns x, y and illuminance
     void illuminanceMap(int hourlyReportIndex, std::vector<double>& x, std::vector<double>& y, std::vector<double>& illuminance) const;
 
+    /// all the hourly maps of the illuminance map, from a single query
+    IlluminanceMapSeries illuminanceMaps(int mapIndex) const;
+
+    /// all the hourly maps of the illuminance map, from a single query
+    IlluminanceMapSeries illuminanceMaps(const std::string& name) const;
+
     // execute a statement and return the first (if any) value as a double.
     // Variadic arguments are the bind arguments if any, to replace '?' placeholders in the statement string
     template <typename... Args>
     boost::optional<double> execAndReturnFirstDouble(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement stmt(statement, connection(), false, args...);
         return stmt.execAndReturnFirstDouble();
       }
       return boost::none;
@@ -1093,7 +1123,7 @@ namespace detail {
     template <typename... Args>
     boost::optional<int> execAndReturnFirstInt(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement stmt(statement, connection(), false, args...);
         return stmt.execAndReturnFirstInt();
       }
       return boost::none;
@@ -1104,7 +1134,7 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::string> execAndReturnFirstString(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement stmt(statement, connection(), false, args...);
         return stmt.execAndReturnFirstString();
       }
       return boost::none;
@@ -1115,7 +1145,7 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<double>> execAndReturnVectorOfDouble(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement stmt(statement, connection(), false, args...);
         return stmt.execAndReturnVectorOfDouble();
       }
       return boost::none;
@@ -1126,7 +1156,7 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<int>> execAndReturnVectorOfInt(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement stmt(statement, connection(), false, args...);
         return stmt.execAndReturnVectorOfInt();
       }
       return boost::none;
@@ -1137,7 +1167,7 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<std::string>> execAndReturnVectorOfString(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement stmt(statement, connection(), false, args...);
         return stmt.execAndReturnVectorOfString();
       }
       return boost::none;
@@ -1151,7 +1181,7 @@ namespace detail {
       constexpr auto SQLITE_ERROR = 1;
       auto code = SQLITE_ERROR;
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement stmt(statement, connection(), false, args...);
         code = stmt.execute();
       }
       return code;
@@ -1200,6 +1230,25 @@ namespace detail {
    private:
     void init();
 
+    // The connection to use from the calling thread. In read-only mode each thread gets its own connection, opened lazily and closed
+    // when the thread exits or the file is closed, whichever comes first
+    sqlite3* connection() const;
+
+    // Opens a read-only connection to the file (or its index sidecar if any), returns nullptr on failure
+    sqlite3* openReadOnlyConnection() const;
+
+    // Path to the indexed copy of the file used in read-only mode
+    openstudio::path indexSidecarPath() const;
+
+    // Start of the name of every sidecar built for this file, whatever its version
+    std::string indexSidecarPrefix() const;
+
+    // Removes the sidecars built for older versions of this file
+    void removeStaleIndexSidecars(const openstudio::path& sidecarPath) const;
+
+    // Builds (if needed) and switches to the indexed sidecar copy of the file in read-only mode
+    void createIndexSidecar();
+
     void retrieveDataDictionary();
 
     // executes **MULTIPLE** statement and throws if it failed, used for create/drop tables.
@@ -1246,6 +1295,30 @@ namespace detail {
     sqlite3* m_db;
     std::string m_sqliteFilename;
 
+    bool m_readOnly = false;
+    openstudio::path m_indexSidecarPath;
+    std::thread::id m_ownerThreadId;
+
+    // A read-only connection of a thread other than the owner one. It is owned by a thread_local holder of that thread, the SqlFile_Impl
+    // only keeps track of it to close it when the file is closed first
+    struct ThreadConnection
+    {
+      ~ThreadConnection();
+      bool isClosed();
+      void close();
+
+      std::mutex mutex;
+      sqlite3* db = nullptr;
+      bool closed = false;
+    };
+
+    // Identifies this opening of the file in the thread_local holders, never reused (not even by reopen)
+    std::uint64_t m_openId = 0;
+    mutable std::mutex m_threadConnectionsMutex;
+    mutable std::vector<std::weak_ptr<ThreadConnection>> m_threadConnections;
+
+    std::shared_ptr<const SqlFileTimeSeriesCache> m_timeSeriesCache;
+
     bool m_supportedVersion;
 
     bool m_hasYear;
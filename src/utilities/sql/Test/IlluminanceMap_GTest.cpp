@@ -247,3 +247,32 @@ TEST_F(IlluminanceMapFixture, IlluminanceMap_Year) {
   EXPECT_TRUE(firstDateTime.date().baseYear());
   EXPECT_EQ(2017, firstDateTime.date().baseYear().get());
 }
+
+TEST_F(IlluminanceMapFixture, IlluminanceMap_Batch) {
+  const std::string& mapName = "CLASSROOM ILLUMINANCE MAP";
+
+  std::vector<std::pair<int, DateTime>> reportIndicesDates = sqlFile.illuminanceMapHourlyReportIndicesDates(mapName);
+  ASSERT_FALSE(reportIndicesDates.empty());
+
+  IlluminanceMapSeries maps = sqlFile.illuminanceMaps(mapName);
+  ASSERT_EQ(reportIndicesDates.size(), maps.size());
+  ASSERT_EQ(maps.size(), maps.dateTimes.size());
+  ASSERT_EQ(9u, maps.x.size());
+  ASSERT_EQ(9u, maps.y.size());
+  ASSERT_EQ(maps.size() * 9 * 9, maps.illuminance.size());
+
+  // Each map is identical to the one retrieved hour by hour
+  for (size_t t = 0; t < maps.size(); ++t) {
+    Matrix expected = sqlFile.illuminanceMap(maps.hourlyReportIndices[t]);
+    ASSERT_EQ(expected.size1(), maps.x.size());
+    ASSERT_EQ(expected.size2(), maps.y.size());
+    for (unsigned i = 0; i < expected.size1(); ++i) {
+      for (unsigned j = 0; j < expected.size2(); ++j) {
+        EXPECT_EQ(expected(i, j), maps.value(t, i, j));
+      }
+    }
+    EXPECT_EQ(sqlFile.illuminanceMapDate(maps.hourlyReportIndices[t]).get(), maps.dateTimes[t]);
+  }
+
+  EXPECT_EQ(0u, sqlFile.illuminanceMaps("NOT A MAP").size());
+}
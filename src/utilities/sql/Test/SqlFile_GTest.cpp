@@ -38,6 +38,8 @@
 #include "../../data/DataEnums.hpp"
 #include "../../data/TimeSeries.hpp"
 #include "../../filetypes/EpwFile.hpp"
+#include "../../core/Checksum.hpp"
+#include "../../data/Vector.hpp"
 #include "../../units/UnitFactory.hpp"
 #include "../../idf/Workspace.hpp"
 #include "../../idf/WorkspaceObject.hpp"
@@ -52,6 +54,7 @@
 #include <boost/regex.hpp>
 #include <resources.hxx>
 #include <stdexcept>
+#include <thread>
 
 using namespace std;
 using namespace boost;
@@ -858,3 +861,121 @@ TEST_F(SqlFileFixture, 4403_FenestrationAssembly) {
   ASSERT_TRUE(sqlFile.assemblyVisibleTransmittance("Story 1 Core Space Exterior Wall Window"));
   EXPECT_EQ(0.440, sqlFile.assemblyVisibleTransmittance("Story 1 Core Space Exterior Wall Window").get());
 }
+
+TEST_F(SqlFileFixture, SqlFile_ReadOnly) {
+  openstudio::path srcPath = resourcesPath() / toPath("energyplus/5ZoneAirCooled/eplusout.sql");
+  openstudio::path sqlPath = openstudio::filesystem::temp_directory_path() / toPath("SqlFile_ReadOnly.sql");
+  openstudio::filesystem::copy_file(srcPath, sqlPath, openstudio::filesystem::copy_options::overwrite_existing);
+  const std::string checksumBefore = openstudio::checksum(sqlPath);
+
+  std::vector<std::string> expectedEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(expectedEnvPeriods.empty());
+  openstudio::OptionalTimeSeries expectedTs = sqlFile.timeSeries(expectedEnvPeriods[0], "Hourly", "Electricity:Facility", "");
+  ASSERT_TRUE(expectedTs);
+
+  {
+    openstudio::SqlFile readOnlySqlFile(sqlPath, true, true);
+    ASSERT_TRUE(readOnlySqlFile.connectionOpen());
+    EXPECT_TRUE(readOnlySqlFile.readOnly());
+    ASSERT_TRUE(readOnlySqlFile.netSiteEnergy());
+    EXPECT_DOUBLE_EQ(*sqlFile.netSiteEnergy(), *readOnlySqlFile.netSiteEnergy());
+
+    // Query it from several threads at once, each of which gets its own connection
+    std::vector<openstudio::OptionalTimeSeries> results(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); ++i) {
+      threads.emplace_back([&readOnlySqlFile, &results, &expectedEnvPeriods, i]() {
+        results[i] = readOnlySqlFile.timeSeries(expectedEnvPeriods[0], "Hourly", "Electricity:Facility", "");
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    for (const auto& ts : results) {
+      ASSERT_TRUE(ts);
+      EXPECT_EQ(expectedTs->values().size(), ts->values().size());
+      EXPECT_DOUBLE_EQ(openstudio::sum(expectedTs->values()), openstudio::sum(ts->values()));
+    }
+  }
+
+  // The results file itself was never touched
+  EXPECT_EQ(checksumBefore, openstudio::checksum(sqlPath));
+
+  const openstudio::path sidecarDir = openstudio::filesystem::temp_directory_path() / toPath("openstudio-sql-indexes");
+  auto sidecars = [&sidecarDir]() {
+    std::vector<openstudio::path> result;
+    for (const auto& entry : openstudio::filesystem::directory_iterator(sidecarDir)) {
+      if (toString(entry.path().filename()).rfind("SqlFile_ReadOnly-", 0) == 0) {
+        result.push_back(entry.path());
+      }
+    }
+    return result;
+  };
+  EXPECT_EQ(1u, sidecars().size());
+
+  // Once the file changes, the sidecar of its previous version is removed instead of being kept next to the new one
+  openstudio::filesystem::last_write_time(sqlPath, openstudio::filesystem::last_write_time(sqlPath) + 10);
+  {
+    openstudio::SqlFile readOnlySqlFile(sqlPath, true, true);
+    ASSERT_TRUE(readOnlySqlFile.connectionOpen());
+    ASSERT_TRUE(readOnlySqlFile.netSiteEnergy());
+  }
+  const auto remaining = sidecars();
+  EXPECT_EQ(1u, remaining.size());
+
+  for (const auto& sidecarPath : remaining) {
+    openstudio::filesystem::remove(sidecarPath);
+  }
+  openstudio::filesystem::remove(sqlPath);
+}
+
+TEST_F(SqlFileFixture, SqlFile_TimeSeriesCache) {
+  openstudio::path srcPath = resourcesPath() / toPath("energyplus/5ZoneAirCooled/eplusout.sql");
+  openstudio::path sqlPath = openstudio::filesystem::temp_directory_path() / toPath("SqlFile_TimeSeriesCache.sql");
+  openstudio::filesystem::copy_file(srcPath, sqlPath, openstudio::filesystem::copy_options::overwrite_existing);
+  openstudio::path cachePath = toPath(toString(sqlPath) + ".tscache");
+  openstudio::filesystem::remove(cachePath);
+
+  std::vector<std::string> envPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(envPeriods.empty());
+
+  {
+    openstudio::SqlFile uncached(sqlPath);
+    ASSERT_TRUE(uncached.connectionOpen());
+    EXPECT_FALSE(uncached.hasTimeSeriesCache());
+    ASSERT_TRUE(uncached.exportTimeSeriesCache(cachePath));
+  }
+
+  // The cache next to the file is picked up automatically
+  openstudio::SqlFile cached(sqlPath);
+  ASSERT_TRUE(cached.connectionOpen());
+  EXPECT_TRUE(cached.hasTimeSeriesCache());
+
+  for (const std::string& reportingFrequency : sqlFile.availableReportingFrequencies(envPeriods[0])) {
+    for (const std::string& name : sqlFile.availableVariableNames(envPeriods[0], reportingFrequency)) {
+      for (const std::string& keyValue : sqlFile.availableKeyValues(envPeriods[0], reportingFrequency, name)) {
+        openstudio::OptionalTimeSeries expected = sqlFile.timeSeries(envPeriods[0], reportingFrequency, name, keyValue);
+        openstudio::OptionalTimeSeries actual = cached.timeSeries(envPeriods[0], reportingFrequency, name, keyValue);
+        ASSERT_EQ(expected.has_value(), actual.has_value()) << reportingFrequency << ", " << name << ", " << keyValue;
+        if (expected) {
+          EXPECT_EQ(expected->firstReportDateTime(), actual->firstReportDateTime());
+          EXPECT_EQ(expected->values().size(), actual->values().size());
+          EXPECT_DOUBLE_EQ(openstudio::sum(expected->values()), openstudio::sum(actual->values()));
+          EXPECT_EQ(expected->secondsFromFirstReport(), actual->secondsFromFirstReport());
+        }
+      }
+    }
+  }
+
+  cached.detachTimeSeriesCache();
+  EXPECT_FALSE(cached.hasTimeSeriesCache());
+  EXPECT_TRUE(cached.attachTimeSeriesCache(cachePath));
+
+  // A cache exported from another file is refused
+  EXPECT_FALSE(sqlFile2.attachTimeSeriesCache(cachePath));
+  EXPECT_FALSE(sqlFile2.hasTimeSeriesCache());
+
+  cached.close();
+  openstudio::filesystem::remove(cachePath);
+  openstudio::filesystem::remove(sqlPath);
+}
@@ -183,6 +183,36 @@ TEST_F(XMLValidatorFixture, XMLValidator_schematronToXslt) {
   EXPECT_TRUE(openstudio::filesystem::is_regular_file(expectedPath));
 }
 
+TEST_F(XMLValidatorFixture, XMLValidator_GBXMLvalidator_Batch) {
+  std::vector<openstudio::path> xmlPaths;
+  for (const auto* filename : {"gbxml/TestCube.xml", "gbxml/seb.xml", "gbxml/TestCube.xml", "gbxml/TestSchedules.xml"}) {
+    xmlPaths.emplace_back(resourcesPath() / openstudio::toPath(filename));
+  }
+
+  auto xmlValidator = XMLValidator::gbxmlValidator();
+  // A second validator shares the compiled schema, and must report the same thing
+  auto otherValidator = XMLValidator::gbxmlValidator();
+  EXPECT_EQ(xmlValidator.schemaPath(), otherValidator.schemaPath());
+
+  std::vector<bool> results = xmlValidator.validate(xmlPaths);
+  ASSERT_EQ(xmlPaths.size(), results.size());
+  EXPECT_FALSE(xmlValidator.xmlPath());
+  EXPECT_EQ(8 + 16 + 8 + 16, xmlValidator.errors().size());
+  for (const auto& logMessage : xmlValidator.errors()) {
+    EXPECT_NE(std::string::npos, logMessage.logMessage().find(".xml: "));
+  }
+
+  for (size_t i = 0; i < xmlPaths.size(); ++i) {
+    EXPECT_FALSE(results[i]);
+    EXPECT_FALSE(otherValidator.validate(xmlPaths[i]));
+  }
+  EXPECT_EQ(16, otherValidator.errors().size());
+
+  // A missing file throws, like for a single validation
+  xmlPaths.emplace_back(resourcesPath() / openstudio::toPath("gbxml/does_not_exist.xml"));
+  EXPECT_ANY_THROW(xmlValidator.validate(xmlPaths));
+}
+
 TEST_P(GbXMLValidatorParametrizedFixture, XMLValidator_GBXMLvalidator_XSD) {
   const auto& [filename, n_warnings, n_errors] = GetParam();
 
@@ -81,7 +81,13 @@ namespace detail {
       }
 
       auto* errorCollector = static_cast<ErrorCollector*>(errorCollectorVoidPtr);
-      errorCollector->logMessages.emplace_back(level, "XMLValidator", build_structured_message(levelName, *error));
+      if (!error->file && !errorCollector->fileName.empty()) {
+        xmlError located = *error;
+        located.file = const_cast<char*>(errorCollector->fileName.c_str());
+        errorCollector->logMessages.emplace_back(level, "XMLValidator", build_structured_message(levelName, located));
+      } else {
+        errorCollector->logMessages.emplace_back(level, "XMLValidator", build_structured_message(levelName, *error));
+      }
     }
   }
 
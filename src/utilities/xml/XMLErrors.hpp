@@ -31,6 +31,7 @@
 #define UTILITIES_XML_XMLERRORS_HPP
 
 #include "../core/LogMessage.hpp"
+#include <string>
 #include <vector>
 
 using xmlError = struct _xmlError;
@@ -42,6 +43,8 @@ namespace detail {
   struct ErrorCollector
   {
     std::vector<LogMessage> logMessages;
+    // Reported as the location of structured errors that carry none, which is the case when validating while streaming a file
+    std::string fileName;
   };
 
   // Some callback function to collect messages into the ErrorCollector structure
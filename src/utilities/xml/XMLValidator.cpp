@@ -53,10 +53,108 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <atomic>
+#include <ctime>
 #include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace openstudio {
 
+namespace detail {
+
+  /** Process-wide cache of compiled XSD schemas and XSLT stylesheets, keyed by path and last write time.
+   *  Once compiled, xmlSchema and xsltStylesheet are only read during validation, so they are shared between threads: each validation
+   *  creates its own validation / transform context */
+  class CompiledSchemaCache
+  {
+   public:
+    struct CompiledSchema
+    {
+      std::shared_ptr<xmlSchema> schema;
+      // Errors and warnings issued while parsing the schema, replayed on each validation
+      std::vector<LogMessage> parserLogMessages;
+    };
+
+    static CompiledSchemaCache& instance() {
+      static CompiledSchemaCache cache;
+      return cache;
+    }
+
+    std::shared_ptr<const CompiledSchema> schema(const openstudio::path& schemaPath) {
+      const Key key = makeKey(schemaPath);
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_schemas.find(key);
+      if (it != m_schemas.end()) {
+        return it->second;
+      }
+      evictStale(m_schemas, key);
+
+      auto compiled = std::make_shared<CompiledSchema>();
+      detail::ErrorCollector schemaParserErrorCollector;
+      xmlSchemaParserCtxt* parser_ctxt = xmlSchemaNewParserCtxt(key.first.c_str());
+      xmlSchemaSetParserErrors(parser_ctxt, detail::callback_messages_error, detail::callback_messages_warning, &schemaParserErrorCollector);
+      compiled->schema = std::shared_ptr<xmlSchema>(xmlSchemaParse(parser_ctxt), [](xmlSchema* s) {
+        if (s != nullptr) {
+          xmlSchemaFree(s);
+        }
+      });
+      xmlSchemaFreeParserCtxt(parser_ctxt);
+      compiled->parserLogMessages = std::move(schemaParserErrorCollector.logMessages);
+
+      return m_schemas.emplace(key, std::move(compiled)).first->second;
+    }
+
+    /** sourcePath is what the cache is keyed on (eg: the Schematron), stylesheetPath is the XSLT stylesheet actually compiled */
+    std::shared_ptr<xsltStylesheet> stylesheet(const openstudio::path& sourcePath, const openstudio::path& stylesheetPath) {
+      const Key key = makeKey(sourcePath);
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_stylesheets.find(key);
+      if (it != m_stylesheets.end()) {
+        return it->second;
+      }
+      evictStale(m_stylesheets, key);
+
+      xmlSubstituteEntitiesDefault(1);
+      xmlLoadExtDtdDefaultValue = 1;
+      auto stylesheet_filename_str = openstudio::toString(stylesheetPath);
+      std::shared_ptr<xsltStylesheet> style(xsltParseStylesheetFile(detail::xml_string(stylesheet_filename_str)), [](xsltStylesheet* s) {
+        if (s != nullptr) {
+          xsltFreeStylesheet(s);
+        }
+      });
+
+      return m_stylesheets.emplace(key, std::move(style)).first->second;
+    }
+
+   private:
+    CompiledSchemaCache() = default;
+
+    using Key = std::pair<std::string, std::time_t>;
+
+    static Key makeKey(const openstudio::path& p) {
+      return {openstudio::toString(p), openstudio::filesystem::last_write_time_as_time_t(p)};
+    }
+
+    // Drop the entries compiled from an older version of the same file
+    template <typename T>
+    static void evictStale(std::map<Key, T>& entries, const Key& key) {
+      auto it = entries.lower_bound({key.first, std::numeric_limits<std::time_t>::min()});
+      while ((it != entries.end()) && (it->first.first == key.first)) {
+        it = entries.erase(it);
+      }
+    }
+
+    std::mutex m_mutex;
+    std::map<Key, std::shared_ptr<const CompiledSchema>> m_schemas;
+    std::map<Key, std::shared_ptr<xsltStylesheet>> m_stylesheets;
+  };
+
+}  // namespace detail
+
 xmlDoc* applyEmbeddedXSLT(const std::string& embedded_path, xmlDoc* curdoc, const char** params) {
 
   std::string xlstString = ::openstudio::embedded_files::getFileAsString(embedded_path);
@@ -173,7 +271,8 @@ detail::XMLInitializer& XMLValidator::xmlInitializerInstance() {
   return xmlInitializer;
 }
 
-XMLValidator::XMLValidator(const openstudio::path& schemaPath) : m_schemaPath(openstudio::filesystem::system_complete(schemaPath)) {
+XMLValidator::XMLValidator(const openstudio::path& schemaPath)
+  : m_schemaPath(openstudio::filesystem::system_complete(schemaPath)), m_sourceSchemaPath(m_schemaPath) {
 
   xmlInitializerInstance();
 
@@ -232,7 +331,11 @@ boost::optional<openstudio::path> XMLValidator::xmlPath() const {
 }
 
 void XMLValidator::logAndStore(LogLevel logLevel, const std::string& logMessage) const {
-  m_logMessages.emplace_back(logLevel, "openstudio.XMLValidator", logMessage);
+  logAndStore(m_logMessages, logLevel, logMessage);
+}
+
+void XMLValidator::logAndStore(std::vector<LogMessage>& logMessages, LogLevel logLevel, const std::string& logMessage) {
+  logMessages.emplace_back(logLevel, "openstudio.XMLValidator", logMessage);
   LOG(logLevel, logMessage);
 }
 
@@ -271,9 +374,7 @@ void XMLValidator::reset() {
   m_fullValidationReport.clear();
 }
 
-bool XMLValidator::validate(const openstudio::path& xmlPath) {
-
-  reset();
+openstudio::path XMLValidator::checkXmlPath(const openstudio::path& xmlPath) const {
 
   if (!openstudio::filesystem::exists(xmlPath)) {
     std::string logMessage = fmt::format("XML File '{}' does not exist.", toString(xmlPath));
@@ -285,91 +386,152 @@ bool XMLValidator::validate(const openstudio::path& xmlPath) {
     LOG_AND_THROW(logMessage);
   }
 
-  if (xmlPath.extension() == ".xml") {
-    auto t_xmlPath = openstudio::filesystem::system_complete(xmlPath);
-    m_xmlPath = t_xmlPath;
-  } else {
+  if (xmlPath.extension() != ".xml") {
     std::string logMessage = fmt::format("XML path extension '{}' not supported.", toString(xmlPath.extension()));
     m_logMessages.emplace_back(Fatal, "openstudio.XMLValidator", logMessage);
     LOG_AND_THROW(logMessage);
   }
 
+  return openstudio::filesystem::system_complete(xmlPath);
+}
+
+bool XMLValidator::validate(const openstudio::path& xmlPath) {
+
+  reset();
+
+  m_xmlPath = checkXmlPath(xmlPath);
+
   if (m_validatorType == XMLValidatorType::XSD) {
-    return xsdValidate();
+    return xsdValidate(m_xmlPath.get(), m_logMessages);
   } else if ((m_validatorType == XMLValidatorType::XSLTSchematron) || (m_validatorType == XMLValidatorType::Schematron)) {
-    return xsltValidate();
+    return xsltValidate(m_xmlPath.get(), m_logMessages, m_fullValidationReport);
   }
 
   return false;
 }
 
-bool XMLValidator::xsdValidate() const {
+std::vector<bool> XMLValidator::validate(const std::vector<openstudio::path>& xmlPaths) {
 
-  // schema path
-  auto schema_filename_str = toString(m_schemaPath);
-  const auto* schema_filename = schema_filename_str.c_str();
+  reset();
+
+  std::vector<openstudio::path> completePaths;
+  completePaths.reserve(xmlPaths.size());
+  for (const auto& xmlPath : xmlPaths) {
+    completePaths.emplace_back(checkXmlPath(xmlPath));
+  }
+
+  const size_t n = completePaths.size();
+  // Not a std::vector<bool>: its elements cannot be written concurrently
+  std::vector<char> results(n, 0);
+  std::vector<std::vector<LogMessage>> fileLogMessages(n);
+
+  std::atomic<size_t> next{0};
+  auto worker = [&]() {
+    std::string fullValidationReport;
+    for (size_t i = next++; i < n; i = next++) {
+      try {
+        if (m_validatorType == XMLValidatorType::XSD) {
+          results[i] = xsdValidate(completePaths[i], fileLogMessages[i]);
+        } else {
+          results[i] = xsltValidate(completePaths[i], fileLogMessages[i], fullValidationReport);
+        }
+      } catch (const std::exception& e) {
+        logAndStore(fileLogMessages[i], Fatal, fmt::format("Failed to validate '{}': {}", toString(completePaths[i]), e.what()));
+        results[i] = 0;
+      }
+    }
+  };
+
+  // Compile the schema (or fetch it from the cache) on this thread, so the workers never wait on each other for it
+  if (n > 0) {
+    if (m_validatorType == XMLValidatorType::XSD) {
+      detail::CompiledSchemaCache::instance().schema(m_schemaPath);
+    } else {
+      detail::CompiledSchemaCache::instance().stylesheet(m_sourceSchemaPath, m_schemaPath);
+    }
+  }
+
+  const size_t nThreads = std::min<size_t>(n, std::max(1U, std::thread::hardware_concurrency()));
+  std::vector<std::thread> threads;
+  if (nThreads > 1) {
+    threads.reserve(nThreads - 1);
+    for (size_t t = 1; t < nThreads; ++t) {
+      threads.emplace_back(worker);
+    }
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<bool> result(n);
+  for (size_t i = 0; i < n; ++i) {
+    result[i] = (results[i] != 0);
+    const std::string fileName = toString(completePaths[i].filename());
+    for (const auto& logMessage : fileLogMessages[i]) {
+      m_logMessages.emplace_back(logMessage.logLevel(), logMessage.logChannel(), fileName + ": " + logMessage.logMessage());
+    }
+  }
+
+  return result;
+}
+
+bool XMLValidator::xsdValidate(const openstudio::path& xmlPath, std::vector<LogMessage>& logMessages) const {
 
   // xml path
-  auto xml_filename_str = toString(m_xmlPath.get());
+  auto xml_filename_str = toString(xmlPath);
   const auto* xml_filename = xml_filename_str.c_str();
 
-  // schema parser ptr
-  xmlSchemaParserCtxt* parser_ctxt = xmlSchemaNewParserCtxt(schema_filename);
-
-  // set parser errors
-  detail::ErrorCollector schemaParserErrorCollector;
-  xmlSchemaSetParserErrors(parser_ctxt, detail::callback_messages_error, detail::callback_messages_warning, &schemaParserErrorCollector);
+  // compiled schema, shared with other validators and threads
+  auto compiled = detail::CompiledSchemaCache::instance().schema(m_schemaPath);
 
-  // schema parser
-  xmlSchema* schema = xmlSchemaParse(parser_ctxt);
-  xmlSchemaValidCtxt* ctxt = xmlSchemaNewValidCtxt(schema);
+  xmlSchemaValidCtxt* ctxt = xmlSchemaNewValidCtxt(compiled->schema.get());
 
   // set valid errors
   detail::ErrorCollector schemaValidErrorCollector;
   xmlSchemaSetValidErrors(ctxt, detail::callback_messages_error, detail::callback_messages_warning, &schemaValidErrorCollector);
 
   detail::ErrorCollector parseFileErrorCollector;
+  parseFileErrorCollector.fileName = xml_filename_str;
   xmlSetStructuredErrorFunc(&parseFileErrorCollector, detail::callback_messages_structured_error);
   xmlSetGenericErrorFunc(&parseFileErrorCollector, detail::callback_messages_error);
 
-  // xml doc ptr
-  xmlDoc* doc = xmlParseFile(xml_filename);
+  // validate while streaming the file through the SAX parser, so no DOM of the (possibly large) file is built
+  int ret = xmlSchemaValidateFile(ctxt, xml_filename, 0);
+
+  // The collector is about to go out of scope
+  xmlSetStructuredErrorFunc(nullptr, nullptr);
+  xmlSetGenericErrorFunc(nullptr, nullptr);
 
-  // validate doc
-  int ret = xmlSchemaValidateDoc(ctxt, doc);
   bool result = false;
   if (ret > 0) {
-    // LOG(Fatal, "Valid instance " << toString(m_xmlPath.get()) << " failed to validate against " << toString(m_schemaPath));
+    // LOG(Fatal, "Valid instance " << toString(xmlPath) << " failed to validate against " << toString(m_schemaPath));
     result = false;
   } else if (ret < 0) {
-    logAndStore(Fatal,
-                fmt::format("Valid instance '{}' got internal error validating against '{}'", toString(m_xmlPath.get()), toString(m_schemaPath)));
+    logAndStore(logMessages, Fatal,
+                fmt::format("Valid instance '{}' got internal error validating against '{}'", toString(xmlPath), toString(m_schemaPath)));
     result = false;
   } else {
     result = true;
   }
 
-  m_logMessages.reserve(m_logMessages.size() + schemaValidErrorCollector.logMessages.size() + schemaParserErrorCollector.logMessages.size()
-                        + parseFileErrorCollector.logMessages.size());
+  logMessages.reserve(logMessages.size() + schemaValidErrorCollector.logMessages.size() + compiled->parserLogMessages.size()
+                      + parseFileErrorCollector.logMessages.size());
 
   for (auto& logMessage : schemaValidErrorCollector.logMessages) {
-    logAndStore(logMessage.logLevel(), "xsdValidate.schemaValidError: " + logMessage.logMessage());
+    logAndStore(logMessages, logMessage.logLevel(), "xsdValidate.schemaValidError: " + logMessage.logMessage());
   }
 
-  for (auto& logMessage : schemaParserErrorCollector.logMessages) {
-    logAndStore(logMessage.logLevel(), "xsdValidate.schemaParserError: " + logMessage.logMessage());
+  for (const auto& logMessage : compiled->parserLogMessages) {
+    logAndStore(logMessages, logMessage.logLevel(), "xsdValidate.schemaParserError: " + logMessage.logMessage());
   }
 
   for (auto& logMessage : parseFileErrorCollector.logMessages) {
-    logAndStore(logMessage.logLevel(), "xsdValidate.parseFileError: " + logMessage.logMessage());
+    logAndStore(logMessages, logMessage.logLevel(), "xsdValidate.parseFileError: " + logMessage.logMessage());
   }
 
   // free
-  xmlSchemaFreeParserCtxt(parser_ctxt);
   xmlSchemaFreeValidCtxt(ctxt);
-  xmlSchemaFree(schema);
-
-  xmlFreeDoc(doc);
 
   return result;
 }
@@ -448,33 +610,32 @@ std::string dumpXSLTApplyResultToString(xmlDoc* res, xsltStylesheet* style) {
   return result;
 }
 
-bool XMLValidator::xsltValidate() const {
+bool XMLValidator::xsltValidate(const openstudio::path& xmlPath, std::vector<LogMessage>& logMessages, std::string& fullValidationReport) const {
 
   xmlSubstituteEntitiesDefault(1);
   xmlLoadExtDtdDefaultValue = 1;
 
-  auto schematron_filename_str = openstudio::toString(m_schemaPath);
-  xsltStylesheet* style = xsltParseStylesheetFile(detail::xml_string(schematron_filename_str));
+  // compiled stylesheet, shared with other validators and threads
+  auto style = detail::CompiledSchemaCache::instance().stylesheet(m_sourceSchemaPath, m_schemaPath);
 
-  auto filename_str = openstudio::toString(m_xmlPath.get());
+  auto filename_str = openstudio::toString(xmlPath);
   const auto* filename = filename_str.c_str();
   xmlDoc* doc = xmlParseFile(filename);
-  xmlDoc* res = xsltApplyStylesheet(style, doc, nullptr);
+  xmlDoc* res = xsltApplyStylesheet(style.get(), doc, nullptr);
 
   // Dump result of xlstApply
-  m_fullValidationReport = dumpXSLTApplyResultToString(res, style);
-  // fmt::print("\n====== Full Validation Report =====\n\n{}", m_fullValidationReport);
-  // xsltSaveResultToFile(stdout, res, style);
+  fullValidationReport = dumpXSLTApplyResultToString(res, style.get());
+  // fmt::print("\n====== Full Validation Report =====\n\n{}", fullValidationReport);
+  // xsltSaveResultToFile(stdout, res, style.get());
 
   std::vector<std::string> errors = processXSLTApplyResult(res);
   for (const auto& error : errors) {
-    logAndStore(Error, "xsltValidate: " + error);
+    logAndStore(logMessages, Error, "xsltValidate: " + error);
   }
 
   /* dump the resulting document */
   // xmlDocDump(stdout, res);
 
-  xsltFreeStylesheet(style);
   xmlFreeDoc(res);
   xmlFreeDoc(doc);
 
@@ -495,13 +656,17 @@ std::vector<LogMessage> XMLValidator::logMessages() const {
 }
 
 XMLValidator XMLValidator::gbxmlValidator() {
-  const auto tmpDir = openstudio::filesystem::create_temporary_directory("xmlvalidation");
-  if (tmpDir.empty()) {
-    LOG_AND_THROW("Failed to create a temporary directory for extracting the embedded path");
-  }
-  bool quiet = true;
-  ::openstudio::embedded_files::extractFile(":/xml/resources/GreenBuildingXML_Ver6.01.xsd", openstudio::toString(tmpDir), quiet);
-  return XMLValidator(tmpDir / "GreenBuildingXML_Ver6.01.xsd");
+  // Extract the embedded XSD only once per process, so every validator points to the same file and shares the compiled schema
+  static const openstudio::path xsdPath = []() {
+    const auto tmpDir = openstudio::filesystem::create_temporary_directory("xmlvalidation");
+    if (tmpDir.empty()) {
+      LOG_AND_THROW("Failed to create a temporary directory for extracting the embedded path");
+    }
+    bool quiet = true;
+    ::openstudio::embedded_files::extractFile(":/xml/resources/GreenBuildingXML_Ver6.01.xsd", openstudio::toString(tmpDir), quiet);
+    return tmpDir / "GreenBuildingXML_Ver6.01.xsd";
+  }();
+  return XMLValidator(xsdPath);
 }
 
 }  // namespace openstudio
@@ -41,6 +41,7 @@
 #include <boost/optional.hpp>
 
 #include <string>
+#include <vector>
 
 namespace openstudio {
 
@@ -84,6 +85,11 @@ class UTILITIES_API XMLValidator
 
   bool validate(const openstudio::path& xmlPath);
 
+  /** Validates several files in parallel. The compiled schema (or stylesheet) is shared by all threads.
+   *  Returns whether each file is valid, in the same order as xmlPaths. The log messages of all files are stored, each prefixed by the
+   *  file name, but xmlPath() and fullValidationReport() are left empty */
+  std::vector<bool> validate(const std::vector<openstudio::path>& xmlPaths);
+
   // Below functions are related to the last call to validate
 
   bool isValid() const;
@@ -117,17 +123,24 @@ class UTILITIES_API XMLValidator
 
   // LOG the message (to console) and store it in m_logMessages
   void logAndStore(LogLevel logLevel, const std::string& logMessage) const;
+  static void logAndStore(std::vector<LogMessage>& logMessages, LogLevel logLevel, const std::string& logMessage);
 
   openstudio::path m_schemaPath;
+  // The schema path as passed by the user, used to key the compiled schema cache (differs from m_schemaPath for a Schematron)
+  openstudio::path m_sourceSchemaPath;
   boost::optional<openstudio::path> m_xmlPath;
 
   boost::optional<openstudio::path> m_tempDir;
 
   XMLValidatorType m_validatorType;
 
-  bool xsdValidate() const;
+  // Checks that the xmlPath exists and is an .xml file, throws otherwise. Returns the complete path
+  openstudio::path checkXmlPath(const openstudio::path& xmlPath) const;
+
+  // These only read the validator state, so they can be called concurrently for different files
+  bool xsdValidate(const openstudio::path& xmlPath, std::vector<LogMessage>& logMessages) const;
 
-  bool xsltValidate() const;
+  bool xsltValidate(const openstudio::path& xmlPath, std::vector<LogMessage>& logMessages, std::string& fullValidationReport) const;
   mutable std::string m_fullValidationReport;
 
   // reset the state of the XMLValidator between translations
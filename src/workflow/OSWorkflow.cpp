@@ -66,6 +66,7 @@ OSWorkflow::OSWorkflow(const WorkflowRunOptions& t_workflowRunOptions, ScriptEng
     workflowJSON(t_workflowRunOptions.osw_path),
     m_no_simulation(t_workflowRunOptions.no_simulation),
     m_post_process_only(t_workflowRunOptions.post_process_only),
+    m_direct_epjson(t_workflowRunOptions.direct_epjson),
     m_show_stdout(t_workflowRunOptions.show_stdout),
     m_add_timings(t_workflowRunOptions.add_timings),
     m_style_stdout(t_workflowRunOptions.style_stdout) {
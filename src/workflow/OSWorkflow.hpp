@@ -53,6 +53,7 @@ class OSWorkflow
 
   bool m_no_simulation = false;
   bool m_post_process_only = false;
+  bool m_direct_epjson = false;
 
   // stdout stuff
   bool m_show_stdout = false;
@@ -9,6 +9,10 @@
 #include "../energyplus/ErrorFile.hpp"
 #include "../epjson/epJSONTranslator.hpp"
 #include "../utilities/idf/Workspace.hpp"
+#include "../utilities/idf/WorkspaceObject.hpp"
+#include "../utilities/idf/IdfFile.hpp"
+#include "../utilities/idd/IddObject.hpp"
+#include "../utilities/idd/IddEnums.hpp"
 
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 #include "../utilities/filetypes/RunOptions.hpp"
@@ -16,6 +20,7 @@
 #include "../utilities/core/Filesystem.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
 #include "../utilities/core/ASCIIStrings.hpp"
+#include "../utilities/core/Compare.hpp"
 #include "../utilities/core/ApplicationPathHelpers.hpp"
 #include "energyplus/ErrorFile.hpp"
 
@@ -26,11 +31,25 @@
 #include <boost/process.hpp>
 #include <boost/regex.hpp>
 
+#include <chrono>
 #include <cstdlib>
+#include <fstream>
 #include <stdexcept>
 
 namespace openstudio {
 
+/** Whether the Workspace has any object that ExpandObjects would rewrite: HVACTemplate:* and the GroundHeatTransfer:Slab/Basement
+  * preprocessor inputs. When there are none, running ExpandObjects is a no-op and we can skip writing the intermediate in.idf entirely */
+static bool workspaceNeedsExpandObjects(const Workspace& workspace) {
+  for (const auto& wo : workspace.objects()) {
+    const std::string iddName = wo.iddObject().name();
+    if (openstudio::istringEqual(iddName.substr(0, 13), "HVACTemplate:") || openstudio::istringEqual(iddName.substr(0, 19), "GroundHeatTransfer:")) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /** PrepareRunDirResults is an RAII helper
   * This will locate E+ exes, copy idd/epsjon to run Directory, and Chdir to the runDirectory.
   * It uses RAII to cleanup after itself (remove copied files, chdir back to original directory) */
@@ -146,12 +165,23 @@ void OSWorkflow::runEnergyPlus() {
     LOG(Info, "Starting simulation in run directory: " << runDirPath);
 
     auto inIDF = runDirPath / "in.idf";
-    // TODO: is this the right place /Do we want to do that if we chose epJSON?
-    detailedTimeBlock("Saving IDF", [this, &inIDF] { workspace_->save(inIDF, true); });
 
+    const bool writeEpJSON = m_direct_epjson || workflowJSON.runOptions()->epjson();
+    // In the direct epJSON mode, only go through ExpandObjects (and hence in.idf) when there is actually something to expand
+    const bool runExpandObjects =
+      !workflowJSON.runOptions()->skipExpandObjects() && (!m_direct_epjson || workspaceNeedsExpandObjects(workspace_.get()));
+
+    if (!m_direct_epjson || runExpandObjects) {
+      // TODO: is this the right place /Do we want to do that if we chose epJSON?
+      detailedTimeBlock("Saving IDF", [this, &inIDF] { workspace_->save(inIDF, true); });
+    } else {
+      LOG(Info, "No objects need expanding, skipping the IDF serialization and ExpandObjects");
+    }
+
+    bool wasExpanded = false;
     // TODO: workflow-gem was manually running expandObjects prior to the potential serialization to json
     // Should we rather pass -x to the E+ cmd line?
-    if (!workflowJSON.runOptions()->skipExpandObjects()) {
+    if (runExpandObjects) {
       const std::string cmd = openstudio::toString(runDirResults.expandObjectsExe.native());
       LOG(Info, "Running command '" << cmd << "'");
 
@@ -165,24 +195,48 @@ void OSWorkflow::runEnergyPlus() {
         if (openstudio::filesystem::is_regular_file(inIDF)) {
           boost::filesystem::rename(inIDF, runDirPath / "pre-expand.idf");
           boost::filesystem::rename(expanded, inIDF);
+          wasExpanded = true;
         }
       }
     }
 
-    if (workflowJSON.runOptions()->epjson()) {
-      LOG(Info, "Beginning the translation to epJSON using OpenStudio");
-      Json::Value jsonVal;
+    if (writeEpJSON) {
+      auto inEpJSON = runDirPath / openstudio::toPath("in.epJSON");
+      if (openstudio::filesystem::is_regular_file(inEpJSON)) {
+        openstudio::filesystem::remove(inEpJSON);
+      }
 
-      detailedTimeBlock("Translating to EnergyPlus epJSON", [this, &jsonVal]() { jsonVal = openstudio::epJSON::toJSON(workspace_.get()); });
+      if (m_direct_epjson) {
+        LOG(Info, "Writing the epJSON directly using OpenStudio");
+        bool ok = false;
+        detailedTimeBlock("Translating and saving EnergyPlus epJSON", [this, &ok, &inIDF, &inEpJSON, wasExpanded]() {
+          std::ofstream ofs(openstudio::toString(inEpJSON), std::ofstream::trunc);
+          if (wasExpanded) {
+            // The expanded objects only exist in the in.idf written by ExpandObjects, so that's what needs to be translated
+            if (auto expandedIdf = IdfFile::load(inIDF, IddFileType::EnergyPlus)) {
+              ok = openstudio::epJSON::toJSON(expandedIdf.get(), ofs);
+            } else {
+              LOG(Error, "Unable to load the expanded IDF at " << inIDF);
+            }
+          } else {
+            ok = openstudio::epJSON::toJSON(workspace_.get(), ofs);
+          }
+        });
+        if (!ok) {
+          throw std::runtime_error(fmt::format("Failed to write the epJSON file at {}", inEpJSON.string()));
+        }
+      } else {
+        LOG(Info, "Beginning the translation to epJSON using OpenStudio");
+        Json::Value jsonVal;
 
-      inIDF = runDirPath / openstudio::toPath("in.epJSON");
-      if (openstudio::filesystem::is_regular_file(inIDF)) {
-        openstudio::filesystem::remove(inIDF);
+        detailedTimeBlock("Translating to EnergyPlus epJSON", [this, &jsonVal]() { jsonVal = openstudio::epJSON::toJSON(workspace_.get()); });
+
+        detailedTimeBlock("Saving epJSON", [&jsonVal, &inEpJSON]() {
+          std::ofstream ofs(openstudio::toString(inEpJSON), std::ofstream::trunc);
+          ofs << jsonVal.toStyledString() << '\n';
+        });
       }
-      detailedTimeBlock("Saving epJSON", [&jsonVal, &inIDF]() {
-        std::ofstream ofs(openstudio::toString(inIDF), std::ofstream::trunc);
-        ofs << jsonVal.toStyledString() << '\n';
-      });
+      inIDF = inEpJSON;
     }
 
     // TODO: eventually we should change this system call to be an API call to libenergyplusapi (but we need E+ to add cmake exports)
@@ -204,6 +258,13 @@ void OSWorkflow::runEnergyPlus() {
         // boost::filesystem::ofstream ofs(runDirPath / "stdout-energyplus");
         std::ofstream stdout_ofs(openstudio::toString(runDirPath / "stdout-energyplus"), std::ofstream::trunc);
         std::string line;
+        // Follow eplusout.err while EnergyPlus runs, to report progress and fatal errors early. EnergyPlus is left to exit by itself after
+        // a fatal error, as it still writes eplusout.err, eplusout.end and its other outputs while shutting down
+        const auto errPath = runDirPath / "eplusout.err";
+        openstudio::filesystem::remove(errPath);
+        openstudio::energyplus::ErrorFile errFile(errPath, true);
+        auto lastErrCheck = std::chrono::steady_clock::now();
+        bool fatalReported = false;
         // bp::child c(cmd, bp::std_out > is);
         bp::child c(runDirResults.energyPlusExe, inIDF.filename(), bp::std_out > is);
         while (c.running() && std::getline(is, line)) {
@@ -211,6 +272,18 @@ void OSWorkflow::runEnergyPlus() {
           if (m_show_stdout) {
             fmt::print("{}\n", line);
           }
+          const auto now = std::chrono::steady_clock::now();
+          if (now - lastErrCheck >= std::chrono::seconds(1)) {
+            lastErrCheck = now;
+            if (errFile.update()) {
+              LOG(Info, "EnergyPlus running with " << errFile.severeErrors().size() << " Severe Errors, " << errFile.warnings().size()
+                                                   << " Warnings so far");
+              if (!fatalReported && !errFile.fatalErrors().empty()) {
+                fatalReported = true;
+                LOG(Error, "EnergyPlus reported a Fatal Error: " << errFile.fatalErrors().front());
+              }
+            }
+          }
         }
         c.wait();
         result = c.exit_code();
@@ -37,6 +37,7 @@ void WorkflowRunOptions::debug_print() const {
   fmt::print("\nWorkflowRunOptions:\n");
   fmt::print("osw_path={}\n", this->osw_path.string());
   fmt::print("no_simulation={}\n", this->no_simulation);
+  fmt::print("direct_epjson={}\n", this->direct_epjson);
   fmt::print("show_stdout={}\n", this->show_stdout);
   fmt::print("add_timings={}\n", this->add_timings);
   fmt::print("style_stdout={}\n", this->style_stdout);
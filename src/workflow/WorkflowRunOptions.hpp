@@ -45,6 +45,10 @@ struct WorkflowRunOptions
   bool no_simulation = false;
   bool post_process_only = false;
 
+  // Write in.epJSON straight from the translated Workspace, without going through in.idf. ExpandObjects (and the intermediate in.idf) are only
+  // run when the Workspace actually contains objects it needs to expand (HVACTemplate:*, GroundHeatTransfer:*). Implies runOptions.epjson()
+  bool direct_epjson = false;
+
   // stdout stuff
   bool show_stdout = false;
   bool add_timings = false;